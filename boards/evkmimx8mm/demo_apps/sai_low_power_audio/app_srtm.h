@@ -53,6 +53,15 @@
 #define APP_SAI_TX_DMA_SOURCE (1U)
 #define APP_SAI_TX_DMA_CHANNEL_PRIORITY (2U)
 #define APP_SAI_RX_DMA_CHANNEL_PRIORITY (2U)
+/* Local buffer refill by the CPU, 1 to copy by SDMA memory to memory instead */
+#ifndef APP_SRTM_LOCAL_BUF_DMA_COPY
+#define APP_SRTM_LOCAL_BUF_DMA_COPY (0)
+#endif
+#define APP_SAI_TX_COPY_DMA_CHANNEL (2U)
+/* Lower than the SAI channels, the copy must not delay the SAI FIFO service */
+#define APP_SAI_TX_COPY_DMA_CHANNEL_PRIORITY (1U)
+/* Period of the local buffer copy statistics print, when SRTM_SAI_SDMA_COPY_STATS is enabled */
+#define APP_COPY_STATS_TIMER_PERIOD_MS (10000U)
 /* Define the timeout ms to polling the CA7 link up status */
 #define APP_LINKUP_TIMER_PERIOD_MS (10U)
 
@@ -26,6 +26,17 @@
 #define SRTM_DEBUG_COMMUNICATION (0)
 #endif
 
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+#if !defined(RL_API_HAS_ZEROCOPY) || (RL_API_HAS_ZEROCOPY == 0)
+#error "SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY needs the RPMsg zero-copy API"
+#endif
+/* The dispatcher holds up to SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER RPMsg buffers, the other half of the vring is
+   left for the received data of the other endpoints and for the data coming while the dispatcher is busy */
+#if SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER > (RL_BUFFER_COUNT / 2)
+#error "SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER must not exceed half of RL_BUFFER_COUNT with zero-copy receive"
+#endif
+#endif
+
 typedef struct _srtm_rpmsg_endpoint
 {
     struct _srtm_channel channel;
@@ -79,8 +90,17 @@ static int SRTM_RPMsgEndpoint_RxHandler(void *payload, int payload_len, unsigned
         assert(handle->channel.core);
         assert(handle->channel.core->dispatcher);
 
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+        /* The buffer is released in SRTM_RPMsgEndpoint_ReleaseData() once the message is processed */
+        if (SRTM_Dispatcher_PostRecvData(handle->channel.core->dispatcher, &handle->channel,
+                                         payload, payload_len) == SRTM_Status_Success)
+        {
+            return RL_HOLD;
+        }
+#else
         SRTM_Dispatcher_PostRecvData(handle->channel.core->dispatcher, &handle->channel,
                                      payload, payload_len);
+#endif
     }
     else
     {
@@ -158,6 +178,21 @@ static srtm_status_t SRTM_RPMsgEndpoint_SendData(srtm_channel_t channel, void *d
     return status;
 }
 
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+static void SRTM_RPMsgEndpoint_ReleaseData(srtm_channel_t channel, void *data)
+{
+    srtm_rpmsg_endpoint_t handle = (srtm_rpmsg_endpoint_t)channel;
+
+    assert(handle);
+    assert(handle->config.rpmsgHandle);
+
+    if (rpmsg_lite_release_rx_buffer(handle->config.rpmsgHandle, data) != RL_SUCCESS)
+    {
+        SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_ERROR, "%s: RPMsg release failed\r\n", __func__);
+    }
+}
+#endif
+
 srtm_channel_t SRTM_RPMsgEndpoint_Create(srtm_rpmsg_endpoint_config_t *config)
 {
     srtm_rpmsg_endpoint_t handle;
@@ -189,6 +224,12 @@ srtm_channel_t SRTM_RPMsgEndpoint_Create(srtm_rpmsg_endpoint_config_t *config)
     handle->channel.start = SRTM_RPMsgEndpoint_Start;
     handle->channel.stop = SRTM_RPMsgEndpoint_Stop;
     handle->channel.sendData = SRTM_RPMsgEndpoint_SendData;
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+    handle->channel.releaseData = SRTM_RPMsgEndpoint_ReleaseData;
+#else
+    /* Received data is copied and released by the RX handler */
+    handle->channel.releaseData = NULL;
+#endif
 
     if (config->epName)
     {
@@ -34,6 +34,16 @@
 #define SRTM_AUDIO_SERVICE_CONFIG_PROC_NUMBER (4U)
 #endif
 
+/* Periods done per period done notification, 1 to notify every period. */
+#ifndef SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_COALESCE
+#define SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_COALESCE (1U)
+#endif
+
+/* Longest time a period done notification can be delayed by the coalescing, 0 for no limit. */
+#ifndef SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_MAX_LATENCY_MS
+#define SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_MAX_LATENCY_MS (0U)
+#endif
+
 typedef enum
 {
     SRTM_AudioDirRx = 0,
@@ -185,6 +195,23 @@ srtm_status_t SRTM_AudioService_SetAudioInterface(srtm_service_t service,
                                                   srtm_sai_adapter_t sai,
                                                   srtm_codec_adapter_t codec);
 
+/*!
+ * @brief Set the coalescing of the period done notifications to the peer core, the default is
+ *        SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_COALESCE and SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_MAX_LATENCY_MS.
+ *
+ * One notification is sent every periods periods done, with the index of the latest one, so the peer core must
+ * take the period index from the notification instead of counting them. The number of periods is lowered for
+ * each stream so that no period done waits more than maxLatencyMs; the stream rate is computed from the
+ * parameters set by the peer core. Period done of a stream paced by the peer core period ready notifications,
+ * SRTM_AUDIO_NTF_TX_PERIOD_DONE for TX and SRTM_AUDIO_NTF_RX_PERIOD_DONE for RX, are not coalesced. The one held
+ * back is sent when the stream is paused. The setting applies to the streams whose buffer is set afterwards.
+ *
+ * @param service SRTM audio service.
+ * @param periods periods done per notification, 1 to notify every period.
+ * @param maxLatencyMs longest delay of a period done notification in ms, 0 for no limit.
+ */
+void SRTM_AudioService_SetPeriodDoneCoalescing(srtm_service_t service, uint32_t periods, uint32_t maxLatencyMs);
+
 #ifdef __cplusplus
 }
 #endif
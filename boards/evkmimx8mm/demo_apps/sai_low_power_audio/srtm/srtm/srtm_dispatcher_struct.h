@@ -40,6 +40,39 @@
 #define SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN         (256U)
 #endif
 
+/**
+* @brief SRTM dispatcher zero-copy receive.
+*
+* When set to 1, SRTM_Dispatcher_PostRecvData() does not copy the received
+* data: the RX message only references the channel buffer, which is given back
+* with SRTM_Channel_ReleaseData() once the message is processed. The RX
+* messages are then headers only, and SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN is
+* not used. The channel holds at most SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER
+* buffers at a time, further received data is dropped as when the RX messages
+* are used up.
+*/
+#ifndef SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+#define SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY           (0)
+#endif
+
+/**
+* @brief SRTM dispatcher message priority number.
+*
+* The messages to process are queued in one FIFO list per priority, and the
+* highest priority with messages queued is found with a CLZ instruction, so
+* queuing and getting a message take the same time with IRQ disabled whatever
+* the number of queued messages. Messages with priority higher than
+* SRTM_DISPATCHER_CONFIG_PRIO_NUM - 1 share the last list, in queuing order.
+* Maximum 32.
+*/
+#ifndef SRTM_DISPATCHER_CONFIG_PRIO_NUM
+#define SRTM_DISPATCHER_CONFIG_PRIO_NUM               (8U)
+#endif
+
+#if SRTM_DISPATCHER_CONFIG_PRIO_NUM > 32U
+#error "SRTM_DISPATCHER_CONFIG_PRIO_NUM must not be larger than 32"
+#endif
+
 /**
 * @brief SRTM dispatcher struct
 */
@@ -51,7 +84,9 @@ struct _srtm_dispatcher
     srtm_mutex_t mutex;      /*!< Mutex for multi-task protection */
 
     srtm_list_t freeRxMsgs;  /*!< Free Rx messages list to hold the callback Rx data */
-    srtm_list_t messageQ;    /*!< Message queue to hold the messages to process */
+    srtm_list_t messageQ[SRTM_DISPATCHER_CONFIG_PRIO_NUM]; /*!< Message queue per priority to hold the
+                                                                 messages to process */
+    uint32_t readyPrios;     /*!< Bitmap of the priorities with messages in messageQ */
     srtm_list_t waitingReqs; /*!< Message queue to hold the request waiting for the response */
 
     volatile bool stopReq;   /*!< SRTM dispatcher stop request flag */
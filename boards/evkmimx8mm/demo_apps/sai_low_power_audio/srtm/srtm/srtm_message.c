@@ -66,6 +66,9 @@ srtm_message_t SRTM_Message_Duplicate(srtm_message_t msg)
         {
             dup->data = dup + 1;
         }
+        /* The duplicate is a plain message, it is not recycled like the original one */
+        dup->free = NULL;
+        dup->freeParam = NULL;
         SRTM_List_Init(&dup->node);
     }
 
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2018 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _BOARD_H_
+#define _BOARD_H_
+#include "clock_config.h"
+#include "fsl_clock.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief The board name */
+#define BOARD_NAME "MIMX8MM-EVK"
+#define MANUFACTURER_NAME "NXP"
+#define BOARD_DOMAIN_ID (1)
+/* The UART to use for debug messages. */
+#define BOARD_DEBUG_UART_TYPE kSerialPort_Uart
+#define BOARD_DEBUG_UART_BAUDRATE 115200u
+#define BOARD_DEBUG_UART_BASEADDR UART4_BASE
+#define BOARD_DEBUG_UART_INSTANCE 4U
+#define BOARD_DEBUG_UART_CLK_FREQ                                                           \
+    CLOCK_GetPllFreq(kCLOCK_SystemPll1Ctrl) / (CLOCK_GetRootPreDivider(kCLOCK_RootUart4)) / \
+        (CLOCK_GetRootPostDivider(kCLOCK_RootUart4)) / 10
+#define BOARD_UART_IRQ UART4_IRQn
+#define BOARD_UART_IRQ_HANDLER UART4_IRQHandler
+
+#define BOARD_GPC_BASEADDR GPC
+#define BOARD_MU_IRQ_NUM MU_M4_IRQn
+/* rpmsg shared memory, mapped cacheable by BOARD_InitMemory() with RL_USE_CACHED_SHMEM */
+#define BOARD_RPMSG_SHMEM_BASE (0xB8000000U)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+void BOARD_InitDebugConsole(void);
+void BOARD_InitMemory(void);
+void BOARD_RdcInit(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _BOARD_H_ */
@@ -0,0 +1,1053 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* System includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "block_pool.h"
+
+/* Audio PCM kernels of the sai_low_power_audio demo */
+#include "srtm_audio_pcm.h"
+
+/* Freescale includes. */
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+
+#include "rpmsg_lite.h"
+#include "rpmsg_queue.h"
+#include "rpmsg_ns.h"
+
+#include "pin_mux.h"
+#include "clock_config.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Measured samples per benchmark, and samples dropped before measuring */
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES (1000U)
+#endif
+#define BENCH_WARMUP (16U)
+
+/* Interrupt pended by software to measure ISR to task paths, not used by the demo otherwise */
+#define BENCH_SWI_IRQn GPT6_IRQn
+#define BENCH_SWI_IRQHandler GPT6_IRQHandler
+
+#define BENCH_TASK_STACK_SIZE (256U)
+#define BENCH_CONTROL_PRIORITY (tskIDLE_PRIORITY + 1U)
+#define BENCH_LOW_PRIORITY (tskIDLE_PRIORITY + 2U)
+#define BENCH_HIGH_PRIORITY (tskIDLE_PRIORITY + 3U)
+
+#define BENCH_EVENT_BIT (1U << 0)
+
+/* Block size of the allocator benchmarks */
+#define BENCH_BLOCK_SIZE (64U)
+#define BENCH_POOL_BLOCK_COUNT (8U)
+
+/* Largest number of active timers of the timer benchmarks */
+#define BENCH_TIMER_MAX_COUNT (1000U)
+
+/* Largest number of delayed tasks of the delay benchmarks, the sleepers only block once */
+#define BENCH_SLEEPER_MAX_COUNT (100U)
+#define BENCH_SLEEPER_STACK_SIZE (configMINIMAL_STACK_SIZE)
+
+/* Samples per call of the PCM kernel benchmarks, the mix block of the SAI SDMA adapter */
+#define BENCH_PCM_SAMPLES (128U)
+
+#define RPMSG_LITE_SHMEM_BASE (BOARD_RPMSG_SHMEM_BASE)
+#define RPMSG_LITE_LINK_ID (RL_PLATFORM_IMX8MM_M4_USER_LINK_ID)
+/* The report can also be served on a second link, the second vdev of the Linux side (vdev-nums = <2>) */
+#ifndef BENCH_RPMSG_SECOND_LINK
+#define BENCH_RPMSG_SECOND_LINK (0)
+#endif
+#define RPMSG_LITE_SECOND_SHMEM_BASE (0xB8010000U)
+#define RPMSG_LITE_SECOND_LINK_ID (RL_PLATFORM_IMX8MM_M4_USER_LINK_ID + 1)
+#define RPMSG_LITE_NS_ANNOUNCE_STRING "rpmsg-virtual-tty-channel-1"
+#ifndef LOCAL_EPT_ADDR
+#define LOCAL_EPT_ADDR (30)
+#endif
+/* Second tty endpoint of link 0, a Linux process echoes everything written to it */
+#define BENCH_ECHO_EPT_ADDR (LOCAL_EPT_ADDR + 1)
+
+#define BENCH_LINE_SIZE (96U)
+
+/* Message sizes of the rpmsg round trip benchmarks */
+#define BENCH_RPMSG_SMALL_SIZE (16U)
+#define BENCH_RPMSG_LARGE_SIZE (RL_BUFFER_PAYLOAD_SIZE)
+#define BENCH_RPMSG_COUNT (2U)
+
+typedef enum _bench_isr_mode
+{
+    kBENCH_IsrEntry = 0U, /* handler records the time itself */
+    kBENCH_IsrPool,       /* handler records the time of a block pool alloc+free */
+    kBENCH_IsrQueue,
+    kBENCH_IsrNotify,
+    kBENCH_IsrSemaphore,
+    kBENCH_IsrEventGroup,
+} bench_isr_mode_t;
+
+typedef enum _bench_pcm_kernel
+{
+    kBENCH_PcmS16ToS32 = 0U,
+    kBENCH_PcmS32ToS16,
+    kBENCH_PcmS24ToS16,
+    kBENCH_PcmInterleave,
+    kBENCH_PcmDeinterleave,
+    kBENCH_PcmGainS16,
+    kBENCH_PcmGainS32,
+    kBENCH_PcmMix2Unity,
+    kBENCH_PcmMix4,
+} bench_pcm_kernel_t;
+
+typedef struct _bench_result
+{
+    const char *name;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t p99;
+    uint32_t max;
+} bench_result_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void bench_context_switch(bench_result_t *result);
+static void bench_context_switch_fpu(bench_result_t *result);
+static void bench_isr_entry(bench_result_t *result);
+static void bench_isr_queue(bench_result_t *result);
+static void bench_isr_notify(bench_result_t *result);
+static void bench_isr_semaphore(bench_result_t *result);
+static void bench_isr_event_group(bench_result_t *result);
+static void bench_mutex_inherit(bench_result_t *result);
+static void bench_mutex_disinherit(bench_result_t *result);
+static void bench_pool_alloc_free(bench_result_t *result);
+static void bench_pool_alloc_free_isr(bench_result_t *result);
+static void bench_heap_malloc_free(bench_result_t *result);
+static void bench_timer_reset_10(bench_result_t *result);
+static void bench_timer_reset_100(bench_result_t *result);
+static void bench_timer_reset_1000(bench_result_t *result);
+static void bench_delay_block_10(bench_result_t *result);
+static void bench_delay_block_100(bench_result_t *result);
+static void bench_pcm_s16_to_s32(bench_result_t *result);
+static void bench_pcm_s32_to_s16(bench_result_t *result);
+static void bench_pcm_s24_to_s16(bench_result_t *result);
+static void bench_pcm_interleave(bench_result_t *result);
+static void bench_pcm_deinterleave(bench_result_t *result);
+static void bench_pcm_gain_s16(bench_result_t *result);
+static void bench_pcm_gain_s32(bench_result_t *result);
+static void bench_pcm_mix_2_unity(bench_result_t *result);
+static void bench_pcm_mix_4(bench_result_t *result);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static void (*const benches[])(bench_result_t *result) = {
+    bench_context_switch, bench_context_switch_fpu, bench_isr_entry,       bench_isr_queue,        bench_isr_notify,
+    bench_isr_semaphore,  bench_isr_event_group,    bench_mutex_inherit, bench_mutex_disinherit,
+    bench_pool_alloc_free, bench_pool_alloc_free_isr, bench_heap_malloc_free,
+    bench_timer_reset_10, bench_timer_reset_100, bench_timer_reset_1000,
+    bench_delay_block_10, bench_delay_block_100,
+    bench_pcm_s16_to_s32, bench_pcm_s32_to_s16, bench_pcm_s24_to_s16, bench_pcm_interleave, bench_pcm_deinterleave,
+    bench_pcm_gain_s16, bench_pcm_gain_s32, bench_pcm_mix_2_unity, bench_pcm_mix_4,
+};
+
+#define BENCH_COUNT (sizeof(benches) / sizeof(benches[0]))
+
+static bench_result_t results[BENCH_COUNT];
+/* Measured once Linux echoes on the second tty, reported from then on */
+static bench_result_t rpmsg_results[BENCH_RPMSG_COUNT];
+static volatile bool rpmsg_results_done;
+static uint32_t samples[BENCH_SAMPLES];
+static volatile uint32_t sample_index;
+static volatile uint32_t start_cycles;
+static volatile bool use_fpu;
+static volatile bool record_disinherit;
+static volatile bench_isr_mode_t isr_mode;
+
+static TaskHandle_t control_task_handle;
+static TaskHandle_t high_task_handle;
+static QueueHandle_t bench_queue;
+static SemaphoreHandle_t bench_sem;
+static EventGroupHandle_t bench_event;
+static BlockPoolHandle_t bench_pool;
+static TimerHandle_t bench_timers[BENCH_TIMER_MAX_COUNT];
+static TaskHandle_t bench_sleepers[BENCH_SLEEPER_MAX_COUNT];
+
+static char line_buf[BENCH_LINE_SIZE];
+static uint8_t rpmsg_tx_buf[BENCH_RPMSG_LARGE_SIZE];
+static uint8_t rpmsg_rx_buf[BENCH_RPMSG_LARGE_SIZE];
+/* Input of the PCM kernels: BENCH_PCM_SAMPLES S32 samples, or four streams of S16 samples */
+static uint32_t pcm_src[BENCH_PCM_SAMPLES * 2U];
+static uint32_t pcm_dst[BENCH_PCM_SAMPLES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static inline uint32_t bench_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/* Stores one sample, the first BENCH_WARMUP samples are dropped */
+static inline void bench_record(uint32_t cycles)
+{
+    if (sample_index >= BENCH_WARMUP)
+    {
+        samples[sample_index - BENCH_WARMUP] = cycles;
+    }
+    sample_index++;
+}
+
+static inline bool bench_done(void)
+{
+    return (sample_index >= (BENCH_WARMUP + BENCH_SAMPLES));
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void bench_summarize(bench_result_t *result, const char *name)
+{
+    uint64_t sum = 0U;
+    uint32_t i;
+
+    qsort(samples, BENCH_SAMPLES, sizeof(samples[0]), bench_compare);
+    for (i = 0U; i < BENCH_SAMPLES; i++)
+    {
+        sum += samples[i];
+    }
+
+    result->name = name;
+    result->min = samples[0];
+    result->avg = (uint32_t)(sum / BENCH_SAMPLES);
+    result->p99 = samples[(BENCH_SAMPLES * 99U) / 100U];
+    result->max = samples[BENCH_SAMPLES - 1U];
+}
+
+static const char *bench_code_region(void)
+{
+    uint32_t addr = (uint32_t)bench_summarize;
+
+    if ((addr >= 0x1FFE0000U) && (addr < 0x20020000U))
+    {
+        return "TCM";
+    }
+    else if ((addr >= 0x08000000U) && (addr < 0x10000000U))
+    {
+        return "QSPI";
+    }
+    else if (addr >= 0x40000000U)
+    {
+        return "DDR";
+    }
+    return "OCRAM";
+}
+
+static const char *bench_optimization(void)
+{
+#if defined(__OPTIMIZE_SIZE__)
+    return "-Os";
+#elif defined(__OPTIMIZE__)
+    return "-O1+";
+#else
+    return "-O0";
+#endif
+}
+
+/*!
+ * @brief Formats line n of the report, returns false past the last line.
+ *
+ * The report only depends on the build and the measured values, so reports of
+ * different builds can be compared line by line.
+ */
+static bool bench_format_line(uint32_t n, char *buf, size_t size)
+{
+    bench_result_t *r;
+
+    switch (n)
+    {
+        case 0U:
+            snprintf(buf, size, "# freertos_latency_bench %s, cycles, %u samples\r\n", tskKERNEL_VERSION_NUMBER,
+                     (unsigned)BENCH_SAMPLES);
+            return true;
+        case 1U:
+            snprintf(buf, size,
+                     "# core_clock %u code %s opt_task_select %u timer_wheel %u delay_wheel %u event_direct %u\r\n",
+                     (unsigned)SystemCoreClock, bench_code_region(), (unsigned)configUSE_PORT_OPTIMISED_TASK_SELECTION,
+                     (unsigned)configUSE_TIMER_WHEEL, (unsigned)configUSE_DELAYED_TASK_WHEEL,
+                     (unsigned)configUSE_EVENT_GROUP_DIRECT_ISR);
+            return true;
+        case 2U:
+            snprintf(buf, size, "# compiler %s %s\r\n", __VERSION__, bench_optimization());
+            return true;
+        case 3U:
+            snprintf(buf, size, "# rpmsg cached_shmem %u payload %u\r\n", (unsigned)RL_USE_CACHED_SHMEM,
+                     (unsigned)RL_BUFFER_PAYLOAD_SIZE);
+            return true;
+        case 4U:
+            snprintf(buf, size, "# pcm simd %u block %u samples\r\n", (unsigned)SRTM_AUDIO_PCM_USE_SIMD,
+                     (unsigned)BENCH_PCM_SAMPLES);
+            return true;
+        case 5U:
+            snprintf(buf, size, "%-26s %8s %8s %8s %8s\r\n", "benchmark", "min", "avg", "p99", "max");
+            return true;
+        default:
+            break;
+    }
+
+    n -= 6U;
+    if (n < BENCH_COUNT)
+    {
+        r = &results[n];
+    }
+    else if (rpmsg_results_done && ((n - BENCH_COUNT) < BENCH_RPMSG_COUNT))
+    {
+        r = &rpmsg_results[n - BENCH_COUNT];
+    }
+    else
+    {
+        return false;
+    }
+
+    snprintf(buf, size, "%-26s %8u %8u %8u %8u\r\n", r->name, (unsigned)r->min, (unsigned)r->avg, (unsigned)r->p99,
+             (unsigned)r->max);
+    return true;
+}
+
+/* Partner of the context switch benchmarks, measures the switch into itself */
+static void yield_task(void *pvParameters)
+{
+    volatile float fpu_work = 1.0f;
+
+    for (;;)
+    {
+        bench_record(bench_cycles() - start_cycles);
+        if (use_fpu)
+        {
+            /* Any FPU instruction makes the task switch save the FPU context */
+            fpu_work = fpu_work * 1.0001f;
+        }
+        taskYIELD();
+    }
+}
+
+static void bench_run_context_switch(bench_result_t *result, bool fpu, const char *name)
+{
+    volatile float fpu_work = 1.0f;
+    TaskHandle_t partner;
+
+    use_fpu = fpu;
+    sample_index = 0U;
+
+    /* Same priority as this task, every yield switches to the other task */
+    xTaskCreate(yield_task, "yield", BENCH_TASK_STACK_SIZE, NULL, BENCH_CONTROL_PRIORITY, &partner);
+
+    while (!bench_done())
+    {
+        if (fpu)
+        {
+            fpu_work = fpu_work * 1.0001f;
+        }
+        start_cycles = bench_cycles();
+        taskYIELD();
+    }
+
+    vTaskDelete(partner);
+    bench_summarize(result, name);
+}
+
+static void bench_context_switch(bench_result_t *result)
+{
+    bench_run_context_switch(result, false, "context_switch");
+}
+
+static void bench_context_switch_fpu(bench_result_t *result)
+{
+    bench_run_context_switch(result, true, "context_switch_fpu");
+}
+
+void BENCH_SWI_IRQHandler(void)
+{
+    BaseType_t woken = pdFALSE;
+    uint32_t value = 0U;
+    uint32_t cycles;
+
+    switch (isr_mode)
+    {
+        case kBENCH_IsrEntry:
+            bench_record(bench_cycles() - start_cycles);
+            break;
+        case kBENCH_IsrPool:
+            cycles = bench_cycles();
+            vBlockPoolFree(bench_pool, pvBlockPoolAlloc(bench_pool));
+            bench_record(bench_cycles() - cycles);
+            break;
+        case kBENCH_IsrQueue:
+            xQueueSendFromISR(bench_queue, &value, &woken);
+            break;
+        case kBENCH_IsrNotify:
+            vTaskNotifyGiveFromISR(high_task_handle, &woken);
+            break;
+        case kBENCH_IsrSemaphore:
+            xSemaphoreGiveFromISR(bench_sem, &woken);
+            break;
+        case kBENCH_IsrEventGroup:
+            xEventGroupSetBitsFromISR(bench_event, BENCH_EVENT_BIT, &woken);
+            break;
+        default:
+            break;
+    }
+    portYIELD_FROM_ISR(woken);
+/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+  exception return operation might vector to incorrect interrupt */
+#if defined __CORTEX_M && (__CORTEX_M == 4U)
+    __DSB();
+#endif
+}
+
+/* Woken by the software interrupt, measures from pending the IRQ until it runs */
+static void isr_wait_task(void *pvParameters)
+{
+    uint32_t value;
+
+    for (;;)
+    {
+        switch (isr_mode)
+        {
+            case kBENCH_IsrQueue:
+                xQueueReceive(bench_queue, &value, portMAX_DELAY);
+                break;
+            case kBENCH_IsrNotify:
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                break;
+            case kBENCH_IsrSemaphore:
+                xSemaphoreTake(bench_sem, portMAX_DELAY);
+                break;
+            case kBENCH_IsrEventGroup:
+                xEventGroupWaitBits(bench_event, BENCH_EVENT_BIT, pdTRUE, pdTRUE, portMAX_DELAY);
+                break;
+            default:
+                vTaskSuspend(NULL);
+                break;
+        }
+        bench_record(bench_cycles() - start_cycles);
+    }
+}
+
+static void bench_run_isr(bench_result_t *result, bench_isr_mode_t mode, const char *name)
+{
+    isr_mode = mode;
+    sample_index = 0U;
+
+    high_task_handle = NULL;
+    if ((mode != kBENCH_IsrEntry) && (mode != kBENCH_IsrPool))
+    {
+        /* Blocks right away, before the first interrupt */
+        xTaskCreate(isr_wait_task, "isr_wait", BENCH_TASK_STACK_SIZE, NULL, BENCH_HIGH_PRIORITY, &high_task_handle);
+    }
+
+    while (!bench_done())
+    {
+        start_cycles = bench_cycles();
+        NVIC_SetPendingIRQ(BENCH_SWI_IRQn);
+        /* The interrupt and the woken task both run before this task continues */
+        __DSB();
+        __ISB();
+    }
+
+    if (high_task_handle)
+    {
+        vTaskDelete(high_task_handle);
+        high_task_handle = NULL;
+    }
+    bench_summarize(result, name);
+}
+
+static void bench_isr_entry(bench_result_t *result)
+{
+    bench_run_isr(result, kBENCH_IsrEntry, "isr_entry");
+}
+
+static void bench_isr_queue(bench_result_t *result)
+{
+    bench_queue = xQueueCreate(1U, sizeof(uint32_t));
+    bench_run_isr(result, kBENCH_IsrQueue, "isr_queue_send_wakeup");
+    vQueueDelete(bench_queue);
+}
+
+static void bench_isr_notify(bench_result_t *result)
+{
+    bench_run_isr(result, kBENCH_IsrNotify, "isr_notify_give_wakeup");
+}
+
+static void bench_isr_semaphore(bench_result_t *result)
+{
+    bench_sem = xSemaphoreCreateBinary();
+    bench_run_isr(result, kBENCH_IsrSemaphore, "isr_sem_give_wakeup");
+    vSemaphoreDelete(bench_sem);
+}
+
+static void bench_isr_event_group(bench_result_t *result)
+{
+    /* The bits are set by the ISR itself, or by the timer service task with configUSE_EVENT_GROUP_DIRECT_ISR 0 */
+    bench_event = xEventGroupCreate();
+    bench_run_isr(result, kBENCH_IsrEventGroup, "isr_event_set_wakeup");
+    vEventGroupDelete(bench_event);
+}
+
+/* High priority side of the mutex benchmarks, blocks on the mutex held by the low task */
+static void mutex_high_task(void *pvParameters)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        start_cycles = bench_cycles();
+        xSemaphoreTake(bench_sem, portMAX_DELAY);
+        if (record_disinherit)
+        {
+            bench_record(bench_cycles() - start_cycles);
+        }
+        xSemaphoreGive(bench_sem);
+    }
+}
+
+/* Low priority side, holds the mutex and inherits the priority of the high task */
+static void mutex_low_task(void *pvParameters)
+{
+    while (!bench_done())
+    {
+        xSemaphoreTake(bench_sem, portMAX_DELAY);
+        /* The high task runs, blocks on the mutex and raises the priority of this task */
+        xTaskNotifyGive(high_task_handle);
+        if (!record_disinherit)
+        {
+            bench_record(bench_cycles() - start_cycles);
+        }
+        start_cycles = bench_cycles();
+        /* Drops the inherited priority and switches to the high task */
+        xSemaphoreGive(bench_sem);
+    }
+
+    xTaskNotifyGive(control_task_handle);
+    vTaskSuspend(NULL);
+}
+
+static void bench_run_mutex(bench_result_t *result, bool disinherit, const char *name)
+{
+    TaskHandle_t low_task;
+
+    record_disinherit = disinherit;
+    sample_index = 0U;
+    bench_sem = xSemaphoreCreateMutex();
+
+    xTaskCreate(mutex_high_task, "mtx_high", BENCH_TASK_STACK_SIZE, NULL, BENCH_HIGH_PRIORITY, &high_task_handle);
+    xTaskCreate(mutex_low_task, "mtx_low", BENCH_TASK_STACK_SIZE, NULL, BENCH_LOW_PRIORITY, &low_task);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    vTaskDelete(low_task);
+    vTaskDelete(high_task_handle);
+    high_task_handle = NULL;
+    vSemaphoreDelete(bench_sem);
+    bench_summarize(result, name);
+}
+
+static void bench_mutex_inherit(bench_result_t *result)
+{
+    bench_run_mutex(result, false, "mutex_take_inherit");
+}
+
+static void bench_mutex_disinherit(bench_result_t *result)
+{
+    bench_run_mutex(result, true, "mutex_give_disinherit");
+}
+
+static void bench_pool_alloc_free(bench_result_t *result)
+{
+    uint32_t cycles;
+
+    bench_pool = xBlockPoolCreate(BENCH_BLOCK_SIZE, BENCH_POOL_BLOCK_COUNT);
+    sample_index = 0U;
+    while (!bench_done())
+    {
+        cycles = bench_cycles();
+        vBlockPoolFree(bench_pool, pvBlockPoolAlloc(bench_pool));
+        bench_record(bench_cycles() - cycles);
+    }
+    vBlockPoolDelete(bench_pool);
+    bench_summarize(result, "pool_alloc_free");
+}
+
+static void bench_pool_alloc_free_isr(bench_result_t *result)
+{
+    bench_pool = xBlockPoolCreate(BENCH_BLOCK_SIZE, BENCH_POOL_BLOCK_COUNT);
+    bench_run_isr(result, kBENCH_IsrPool, "pool_alloc_free_isr");
+    vBlockPoolDelete(bench_pool);
+}
+
+/* heap_4 for comparison, it cannot be called from an ISR */
+static void bench_heap_malloc_free(bench_result_t *result)
+{
+    uint32_t cycles;
+
+    sample_index = 0U;
+    while (!bench_done())
+    {
+        cycles = bench_cycles();
+        vPortFree(pvPortMalloc(BENCH_BLOCK_SIZE));
+        bench_record(bench_cycles() - cycles);
+    }
+    bench_summarize(result, "heap4_malloc_free");
+}
+
+static void bench_timer_callback(TimerHandle_t timer)
+{
+}
+
+/*!
+ * @brief Measures xTimerReset() with count active timers.
+ *
+ * The timer service task has the highest priority, so the call includes
+ * sending the command, switching to the service task, moving the timer in the
+ * active timers and switching back.
+ */
+static void bench_run_timer_reset(bench_result_t *result, uint32_t count, const char *name)
+{
+    uint32_t cycles;
+    uint32_t n;
+
+    for (n = 0U; n < count; n++)
+    {
+        /* 10 to 60 s, no timer expires during the benchmark */
+        bench_timers[n] = xTimerCreate("bench", pdMS_TO_TICKS(10000U + (n * 7919U) % 50000U), pdFALSE, NULL,
+                                       bench_timer_callback);
+        xTimerStart(bench_timers[n], portMAX_DELAY);
+    }
+
+    sample_index = 0U;
+    n = 0U;
+    while (!bench_done())
+    {
+        cycles = bench_cycles();
+        xTimerReset(bench_timers[n], portMAX_DELAY);
+        bench_record(bench_cycles() - cycles);
+        n = (n + 7U) % count;
+    }
+
+    for (n = 0U; n < count; n++)
+    {
+        xTimerDelete(bench_timers[n], portMAX_DELAY);
+    }
+    bench_summarize(result, name);
+}
+
+static void bench_timer_reset_10(bench_result_t *result)
+{
+    bench_run_timer_reset(result, 10U, "timer_reset_10");
+}
+
+static void bench_timer_reset_100(bench_result_t *result)
+{
+    bench_run_timer_reset(result, 100U, "timer_reset_100");
+}
+
+static void bench_timer_reset_1000(bench_result_t *result)
+{
+    bench_run_timer_reset(result, 1000U, "timer_reset_1000");
+}
+
+static void sleeper_task(void *pvParameters)
+{
+    for (;;)
+    {
+        vTaskDelay((TickType_t)(uint32_t)pvParameters);
+    }
+}
+
+/* Blocks with a timeout among the sleepers each time the control task notifies it */
+static void delay_probe_task(void *pvParameters)
+{
+    uint32_t n = 0U;
+
+    for (;;)
+    {
+        start_cycles = bench_cycles();
+        /* Longer than the delay of every sleeper, the sorted delayed list is walked to its end */
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(70000U + (n * 7919U) % 10000U));
+        n++;
+    }
+}
+
+/*!
+ * @brief Measures blocking with a timeout with count delayed tasks.
+ *
+ * The time runs from the probe task calling ulTaskNotifyTake() until the
+ * control task runs again, so it includes inserting the probe task in the
+ * delayed tasks and one context switch.
+ */
+static void bench_run_delay_block(bench_result_t *result, uint32_t count, const char *name)
+{
+    uint32_t n;
+
+    for (n = 0U; n < count; n++)
+    {
+        /* 10 to 60 s, no sleeper wakes during the benchmark */
+        xTaskCreate(sleeper_task, "sleep", BENCH_SLEEPER_STACK_SIZE,
+                    (void *)pdMS_TO_TICKS(10000U + (n * 7919U) % 50000U), BENCH_LOW_PRIORITY, &bench_sleepers[n]);
+    }
+
+    /* Blocks right away, the sleepers have all blocked before */
+    xTaskCreate(delay_probe_task, "probe", BENCH_TASK_STACK_SIZE, NULL, BENCH_HIGH_PRIORITY, &high_task_handle);
+
+    sample_index = 0U;
+    while (!bench_done())
+    {
+        xTaskNotifyGive(high_task_handle);
+        bench_record(bench_cycles() - start_cycles);
+    }
+
+    vTaskDelete(high_task_handle);
+    high_task_handle = NULL;
+    for (n = 0U; n < count; n++)
+    {
+        vTaskDelete(bench_sleepers[n]);
+    }
+    bench_summarize(result, name);
+}
+
+static void bench_delay_block_10(bench_result_t *result)
+{
+    bench_run_delay_block(result, 10U, "delay_block_10");
+}
+
+static void bench_delay_block_100(bench_result_t *result)
+{
+    bench_run_delay_block(result, 100U, "delay_block_100");
+}
+
+/* Runs a PCM kernel on BENCH_PCM_SAMPLES samples of pcm_src into pcm_dst */
+static void bench_pcm_call(bench_pcm_kernel_t kernel)
+{
+    const uint32_t n = BENCH_PCM_SAMPLES;
+    const int16_t *src = (const int16_t *)pcm_src;
+    const void *planes[2] = {src, src + n / 2U};
+    void *dst_planes[2] = {pcm_dst, (int16_t *)pcm_dst + n / 2U};
+    const int16_t *streams[4] = {src, src + n, src + 2U * n, src + 3U * n};
+    static const int16_t unity[2] = {SRTM_AUDIO_PCM_GAIN_UNITY, SRTM_AUDIO_PCM_GAIN_UNITY};
+    static const int16_t gains[4] = {0x4000, 0x2000, 0x3000, 0x1000};
+
+    switch (kernel)
+    {
+        case kBENCH_PcmS16ToS32:
+            SRTM_AudioPcm_Convert(pcm_dst, SRTM_AudioPcmS32, pcm_src, SRTM_AudioPcmS16, n);
+            break;
+        case kBENCH_PcmS32ToS16:
+            SRTM_AudioPcm_Convert(pcm_dst, SRTM_AudioPcmS16, pcm_src, SRTM_AudioPcmS32, n);
+            break;
+        case kBENCH_PcmS24ToS16:
+            SRTM_AudioPcm_Convert(pcm_dst, SRTM_AudioPcmS16, pcm_src, SRTM_AudioPcmS24, n);
+            break;
+        case kBENCH_PcmInterleave:
+            SRTM_AudioPcm_Interleave(pcm_dst, planes, 2U, n / 2U, SRTM_AudioPcmS16);
+            break;
+        case kBENCH_PcmDeinterleave:
+            SRTM_AudioPcm_Deinterleave(dst_planes, pcm_src, 2U, n / 2U, SRTM_AudioPcmS16);
+            break;
+        case kBENCH_PcmGainS16:
+            SRTM_AudioPcm_Gain(pcm_dst, pcm_src, SRTM_AudioPcmS16, n, 0x3000);
+            break;
+        case kBENCH_PcmGainS32:
+            SRTM_AudioPcm_Gain(pcm_dst, pcm_src, SRTM_AudioPcmS32, n, 0x3000);
+            break;
+        case kBENCH_PcmMix2Unity:
+            SRTM_AudioPcm_Mix(pcm_dst, SRTM_AudioPcmS16, streams, unity, 2U, n);
+            break;
+        default:
+            SRTM_AudioPcm_Mix(pcm_dst, SRTM_AudioPcmS16, streams, gains, 4U, n);
+            break;
+    }
+}
+
+/*!
+ * @brief Measures one call of a PCM kernel on BENCH_PCM_SAMPLES samples.
+ *
+ * Divide by BENCH_PCM_SAMPLES for the cycles per sample. The S16 kernels
+ * process two samples per instruction when SRTM_AUDIO_PCM_USE_SIMD is 1.
+ */
+static void bench_run_pcm(bench_result_t *result, bench_pcm_kernel_t kernel, const char *name)
+{
+    uint32_t cycles;
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(pcm_src); i++)
+    {
+        pcm_src[i] = i * 0x9E3779B9U;
+    }
+
+    sample_index = 0U;
+    while (!bench_done())
+    {
+        cycles = bench_cycles();
+        bench_pcm_call(kernel);
+        bench_record(bench_cycles() - cycles);
+    }
+    bench_summarize(result, name);
+}
+
+static void bench_pcm_s16_to_s32(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmS16ToS32, "pcm_s16_to_s32");
+}
+
+static void bench_pcm_s32_to_s16(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmS32ToS16, "pcm_s32_to_s16");
+}
+
+static void bench_pcm_s24_to_s16(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmS24ToS16, "pcm_s24_to_s16");
+}
+
+static void bench_pcm_interleave(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmInterleave, "pcm_interleave_s16");
+}
+
+static void bench_pcm_deinterleave(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmDeinterleave, "pcm_deinterleave_s16");
+}
+
+static void bench_pcm_gain_s16(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmGainS16, "pcm_gain_s16");
+}
+
+static void bench_pcm_gain_s32(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmGainS32, "pcm_gain_s32");
+}
+
+static void bench_pcm_mix_2_unity(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmMix2Unity, "pcm_mix_2_unity_s16");
+}
+
+static void bench_pcm_mix_4(bench_result_t *result)
+{
+    bench_run_pcm(result, kBENCH_PcmMix4, "pcm_mix_4_s16");
+}
+
+/*!
+ * @brief Measures sending size bytes to the Linux echo and receiving them back.
+ *
+ * The time runs from rpmsg_lite_send() until the last echoed byte is copied
+ * out of the rx buffer, so it includes the rpmsg-lite paths and the cache
+ * maintenance of both directions, the MU interrupts and the echo on Linux.
+ */
+static void bench_run_round_trip(bench_result_t *result, struct rpmsg_lite_instance *my_rpmsg,
+                                 struct rpmsg_lite_endpoint *my_ept, rpmsg_queue_handle my_queue,
+                                 unsigned long remote_addr, uint32_t size, const char *name)
+{
+    unsigned long src;
+    uint32_t cycles;
+    uint32_t received;
+    int len;
+
+    sample_index = 0U;
+    while (!bench_done())
+    {
+        memset(rpmsg_tx_buf, (int)sample_index, size);
+        cycles = bench_cycles();
+        rpmsg_lite_send(my_rpmsg, my_ept, remote_addr, (char *)rpmsg_tx_buf, size, RL_BLOCK);
+        /* The tty may split the echo in several messages */
+        for (received = 0U; received < size; received += (uint32_t)len)
+        {
+            rpmsg_queue_recv(my_rpmsg, my_queue, &src, (char *)rpmsg_rx_buf, sizeof(rpmsg_rx_buf), &len, RL_BLOCK);
+        }
+        bench_record(bench_cycles() - cycles);
+    }
+    bench_summarize(result, name);
+}
+
+/*!
+ * @brief Measures the round trips once the echo runs on Linux, then adds them to the report.
+ */
+static void bench_rpmsg_round_trip_task(void *pvParameters)
+{
+    struct rpmsg_lite_instance *my_rpmsg = (struct rpmsg_lite_instance *)pvParameters;
+    struct rpmsg_lite_endpoint *my_ept;
+    rpmsg_queue_handle my_queue;
+    unsigned long remote_addr;
+    uint32_t n;
+    int len;
+
+    my_queue = rpmsg_queue_create(my_rpmsg);
+    my_ept = rpmsg_lite_create_ept(my_rpmsg, BENCH_ECHO_EPT_ADDR, rpmsg_queue_rx_cb, my_queue);
+    rpmsg_ns_announce(my_rpmsg, my_ept, RPMSG_LITE_NS_ANNOUNCE_STRING, RL_NS_CREATE);
+
+    PRINTF("Nameservice sent for the echo tty %d, write to it once the echo runs to measure the round trips...\r\n",
+           BENCH_ECHO_EPT_ADDR);
+
+    /* The start message, the echo runs from now on */
+    rpmsg_queue_recv(my_rpmsg, my_queue, &remote_addr, (char *)rpmsg_rx_buf, sizeof(rpmsg_rx_buf), &len, RL_BLOCK);
+
+    bench_run_round_trip(&rpmsg_results[0], my_rpmsg, my_ept, my_queue, remote_addr, BENCH_RPMSG_SMALL_SIZE,
+                         "rpmsg_round_trip_16");
+    bench_run_round_trip(&rpmsg_results[1], my_rpmsg, my_ept, my_queue, remote_addr, BENCH_RPMSG_LARGE_SIZE,
+                         "rpmsg_round_trip_496");
+    rpmsg_results_done = true;
+
+    for (n = 0U; n < BENCH_RPMSG_COUNT; n++)
+    {
+        PRINTF("%-26s %8u %8u %8u %8u\r\n", rpmsg_results[n].name, (unsigned)rpmsg_results[n].min,
+               (unsigned)rpmsg_results[n].avg, (unsigned)rpmsg_results[n].p99, (unsigned)rpmsg_results[n].max);
+    }
+    vTaskSuspend(NULL);
+}
+
+/*!
+ * @brief Sends the report to every message received from the Linux side on the given link.
+ */
+static void bench_rpmsg_report(void *shmem_base, int link_id, char *line, uint32_t line_size)
+{
+    struct rpmsg_lite_instance *my_rpmsg;
+    struct rpmsg_lite_endpoint *my_ept;
+    rpmsg_queue_handle my_queue;
+    unsigned long remote_addr;
+    void *rx_buf;
+    uint32_t n;
+    int len;
+
+    my_rpmsg = rpmsg_lite_remote_init(shmem_base, link_id, RL_NO_FLAGS);
+    while (!rpmsg_lite_is_link_up(my_rpmsg))
+    {
+        vTaskDelay(1);
+    }
+
+    my_queue = rpmsg_queue_create(my_rpmsg);
+    my_ept = rpmsg_lite_create_ept(my_rpmsg, LOCAL_EPT_ADDR, rpmsg_queue_rx_cb, my_queue);
+    rpmsg_ns_announce(my_rpmsg, my_ept, RPMSG_LITE_NS_ANNOUNCE_STRING, RL_NS_CREATE);
+
+    PRINTF("\r\nNameservice sent on link %d, write to the RPMsg tty to get the report...\r\n", link_id);
+
+    if (link_id == RPMSG_LITE_LINK_ID)
+    {
+        if (xTaskCreate(bench_rpmsg_round_trip_task, "round_trip", BENCH_TASK_STACK_SIZE, my_rpmsg,
+                        BENCH_HIGH_PRIORITY, NULL) != pdPASS)
+        {
+            PRINTF("\r\nFailed to create the round trip task\r\n");
+        }
+    }
+
+    for (;;)
+    {
+        rpmsg_queue_recv_nocopy(my_rpmsg, my_queue, &remote_addr, (char **)&rx_buf, &len, RL_BLOCK);
+        rpmsg_queue_nocopy_free(my_rpmsg, rx_buf);
+
+        for (n = 0U; bench_format_line(n, line, line_size); n++)
+        {
+            rpmsg_lite_send(my_rpmsg, my_ept, remote_addr, line, strlen(line), RL_BLOCK);
+        }
+    }
+}
+
+#if BENCH_RPMSG_SECOND_LINK
+/*!
+ * @brief Serves the report on the second link, with its own line buffer.
+ */
+static void bench_rpmsg_second_link_task(void *pvParameters)
+{
+    static char second_line_buf[BENCH_LINE_SIZE];
+
+    bench_rpmsg_report((void *)RPMSG_LITE_SECOND_SHMEM_BASE, RPMSG_LITE_SECOND_LINK_ID, second_line_buf,
+                       sizeof(second_line_buf));
+}
+#endif
+
+/*!
+ * @brief Runs all benchmarks, prints the report and serves it over RPMsg.
+ */
+static void control_task(void *pvParameters)
+{
+    uint32_t n;
+
+    PRINTF("\r\nFreeRTOS latency benchmark, please wait...\r\n");
+
+    for (n = 0U; n < BENCH_COUNT; n++)
+    {
+        benches[n](&results[n]);
+        /* Let the idle task free the tasks deleted by the benchmark */
+        vTaskDelay(1);
+    }
+
+    for (n = 0U; bench_format_line(n, line_buf, sizeof(line_buf)); n++)
+    {
+        PRINTF("%s", line_buf);
+    }
+
+#if BENCH_RPMSG_SECOND_LINK
+    if (xTaskCreate(bench_rpmsg_second_link_task, "report_link1", BENCH_TASK_STACK_SIZE, NULL, BENCH_CONTROL_PRIORITY,
+                    NULL) != pdPASS)
+    {
+        PRINTF("\r\nFailed to create the second link task\r\n");
+    }
+#endif
+    bench_rpmsg_report((void *)RPMSG_LITE_SHMEM_BASE, RPMSG_LITE_LINK_ID, line_buf, sizeof(line_buf));
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    /* Initialize standard SDK demo application pins */
+    /* Board specific RDC settings */
+    BOARD_RdcInit();
+
+    BOARD_InitPins();
+    BOARD_BootClockRUN();
+    BOARD_InitDebugConsole();
+    BOARD_InitMemory();
+
+    /* Start the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* The software interrupt calls FromISR APIs */
+    NVIC_SetPriority(BENCH_SWI_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY);
+    NVIC_EnableIRQ(BENCH_SWI_IRQn);
+
+    if (xTaskCreate(control_task, "control", BENCH_TASK_STACK_SIZE * 2U, NULL, BENCH_CONTROL_PRIORITY,
+                    &control_task_handle) != pdPASS)
+    {
+        PRINTF("\r\nFailed to create control task\r\n");
+        while (1)
+            ;
+    }
+
+    vTaskStartScheduler();
+
+    PRINTF("Failed to start FreeRTOS on core0.\n");
+    while (1)
+        ;
+}
@@ -27,6 +27,7 @@ struct _srtm_channel
     srtm_status_t (*start)(srtm_channel_t channel);
     srtm_status_t (*stop)(srtm_channel_t channel);
     srtm_status_t (*sendData)(srtm_channel_t channel, void *data, uint32_t len);
+    void (*releaseData)(srtm_channel_t channel, void *data);
 };
 
 /*******************************************************************************
@@ -62,24 +62,37 @@ static void SRTM_DumpMessage(srtm_message_t msg)
 #endif
 }
 
+/* messageQ of a priority: the priorities from SRTM_DISPATCHER_CONFIG_PRIO_NUM - 1 up to 255, which the
+ * peer core may set in the packet head, are clamped to the last messageQ, see srtm_dispatcher.h */
+static uint32_t SRTM_Dispatcher_GetQueueIndex(uint8_t priority)
+{
+    if (priority >= SRTM_DISPATCHER_CONFIG_PRIO_NUM - 1U)
+    {
+        return SRTM_DISPATCHER_CONFIG_PRIO_NUM - 1U;
+    }
+
+    return priority;
+}
+
+/* Clear the ready bit of the messageQ when its last message is removed, called with IRQ disabled */
+static void SRTM_Dispatcher_UpdateReadyPrio(srtm_dispatcher_t disp, uint32_t index)
+{
+    if (SRTM_List_IsEmpty(&disp->messageQ[index]))
+    {
+        disp->readyPrios &= ~(1U << index);
+    }
+}
+
 static void SRTM_Dispatcher_InsertOrderedMessage(srtm_dispatcher_t disp, srtm_message_t msg)
 {
-    srtm_list_t *list;
-    srtm_message_t message;
+    uint32_t index = SRTM_Dispatcher_GetQueueIndex(msg->priority);
 
     SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_DEBUG, "%s\r\n", __func__);
 
     SRTM_DumpMessage(msg);
-    /* Insert message with priority order */
-    for (list = disp->messageQ.prev; list != &disp->messageQ; list = list->prev)
-    {
-        message = SRTM_LIST_OBJ(srtm_message_t, node, list);
-        if (message->priority >= msg->priority)
-        {
-            break;
-        }
-    }
-    SRTM_List_InsertAfter(list, &msg->node);
+    /* Insert message with priority order: after the messages of the same priority */
+    SRTM_List_AddTail(&disp->messageQ[index], &msg->node);
+    disp->readyPrios |= 1U << index;
 }
 
 /* Send message to messageQ from ISR or task context */
@@ -107,6 +120,8 @@ static srtm_status_t SRTM_Dispatcher_DequeueMessage(srtm_dispatcher_t disp, srtm
     if (!SRTM_List_IsEmpty(&msg->node))
     {
         SRTM_List_Remove(&msg->node);
+        /* The message might be the last one of its messageQ */
+        SRTM_Dispatcher_UpdateReadyPrio(disp, SRTM_Dispatcher_GetQueueIndex(msg->priority));
         status = SRTM_Status_Success;
     }
     EnableGlobalIRQ(primask);
@@ -118,14 +133,18 @@ static srtm_status_t SRTM_Dispatcher_DequeueMessage(srtm_dispatcher_t disp, srtm
 static srtm_message_t SRTM_Dispatcher_RecvMessage(srtm_dispatcher_t disp)
 {
     uint32_t primask;
+    uint32_t index;
     srtm_list_t *list;
     srtm_message_t message = NULL;
 
     primask = DisableGlobalIRQ();
-    if (!SRTM_List_IsEmpty(&disp->messageQ))
+    if (disp->readyPrios != 0U)
     {
-        list = disp->messageQ.next;
+        /* Highest priority with messages queued */
+        index = 31U - __CLZ(disp->readyPrios);
+        list = disp->messageQ[index].next;
         SRTM_List_Remove(list);
+        SRTM_Dispatcher_UpdateReadyPrio(disp, index);
         message = SRTM_LIST_OBJ(srtm_message_t, node, list);
     }
     EnableGlobalIRQ(primask);
@@ -190,6 +209,13 @@ static void SRTM_Dispatcher_RecycleMessage(srtm_message_t msg, void *param)
     uint32_t primask;
     srtm_dispatcher_t disp = (srtm_dispatcher_t)param;
 
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+    /* Give the received data back to the channel */
+    SRTM_Channel_ReleaseData(msg->channel, msg->data);
+    msg->data = NULL;
+    msg->dataLen = 0U;
+
+#endif
     /* Put RX message back to freeRxMsgs */
     primask = DisableGlobalIRQ();
     SRTM_List_AddTail(&disp->freeRxMsgs, &msg->node);
@@ -214,7 +240,11 @@ srtm_dispatcher_t SRTM_Dispatcher_Create(void)
     SRTM_List_Init(&disp->cores);
     SRTM_List_Init(&disp->services);
     SRTM_List_Init(&disp->freeRxMsgs);
-    SRTM_List_Init(&disp->messageQ);
+    for (i = 0; i < SRTM_DISPATCHER_CONFIG_PRIO_NUM; i++)
+    {
+        SRTM_List_Init(&disp->messageQ[i]);
+    }
+    disp->readyPrios = 0U;
     SRTM_List_Init(&disp->waitingReqs);
     disp->mutex = mutex;
     disp->stopReq = false;
@@ -225,7 +255,12 @@ srtm_dispatcher_t SRTM_Dispatcher_Create(void)
 
     for (i = 0; i < SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER; i++)
     {
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+        /* Data is referenced in channel buffer */
+        msg = SRTM_Message_Create(0U);
+#else
         msg = SRTM_Message_Create(SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN);
+#endif
         assert(msg);
         SRTM_Message_SetFreeFunc(msg, SRTM_Dispatcher_RecycleMessage, disp);
         SRTM_List_AddTail(&disp->freeRxMsgs, &msg->node);
@@ -247,7 +282,7 @@ void SRTM_Dispatcher_Destroy(srtm_dispatcher_t disp)
     SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_INFO, "%s\r\n", __func__);
 
     /* Before destroy, all the messages should be well handled */
-    assert(SRTM_List_IsEmpty(&disp->messageQ));
+    assert(disp->readyPrios == 0U);
     /* Before destroy, all the waiting request should responded */
     assert(SRTM_List_IsEmpty(&disp->waitingReqs));
 
@@ -390,6 +425,7 @@ srtm_status_t SRTM_Dispatcher_AddPeerCore(srtm_dispatcher_t disp, srtm_peercore_
 srtm_status_t SRTM_Dispatcher_RemovePeerCore(srtm_dispatcher_t disp, srtm_peercore_t core)
 {
     uint32_t primask;
+    uint32_t index;
     srtm_list_t listHead;
     srtm_list_t *list, *next;
     srtm_message_t message;
@@ -414,19 +450,23 @@ srtm_status_t SRTM_Dispatcher_RemovePeerCore(srtm_dispatcher_t disp, srtm_peerco
 
     /* Clean up all corresponding messages for the peer core */
     /* First clean up messages in messageQ */
-    primask = DisableGlobalIRQ();
-    for (list = disp->messageQ.next; list != &disp->messageQ; list = next)
+    for (index = 0; index < SRTM_DISPATCHER_CONFIG_PRIO_NUM; index++)
     {
-        next = list->next;
-        message = SRTM_LIST_OBJ(srtm_message_t, node, list);
-        if (message->channel && message->channel->core == core)
+        primask = DisableGlobalIRQ();
+        for (list = disp->messageQ[index].next; list != &disp->messageQ[index]; list = next)
         {
-            SRTM_List_Remove(list);
-            /* Add to temp list */
-            SRTM_List_AddTail(&listHead, list);
+            next = list->next;
+            message = SRTM_LIST_OBJ(srtm_message_t, node, list);
+            if (message->channel && message->channel->core == core)
+            {
+                SRTM_List_Remove(list);
+                /* Add to temp list */
+                SRTM_List_AddTail(&listHead, list);
+            }
         }
+        SRTM_Dispatcher_UpdateReadyPrio(disp, index);
+        EnableGlobalIRQ(primask);
     }
-    EnableGlobalIRQ(primask);
 
     /* Next clean up messages in waitingReqs */
     SRTM_Mutex_Lock(disp->mutex);
@@ -708,7 +748,11 @@ srtm_status_t SRTM_Dispatcher_PostRecvData(srtm_dispatcher_t disp, srtm_channel_
     assert(channel);
     assert(buf);
 
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+    if (len < sizeof(struct _srtm_packet_head))
+#else
     if (len < sizeof(struct _srtm_packet_head) || len > SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN)
+#endif
     {
         return SRTM_Status_InvalidParameter;
     }
@@ -728,7 +772,12 @@ srtm_status_t SRTM_Dispatcher_PostRecvData(srtm_dispatcher_t disp, srtm_channel_
     if (message)
     {
         message->direct = SRTM_MessageDirectRx;
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+        /* The channel keeps the buffer until the message is recycled */
+        message->data = buf;
+#else
         memcpy(message->data, buf, len);
+#endif
         message->dataLen = len;
         message->channel = channel;
         message->error = SRTM_Status_Success;
@@ -10,6 +10,7 @@
 #define __SRTM_LIST_H__
 
 #include <assert.h>
+#include <stdint.h>
 
 /*!
  * @addtogroup srtm
@@ -22,7 +23,7 @@
 /**
 * @brief Get SRTM list object structure pointer.
 */
-#define SRTM_LIST_OBJ(type, field, list) (type)((uint32_t)list - (uint32_t)(&((type)0)->field))
+#define SRTM_LIST_OBJ(type, field, list) (type)((uintptr_t)list - (uintptr_t)(&((type)0)->field))
 
 /**
 * @brief SRTM list fields
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of measured block/unblock round trips per delayed task count */
+#ifndef DELAY_BENCH_ROUNDS
+#define DELAY_BENCH_ROUNDS (2000U)
+#endif
+
+/* Long enough for no sleeper to wake during the benchmark */
+#define DELAY_BENCH_MIN_DELAY (60000U)
+#define DELAY_BENCH_MAX_DELAY (120000U)
+
+/* Time given to the new sleepers to block */
+#define DELAY_BENCH_SETTLE_TICKS (100U)
+
+/* The sleepers only block once, they do not need the default stack */
+#define DELAY_BENCH_SLEEPER_STACK (configMINIMAL_STACK_SIZE / 4U)
+
+#define DELAY_BENCH_SEED (0x12345678U)
+#define DELAY_BENCH_SLEEPER_PRIORITY (1U)
+#define DELAY_BENCH_CONTROL_PRIORITY (2U)
+#define DELAY_BENCH_PROBE_PRIORITY (3U)
+
+#if (configUSE_DELAYED_TASK_WHEEL == 1)
+#define DELAY_BENCH_NAME "delayed task wheel"
+#else
+#define DELAY_BENCH_NAME "sorted delayed list"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint32_t sleeper_counts[] = {10U, 50U, 100U, 400U};
+
+static TaskHandle_t probe_task;
+static uint32_t block_ns[DELAY_BENCH_ROUNDS];
+static uint32_t unblock_ns[DELAY_BENCH_ROUNDS];
+static volatile uint64_t probe_blocked_at;
+static volatile uint64_t probe_woken_at;
+static volatile uint32_t probe_timeouts;
+static uint32_t prng_state = DELAY_BENCH_SEED;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* xorshift32, the same delays are used with both delayed task implementations */
+static uint32_t prng_next(void)
+{
+    prng_state ^= prng_state << 13;
+    prng_state ^= prng_state >> 17;
+    prng_state ^= prng_state << 5;
+    return prng_state;
+}
+
+static TickType_t random_delay(void)
+{
+    return (TickType_t)(DELAY_BENCH_MIN_DELAY + prng_next() % (DELAY_BENCH_MAX_DELAY - DELAY_BENCH_MIN_DELAY));
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_latency(uint32_t delayed)
+{
+    qsort(block_ns, DELAY_BENCH_ROUNDS, sizeof(block_ns[0]), compare_u32);
+    qsort(unblock_ns, DELAY_BENCH_ROUNDS, sizeof(unblock_ns[0]), compare_u32);
+    printf("%-8u %8u %8u %8u %8u\r\n", (unsigned)delayed, (unsigned)block_ns[0],
+           (unsigned)block_ns[DELAY_BENCH_ROUNDS / 2U], (unsigned)unblock_ns[0],
+           (unsigned)unblock_ns[DELAY_BENCH_ROUNDS / 2U]);
+}
+
+static void sleeper_task(void *pvParameters)
+{
+    for (;;)
+    {
+        vTaskDelay((TickType_t)(uintptr_t)pvParameters);
+    }
+}
+
+/*!
+ * @brief Blocks with a timeout among the sleepers each time the control task unblocks it.
+ *
+ * The timeout is longer than the delay of every sleeper, so the sorted list is
+ * walked to its end.
+ */
+static void probe_task_fn(void *pvParameters)
+{
+    TickType_t delay;
+
+    for (;;)
+    {
+        delay            = DELAY_BENCH_MAX_DELAY + random_delay();
+        probe_blocked_at = bench_now_ns();
+        if (ulTaskNotifyTake(pdTRUE, delay) == 0U)
+        {
+            probe_timeouts++;
+        }
+        probe_woken_at = bench_now_ns();
+    }
+}
+
+/*!
+ * @brief Measures blocking with a timeout and unblocking with 10 to 400 delayed tasks.
+ *
+ * The probe task has the highest priority.  The control task notifies it, which
+ * removes it from the delayed tasks, and the probe task blocks on the next
+ * notification with a timeout, which puts it back among the delayed tasks and
+ * switches to the control task again.  Both times include one context switch
+ * of the POSIX port.
+ */
+static void control_task_fn(void *pvParameters)
+{
+    uint32_t created = 0U;
+    uint32_t n, round, count;
+    uint64_t start;
+
+    printf("FreeRTOS %s %s benchmark, %u round trips\r\n", tskKERNEL_VERSION_NUMBER, DELAY_BENCH_NAME,
+           (unsigned)DELAY_BENCH_ROUNDS);
+    printf("%-8s %8s %8s %8s %8s\r\n", "delayed", "block", "p50", "unblock", "p50");
+
+    xTaskCreate(probe_task_fn, "probe", configMINIMAL_STACK_SIZE, NULL, DELAY_BENCH_PROBE_PRIORITY, &probe_task);
+    configASSERT(probe_task != NULL);
+
+    for (n = 0U; n < sizeof(sleeper_counts) / sizeof(sleeper_counts[0]); n++)
+    {
+        count = sleeper_counts[n];
+        for (; created < count; created++)
+        {
+            /* The sleepers have a lower priority, they block as soon as the control task blocks */
+            if (xTaskCreate(sleeper_task, "sleep", DELAY_BENCH_SLEEPER_STACK, (void *)(uintptr_t)random_delay(),
+                            DELAY_BENCH_SLEEPER_PRIORITY, NULL) != pdPASS)
+            {
+                printf("Task creation failed!.\r\n");
+                vTaskEndScheduler();
+            }
+        }
+        vTaskDelay(DELAY_BENCH_SETTLE_TICKS);
+
+        for (round = 0U; round < DELAY_BENCH_ROUNDS; round++)
+        {
+            start = bench_now_ns();
+            xTaskNotifyGive(probe_task);
+
+            /* The probe task woke up and blocked again before this task resumed */
+            block_ns[round]   = (uint32_t)(bench_now_ns() - probe_blocked_at);
+            unblock_ns[round] = (uint32_t)(probe_woken_at - start);
+        }
+
+        /* The probe task is delayed as well */
+        print_latency(count + 1U);
+    }
+
+    printf("ns per operation, minimum and median; probe timeouts: %u\r\n", (unsigned)probe_timeouts);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, DELAY_BENCH_CONTROL_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
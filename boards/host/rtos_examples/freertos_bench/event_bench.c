@@ -0,0 +1,173 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of measured xEventGroupSetBitsFromISR() calls per waiter count */
+#ifndef EVENT_BENCH_ROUNDS
+#define EVENT_BENCH_ROUNDS (2000U)
+#endif
+
+#define EVENT_BENCH_MAX_WAITERS (8U)
+#define EVENT_BENCH_BIT (1U << 0)
+
+/* The timer service task has the highest priority, see FreeRTOSConfig.h */
+#define EVENT_BENCH_CONTROL_PRIORITY (2U)
+#define EVENT_BENCH_WAITER_PRIORITY (3U)
+
+#if (configUSE_EVENT_GROUP_DIRECT_ISR == 1)
+#define EVENT_BENCH_NAME "event group direct ISR"
+#else
+#define EVENT_BENCH_NAME "event group deferred ISR"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint32_t waiter_counts[] = {1U, 4U, EVENT_BENCH_MAX_WAITERS};
+
+static EventGroupHandle_t event_group;
+static uint32_t call_ns[EVENT_BENCH_ROUNDS];
+static uint32_t wakeup_ns[EVENT_BENCH_ROUNDS];
+static volatile uint64_t waiter_woken_at;
+static volatile uint32_t waiter_wakeups;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_latency(uint32_t waiters)
+{
+    qsort(call_ns, EVENT_BENCH_ROUNDS, sizeof(call_ns[0]), compare_u32);
+    qsort(wakeup_ns, EVENT_BENCH_ROUNDS, sizeof(wakeup_ns[0]), compare_u32);
+    printf("%-8u %8u %8u %8u %8u\r\n", (unsigned)waiters, (unsigned)call_ns[0],
+           (unsigned)call_ns[EVENT_BENCH_ROUNDS / 2U], (unsigned)wakeup_ns[0],
+           (unsigned)wakeup_ns[EVENT_BENCH_ROUNDS / 2U]);
+}
+
+/* All the waiters are unblocked by one set, the bit is cleared once they all matched */
+static void waiter_task(void *pvParameters)
+{
+    for (;;)
+    {
+        xEventGroupWaitBits(event_group, EVENT_BENCH_BIT, pdTRUE, pdTRUE, portMAX_DELAY);
+        waiter_woken_at = bench_now_ns();
+        waiter_wakeups++;
+    }
+}
+
+/*!
+ * @brief Measures xEventGroupSetBitsFromISR() with 1, 4 and 8 waiting tasks.
+ *
+ * The call is made with the tick interrupt masked, as from an interrupt.  The
+ * call time is the time spent in the interrupt, the wakeup time runs until the
+ * last waiting task runs, through the timer service task for the deferred path
+ * and for the direct path above configEVENT_GROUP_ISR_MAX_WAITERS waiters.
+ */
+static void control_task_fn(void *pvParameters)
+{
+    uint32_t created = 0U;
+    uint32_t n, round, count, expected = 0U;
+    UBaseType_t mask;
+    BaseType_t woken;
+    uint64_t start;
+
+    printf("FreeRTOS %s %s benchmark, %u calls\r\n", tskKERNEL_VERSION_NUMBER, EVENT_BENCH_NAME,
+           (unsigned)EVENT_BENCH_ROUNDS);
+    printf("%-8s %8s %8s %8s %8s\r\n", "waiters", "call", "p50", "wakeup", "p50");
+
+    event_group = xEventGroupCreate();
+    configASSERT(event_group != NULL);
+
+    for (n = 0U; n < sizeof(waiter_counts) / sizeof(waiter_counts[0]); n++)
+    {
+        count = waiter_counts[n];
+        for (; created < count; created++)
+        {
+            /* The waiters have a higher priority, they block as soon as they are created */
+            if (xTaskCreate(waiter_task, "waiter", configMINIMAL_STACK_SIZE, NULL, EVENT_BENCH_WAITER_PRIORITY, NULL) !=
+                pdPASS)
+            {
+                printf("Task creation failed!.\r\n");
+                vTaskEndScheduler();
+            }
+        }
+
+        for (round = 0U; round < EVENT_BENCH_ROUNDS; round++)
+        {
+            woken = pdFALSE;
+            start = bench_now_ns();
+            mask  = portSET_INTERRUPT_MASK_FROM_ISR();
+            xEventGroupSetBitsFromISR(event_group, EVENT_BENCH_BIT, &woken);
+            portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+            call_ns[round] = (uint32_t)(bench_now_ns() - start);
+            if (woken != pdFALSE)
+            {
+                taskYIELD();
+            }
+
+            /* The waiters ran and blocked again before this task resumed */
+            wakeup_ns[round] = (uint32_t)(waiter_woken_at - start);
+        }
+        expected += count * EVENT_BENCH_ROUNDS;
+
+        print_latency(count);
+    }
+
+    printf("ns per operation, minimum and median; missed wakeups: %u\r\n", (unsigned)(expected - waiter_wakeups));
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, EVENT_BENCH_CONTROL_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
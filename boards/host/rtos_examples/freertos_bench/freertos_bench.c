@@ -0,0 +1,585 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "block_pool.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+#include "rpmsg_queue.h"
+#include "srtm_dispatcher.h"
+#include "srtm_peercore.h"
+#include "srtm_message.h"
+#include "srtm_message_struct.h"
+#include "srtm_service.h"
+#include "srtm_service_struct.h"
+#include "srtm_rpmsg_endpoint.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of operations measured by each benchmark */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS (20000U)
+#endif
+
+#define BENCH_TASK_PRIORITY (2U)
+#define BENCH_PARTNER_PRIORITY (3U)
+#define BENCH_STACK_SIZE (configMINIMAL_STACK_SIZE)
+
+/* Both sides of the rpmsg link run on the host, see the host rpmsg platform */
+#define BENCH_RPMSG_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define BENCH_RPMSG_ECHO_ADDR (30U)
+#define BENCH_RPMSG_LOCAL_ADDR (31U)
+#define BENCH_RPMSG_MSG_SIZE (64U)
+#define BENCH_SRTM_ADDR (40U)
+#define BENCH_SRTM_LOCAL_ADDR (41U)
+#define BENCH_SRTM_CATEGORY (0x7FU)
+#define BENCH_SRTM_VERSION (0x0100U)
+
+typedef struct _bench
+{
+    const char *name;
+    uint32_t ops_per_iteration; /* operations the iteration time is divided into */
+    uint64_t (*run)(uint32_t iterations);
+} bench_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t bench_yield(uint32_t iterations);
+static uint64_t bench_queue_local(uint32_t iterations);
+static uint64_t bench_queue_round_trip(uint32_t iterations);
+static uint64_t bench_semaphore_round_trip(uint32_t iterations);
+static uint64_t bench_notify_round_trip(uint32_t iterations);
+static uint64_t bench_event_group_round_trip(uint32_t iterations);
+static uint64_t bench_stream_buffer_local(uint32_t iterations);
+static uint64_t bench_timer_start_stop(uint32_t iterations);
+static uint64_t bench_heap(uint32_t iterations);
+static uint64_t bench_block_pool(uint32_t iterations);
+static uint64_t bench_rpmsg_round_trip(uint32_t iterations);
+static uint64_t bench_rpmsg_nocopy_round_trip(uint32_t iterations);
+static uint64_t bench_srtm_round_trip(uint32_t iterations);
+static void bench_task(void *pvParameters);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const bench_t benches[] = {
+    {"context switch (taskYIELD)", 2U, bench_yield},
+    {"queue send+receive, same task", 1U, bench_queue_local},
+    {"queue round trip", 1U, bench_queue_round_trip},
+    {"semaphore round trip", 1U, bench_semaphore_round_trip},
+    {"task notify round trip", 1U, bench_notify_round_trip},
+    {"event group round trip", 1U, bench_event_group_round_trip},
+    {"stream buffer send+receive 32B", 1U, bench_stream_buffer_local},
+    {"timer start+stop", 1U, bench_timer_start_stop},
+    {"heap malloc+free (16..1024B)", 1U, bench_heap},
+    {"block pool alloc+free 64B", 1U, bench_block_pool},
+    {"rpmsg round trip 64B", 1U, bench_rpmsg_round_trip},
+    {"rpmsg nocopy round trip 64B", 1U, bench_rpmsg_nocopy_round_trip},
+    {"srtm request round trip", 1U, bench_srtm_round_trip},
+};
+
+static QueueHandle_t ping_queue;
+static QueueHandle_t pong_queue;
+static SemaphoreHandle_t ping_sem;
+static SemaphoreHandle_t pong_sem;
+static EventGroupHandle_t event_group;
+static TaskHandle_t bench_task_handle;
+
+static uint8_t rpmsg_shmem[BENCH_RPMSG_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *rpmsg_master;
+static struct rpmsg_lite_instance *rpmsg_remote;
+static struct rpmsg_lite_endpoint *rpmsg_ept;
+static rpmsg_queue_handle rpmsg_q;
+static struct _srtm_service srtm_bench_service;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+static void yield_partner(void *pvParameters)
+{
+    for (;;)
+    {
+        taskYIELD();
+    }
+}
+
+static uint64_t bench_yield(uint32_t iterations)
+{
+    TaskHandle_t partner;
+    uint64_t start, end;
+    uint32_t i;
+
+    /* Same priority as the benchmark task, every yield switches to the other task */
+    xTaskCreate(yield_partner, "yield", BENCH_STACK_SIZE, NULL, BENCH_TASK_PRIORITY, &partner);
+    taskYIELD();
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        taskYIELD();
+    }
+    end = bench_now_ns();
+
+    vTaskDelete(partner);
+    return end - start;
+}
+
+static uint64_t bench_queue_local(uint32_t iterations)
+{
+    QueueHandle_t queue = xQueueCreate(1, sizeof(uint32_t));
+    uint64_t start, end;
+    uint32_t i, value;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xQueueSend(queue, &i, 0);
+        xQueueReceive(queue, &value, 0);
+    }
+    end = bench_now_ns();
+
+    vQueueDelete(queue);
+    return end - start;
+}
+
+static void queue_partner(void *pvParameters)
+{
+    uint32_t value;
+
+    for (;;)
+    {
+        xQueueReceive(ping_queue, &value, portMAX_DELAY);
+        xQueueSend(pong_queue, &value, portMAX_DELAY);
+    }
+}
+
+static uint64_t bench_queue_round_trip(uint32_t iterations)
+{
+    TaskHandle_t partner;
+    uint64_t start, end;
+    uint32_t i, value;
+
+    ping_queue = xQueueCreate(1, sizeof(uint32_t));
+    pong_queue = xQueueCreate(1, sizeof(uint32_t));
+    xTaskCreate(queue_partner, "queue", BENCH_STACK_SIZE, NULL, BENCH_PARTNER_PRIORITY, &partner);
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xQueueSend(ping_queue, &i, portMAX_DELAY);
+        xQueueReceive(pong_queue, &value, portMAX_DELAY);
+    }
+    end = bench_now_ns();
+
+    vTaskDelete(partner);
+    vQueueDelete(ping_queue);
+    vQueueDelete(pong_queue);
+    return end - start;
+}
+
+static void semaphore_partner(void *pvParameters)
+{
+    for (;;)
+    {
+        xSemaphoreTake(ping_sem, portMAX_DELAY);
+        xSemaphoreGive(pong_sem);
+    }
+}
+
+static uint64_t bench_semaphore_round_trip(uint32_t iterations)
+{
+    TaskHandle_t partner;
+    uint64_t start, end;
+    uint32_t i;
+
+    ping_sem = xSemaphoreCreateBinary();
+    pong_sem = xSemaphoreCreateBinary();
+    xTaskCreate(semaphore_partner, "sem", BENCH_STACK_SIZE, NULL, BENCH_PARTNER_PRIORITY, &partner);
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xSemaphoreGive(ping_sem);
+        xSemaphoreTake(pong_sem, portMAX_DELAY);
+    }
+    end = bench_now_ns();
+
+    vTaskDelete(partner);
+    vSemaphoreDelete(ping_sem);
+    vSemaphoreDelete(pong_sem);
+    return end - start;
+}
+
+static void notify_partner(void *pvParameters)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        xTaskNotifyGive(bench_task_handle);
+    }
+}
+
+static uint64_t bench_notify_round_trip(uint32_t iterations)
+{
+    TaskHandle_t partner;
+    uint64_t start, end;
+    uint32_t i;
+
+    xTaskCreate(notify_partner, "notify", BENCH_STACK_SIZE, NULL, BENCH_PARTNER_PRIORITY, &partner);
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xTaskNotifyGive(partner);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    end = bench_now_ns();
+
+    vTaskDelete(partner);
+    return end - start;
+}
+
+static void event_group_partner(void *pvParameters)
+{
+    for (;;)
+    {
+        xEventGroupWaitBits(event_group, 1U << 0, pdTRUE, pdTRUE, portMAX_DELAY);
+        xEventGroupSetBits(event_group, 1U << 1);
+    }
+}
+
+static uint64_t bench_event_group_round_trip(uint32_t iterations)
+{
+    TaskHandle_t partner;
+    uint64_t start, end;
+    uint32_t i;
+
+    event_group = xEventGroupCreate();
+    xTaskCreate(event_group_partner, "event", BENCH_STACK_SIZE, NULL, BENCH_PARTNER_PRIORITY, &partner);
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xEventGroupSetBits(event_group, 1U << 0);
+        xEventGroupWaitBits(event_group, 1U << 1, pdTRUE, pdTRUE, portMAX_DELAY);
+    }
+    end = bench_now_ns();
+
+    vTaskDelete(partner);
+    vEventGroupDelete(event_group);
+    return end - start;
+}
+
+static uint64_t bench_stream_buffer_local(uint32_t iterations)
+{
+    StreamBufferHandle_t stream = xStreamBufferCreate(256, 1);
+    uint8_t data[32] = {0};
+    uint64_t start, end;
+    uint32_t i;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xStreamBufferSend(stream, data, sizeof(data), 0);
+        xStreamBufferReceive(stream, data, sizeof(data), 0);
+    }
+    end = bench_now_ns();
+
+    vStreamBufferDelete(stream);
+    return end - start;
+}
+
+static void timer_callback(TimerHandle_t timer)
+{
+}
+
+static uint64_t bench_timer_start_stop(uint32_t iterations)
+{
+    TimerHandle_t timer = xTimerCreate("bench", pdMS_TO_TICKS(1000), pdFALSE, NULL, timer_callback);
+    uint64_t start, end;
+    uint32_t i;
+
+    /* The timer service task has the highest priority, it processes each command right away */
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        xTimerStart(timer, portMAX_DELAY);
+        xTimerStop(timer, portMAX_DELAY);
+    }
+    end = bench_now_ns();
+
+    xTimerDelete(timer, portMAX_DELAY);
+    return end - start;
+}
+
+static uint64_t bench_heap(uint32_t iterations)
+{
+    void *blocks[8];
+    uint64_t start, end;
+    uint32_t i, j;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i += 8U)
+    {
+        for (j = 0; j < 8U; j++)
+        {
+            blocks[j] = pvPortMalloc(16U << ((i / 8U + j) % 7U));
+        }
+        for (j = 0; j < 8U; j++)
+        {
+            vPortFree(blocks[(j * 5U) % 8U]);
+        }
+    }
+    end = bench_now_ns();
+
+    return end - start;
+}
+
+static uint64_t bench_block_pool(uint32_t iterations)
+{
+    BlockPoolHandle_t pool = xBlockPoolCreate(64U, 8U);
+    void *blocks[8];
+    uint64_t start, end;
+    uint32_t i, j;
+
+    /* Same pattern as bench_heap, the pool does not depend on the scheduler */
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i += 8U)
+    {
+        for (j = 0; j < 8U; j++)
+        {
+            blocks[j] = pvBlockPoolAlloc(pool);
+        }
+        for (j = 0; j < 8U; j++)
+        {
+            vBlockPoolFree(pool, blocks[(j * 5U) % 8U]);
+        }
+    }
+    end = bench_now_ns();
+
+    vBlockPoolDelete(pool);
+    return end - start;
+}
+
+static void rpmsg_echo_task(void *pvParameters)
+{
+    rpmsg_queue_handle queue = rpmsg_queue_create(rpmsg_remote);
+    struct rpmsg_lite_endpoint *ept =
+        rpmsg_lite_create_ept(rpmsg_remote, BENCH_RPMSG_ECHO_ADDR, rpmsg_queue_rx_cb, queue);
+    unsigned long src;
+    char *data;
+    int len;
+
+    for (;;)
+    {
+        rpmsg_queue_recv_nocopy(rpmsg_remote, queue, &src, &data, &len, RL_BLOCK);
+        rpmsg_lite_send(rpmsg_remote, ept, src, data, len, RL_BLOCK);
+        rpmsg_queue_nocopy_free(rpmsg_remote, data);
+    }
+}
+
+static srtm_status_t srtm_bench_request(srtm_service_t service, srtm_request_t request)
+{
+    srtm_response_t response = SRTM_Response_Create(SRTM_CommMessage_GetChannel(request), BENCH_SRTM_CATEGORY,
+                                                    BENCH_SRTM_VERSION, SRTM_CommMessage_GetCommand(request), 0U);
+
+    if (!response)
+    {
+        return SRTM_Status_OutOfMemory;
+    }
+
+    return SRTM_Dispatcher_DeliverResponse(service->dispatcher, response);
+}
+
+static void srtm_dispatcher_task(void *pvParameters)
+{
+    srtm_dispatcher_t disp = SRTM_Dispatcher_Create();
+    srtm_peercore_t core = SRTM_PeerCore_Create(1U);
+    srtm_rpmsg_endpoint_config_t config = {0};
+    srtm_channel_t channel;
+
+    config.rpmsgHandle = rpmsg_remote;
+    config.localAddr = BENCH_SRTM_ADDR;
+    config.peerAddr = RL_ADDR_ANY;
+    channel = SRTM_RPMsgEndpoint_Create(&config);
+
+    SRTM_PeerCore_SetState(core, SRTM_PeerCore_State_Activated);
+    SRTM_PeerCore_AddChannel(core, channel);
+    SRTM_Dispatcher_AddPeerCore(disp, core);
+
+    SRTM_List_Init(&srtm_bench_service.node);
+    srtm_bench_service.category = BENCH_SRTM_CATEGORY;
+    srtm_bench_service.request = srtm_bench_request;
+    SRTM_Dispatcher_RegisterService(disp, &srtm_bench_service);
+
+    SRTM_Dispatcher_Start(disp);
+    SRTM_Dispatcher_Run(disp);
+}
+
+/*!
+ * @brief Brings up both sides of a host rpmsg link and the remote side services.
+ */
+static void bench_rpmsg_init(void)
+{
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    rpmsg_remote = rpmsg_lite_remote_init(rpmsg_shmem, RL_PLATFORM_HOST_REMOTE_LINK_ID, RL_NO_FLAGS);
+    rpmsg_master = rpmsg_lite_master_init(rpmsg_shmem, sizeof(rpmsg_shmem), RL_PLATFORM_HOST_MASTER_LINK_ID, RL_NO_FLAGS);
+    if ((!rpmsg_remote) || (!rpmsg_master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(rpmsg_remote))
+    {
+        vTaskDelay(1);
+    }
+
+    rpmsg_q = rpmsg_queue_create(rpmsg_master);
+    rpmsg_ept = rpmsg_lite_create_ept(rpmsg_master, BENCH_RPMSG_LOCAL_ADDR, rpmsg_queue_rx_cb, rpmsg_q);
+
+    xTaskCreate(rpmsg_echo_task, "rpmsg_echo", BENCH_STACK_SIZE, NULL, BENCH_PARTNER_PRIORITY, NULL);
+    xTaskCreate(srtm_dispatcher_task, "srtm", BENCH_STACK_SIZE * 2U, NULL, BENCH_PARTNER_PRIORITY, NULL);
+    /* Let the remote side create its endpoints */
+    vTaskDelay(10);
+}
+
+static uint64_t bench_rpmsg_round_trip(uint32_t iterations)
+{
+    char data[BENCH_RPMSG_MSG_SIZE] = {0};
+    uint64_t start, end;
+    unsigned long src;
+    uint32_t i;
+    int len;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        rpmsg_lite_send(rpmsg_master, rpmsg_ept, BENCH_RPMSG_ECHO_ADDR, data, sizeof(data), RL_BLOCK);
+        rpmsg_queue_recv(rpmsg_master, rpmsg_q, &src, data, sizeof(data), &len, RL_BLOCK);
+    }
+    end = bench_now_ns();
+
+    return end - start;
+}
+
+static uint64_t bench_rpmsg_nocopy_round_trip(uint32_t iterations)
+{
+    uint64_t start, end;
+    unsigned long size, src;
+    uint32_t i;
+    char *data;
+    int len;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        data = rpmsg_lite_alloc_tx_buffer(rpmsg_master, &size, RL_BLOCK);
+        rpmsg_lite_send_nocopy(rpmsg_master, rpmsg_ept, BENCH_RPMSG_ECHO_ADDR, data, BENCH_RPMSG_MSG_SIZE);
+        rpmsg_queue_recv_nocopy(rpmsg_master, rpmsg_q, &src, &data, &len, RL_BLOCK);
+        rpmsg_queue_nocopy_free(rpmsg_master, data);
+    }
+    end = bench_now_ns();
+
+    return end - start;
+}
+
+static uint64_t bench_srtm_round_trip(uint32_t iterations)
+{
+    srtm_packet_head_t request = {0};
+    srtm_packet_head_t response;
+    uint64_t start, end;
+    unsigned long src;
+    uint32_t i;
+    int len;
+
+    request.category = BENCH_SRTM_CATEGORY;
+    request.majorVersion = SRTM_MESSAGE_MAJOR_VERSION(BENCH_SRTM_VERSION);
+    request.minorVersion = SRTM_MESSAGE_MINOR_VERSION(BENCH_SRTM_VERSION);
+    request.type = SRTM_MessageTypeRequest;
+
+    start = bench_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        request.command = (uint8_t)i;
+        rpmsg_lite_send(rpmsg_master, rpmsg_ept, BENCH_SRTM_ADDR, (char *)&request, sizeof(request), RL_BLOCK);
+        rpmsg_queue_recv(rpmsg_master, rpmsg_q, &src, (char *)&response, sizeof(response), &len, RL_BLOCK);
+    }
+    end = bench_now_ns();
+
+    return end - start;
+}
+
+/*!
+ * @brief Runs all benchmarks and prints ns/op.
+ */
+static void bench_task(void *pvParameters)
+{
+    uint64_t elapsed;
+    uint32_t n;
+
+    printf("FreeRTOS %s kernel benchmark, %u iterations\r\n", tskKERNEL_VERSION_NUMBER, (unsigned)BENCH_ITERATIONS);
+    printf("%-34s %12s\r\n", "benchmark", "ns/op");
+
+    bench_rpmsg_init();
+
+    for (n = 0; n < sizeof(benches) / sizeof(benches[0]); n++)
+    {
+        /* warm up, then measure */
+        (void)benches[n].run(BENCH_ITERATIONS / 10U);
+        elapsed = benches[n].run(BENCH_ITERATIONS);
+        printf("%-34s %12.1f\r\n", benches[n].name,
+               (double)elapsed / ((double)BENCH_ITERATIONS * benches[n].ops_per_iteration));
+        fflush(stdout);
+    }
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(bench_task, "bench", BENCH_STACK_SIZE, NULL, BENCH_TASK_PRIORITY, &bench_task_handle) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
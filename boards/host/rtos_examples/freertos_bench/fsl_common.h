@@ -0,0 +1,111 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/*
+ * Host (POSIX) stand-in of the SDK common driver header. Provides only what the
+ * middleware built on the host uses, mapped onto the FreeRTOS POSIX port.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifdef HOST_IRQ_OFF_TRACE
+/* Provided by the benchmark measuring the time spent with the global IRQ disabled */
+void HOST_IrqOffEnter(void);
+void HOST_IrqOffExit(void);
+#else
+#define HOST_IrqOffEnter()
+#define HOST_IrqOffExit()
+#endif
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+/*! @brief Disable the global IRQ, the tick signal on the host */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t primask = (uint32_t)portSET_INTERRUPT_MASK_FROM_ISR();
+
+    HOST_IrqOffEnter();
+    return primask;
+}
+
+/*! @brief Restore the global IRQ state returned by DisableGlobalIRQ() */
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    HOST_IrqOffExit();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(primask);
+}
+
+/*! @brief Count leading zeros, the CMSIS intrinsic */
+static inline uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+/*! @brief Active exception number, there are no exceptions on the host */
+static inline uint32_t __get_IPSR(void)
+{
+    return 0U;
+}
+
+/*
+ * C versions of the Cortex-M4 SIMD intrinsics used by the SRTM audio PCM kernels, with the
+ * results of the instructions, so the SIMD code of the kernels can be checked on the host.
+ */
+
+/*! @brief Signed saturation to sat bits */
+static inline int32_t __SSAT(int32_t val, uint32_t sat)
+{
+    int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+
+    return (val > max) ? max : ((val < -max - 1) ? (-max - 1) : val);
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3) \
+    ((((uint32_t)(ARG1)) & 0x0000FFFFUL) | ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL))
+
+#define __PKHTB(ARG1, ARG2, ARG3) \
+    ((((uint32_t)(ARG1)) & 0xFFFF0000UL) | ((((uint32_t)(ARG2)) >> (ARG3)) & 0x0000FFFFUL))
+
+/*! @brief Sum of the products of the bottom and top halves */
+static inline uint32_t __SMUAD(uint32_t op1, uint32_t op2)
+{
+    return (uint32_t)((int32_t)(int16_t)op1 * (int16_t)op2 + (int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16));
+}
+
+/*! @brief Sum of the products of the halves, with the halves of op2 exchanged */
+static inline uint32_t __SMUADX(uint32_t op1, uint32_t op2)
+{
+    return (uint32_t)((int32_t)(int16_t)op1 * (int16_t)(op2 >> 16) + (int32_t)(int16_t)(op1 >> 16) * (int16_t)op2);
+}
+
+/*! @brief 64 bit accumulation of the sum of the products of the bottom and top halves */
+static inline uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+    return (uint64_t)((int64_t)acc + (int32_t)(int16_t)op1 * (int16_t)op2 +
+                      (int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16));
+}
+
+/*! @brief Saturating add of the bottom and top halves */
+static inline uint32_t __QADD16(uint32_t op1, uint32_t op2)
+{
+    int32_t lo = __SSAT((int16_t)op1 + (int16_t)op2, 16);
+    int32_t hi = __SSAT((int16_t)(op1 >> 16) + (int16_t)(op2 >> 16), 16);
+
+    return __PKHBT(lo, hi, 16);
+}
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,3 @@
+#!/bin/sh
+cmake -DCMAKE_BUILD_TYPE=Release .
+make -j4
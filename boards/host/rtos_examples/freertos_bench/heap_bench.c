@@ -0,0 +1,450 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "block_pool.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of pvPortMalloc()/vPortFree() calls */
+#ifndef HEAP_BENCH_OPERATIONS
+#define HEAP_BENCH_OPERATIONS (200000U)
+#endif
+
+/* Number of blocks that can be allocated at the same time */
+#ifndef HEAP_BENCH_SLOTS
+#define HEAP_BENCH_SLOTS (192U)
+#endif
+#define HEAP_BENCH_SEED (0x12345678U)
+#define HEAP_BENCH_TASK_PRIORITY (2U)
+
+/* Size classes of pvPortMalloc() with configUSE_BLOCK_POOL_MALLOC, small enough to run out */
+#define HEAP_BENCH_POOL_CLASSES (2U)
+#define HEAP_BENCH_POOL_BLOCK_COUNT (16U)
+
+/* heap_5 regions, the first one too small for the benchmark so that both are used */
+#define HEAP_BENCH_REGION_COUNT (2U)
+#define HEAP_BENCH_SMALL_REGION_SIZE (64U * 1024U)
+#define HEAP_BENCH_LARGE_REGION_SIZE (192U * 1024U)
+#define HEAP_BENCH_REGION_GAP (4096U)
+
+#ifdef BENCH_HEAP_TLSF
+#define HEAP_BENCH_NAME "heap_tlsf"
+#elif defined(BENCH_HEAP_HEAP5)
+#define HEAP_BENCH_NAME "heap_5 instrumented"
+#elif (configUSE_BLOCK_POOL_MALLOC == 1)
+#define HEAP_BENCH_NAME "heap_4 with block pools"
+#elif (configHEAP_INSTRUMENTATION == 1)
+#define HEAP_BENCH_NAME "heap_4 instrumented"
+#else
+#define HEAP_BENCH_NAME "heap_4"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static void *slots[HEAP_BENCH_SLOTS];
+static size_t slot_sizes[HEAP_BENCH_SLOTS];
+static uint32_t malloc_ns[HEAP_BENCH_OPERATIONS];
+static uint32_t free_ns[HEAP_BENCH_OPERATIONS];
+static uint32_t prng_state = HEAP_BENCH_SEED;
+
+#if (configUSE_BLOCK_POOL_MALLOC == 1)
+static const size_t pool_block_sizes[HEAP_BENCH_POOL_CLASSES] = {64U, 256U};
+static BlockPoolHandle_t pools[HEAP_BENCH_POOL_CLASSES];
+/* Requests that went to the heap, by the smallest class they fit */
+static uint32_t pool_misses[HEAP_BENCH_POOL_CLASSES];
+static uint32_t pool_served;
+#endif
+
+#ifdef BENCH_HEAP_HEAP5
+static const size_t region_sizes[HEAP_BENCH_REGION_COUNT] = {HEAP_BENCH_SMALL_REGION_SIZE,
+                                                            HEAP_BENCH_LARGE_REGION_SIZE};
+/* Both regions and the gap between them, which is never part of the heap */
+static uint8_t region_memory[HEAP_BENCH_SMALL_REGION_SIZE + HEAP_BENCH_REGION_GAP + HEAP_BENCH_LARGE_REGION_SIZE]
+    __attribute__((aligned(portBYTE_ALIGNMENT)));
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* xorshift32, the same sequence of requests is replayed for each heap */
+static uint32_t prng_next(void)
+{
+    prng_state ^= prng_state << 13;
+    prng_state ^= prng_state >> 17;
+    prng_state ^= prng_state << 5;
+    return prng_state;
+}
+
+static size_t random_size(void)
+{
+    uint32_t kind = prng_next() % 100U;
+
+    if (kind < 70U)
+    {
+        return 16U + prng_next() % (256U - 16U);
+    }
+    else if (kind < 95U)
+    {
+        return 256U + prng_next() % (2048U - 256U);
+    }
+    else
+    {
+        return 2048U + prng_next() % (8192U - 2048U);
+    }
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_latency(const char *name, uint32_t *samples, uint32_t count)
+{
+    if (count == 0U)
+    {
+        return;
+    }
+
+    qsort(samples, count, sizeof(samples[0]), compare_u32);
+    printf("%-8s %8u %8u %8u %8u %8u\r\n", name, (unsigned)count, (unsigned)samples[count / 2U],
+           (unsigned)samples[(uint64_t)count * 99U / 100U], (unsigned)samples[(uint64_t)count * 999U / 1000U],
+           (unsigned)samples[count - 1U]);
+}
+
+#if (configHEAP_INSTRUMENTATION == 1)
+static HeapInstrumentationStats_t stats_before;
+static HeapInstrumentationStats_t stats_after;
+static HeapConsumer_t consumers[8];
+/* Successful allocations of the benchmark, by the bins of xAllocationHistogram */
+static size_t allocation_tally[portHEAP_HISTOGRAM_BINS];
+
+static void print_report_line(const char *line)
+{
+    printf("%s\r\n", line);
+}
+
+static size_t histogram_sum(const size_t *histogram)
+{
+    size_t sum = 0U;
+    uint32_t n;
+
+    for (n = 0U; n < portHEAP_HISTOGRAM_BINS; n++)
+    {
+        sum += histogram[n];
+    }
+    return sum;
+}
+
+/* The bins of the heap, the last one takes everything above */
+static uint32_t histogram_bin(size_t size)
+{
+    uint32_t bin = 0U;
+
+    while ((bin < (portHEAP_HISTOGRAM_BINS - 1U)) && (size >= ((size_t)32U << bin)))
+    {
+        bin++;
+    }
+    return bin;
+}
+
+/*!
+ * @brief Compares the heap accounting with the blocks the benchmark holds.
+ *
+ * The kernel blocks allocated before the benchmark are the same in both
+ * snapshots, so the differences must match the live slots exactly.
+ */
+static uint32_t check_accounting(void)
+{
+    size_t live_blocks = 0U, live_bytes = 0U, untracked = 0U, consumer_bytes = 0U, consumer_blocks = 0U;
+    uint32_t errors = 0U;
+    size_t count, n;
+
+    for (n = 0U; n < HEAP_BENCH_SLOTS; n++)
+    {
+        if (slots[n] != NULL)
+        {
+            live_blocks++;
+            live_bytes += slot_sizes[n];
+        }
+    }
+
+    vPortGetHeapInstrumentationStats(&stats_after);
+    count = xPortGetHeapConsumers(consumers, sizeof(consumers) / sizeof(consumers[0]), &untracked);
+    for (n = 0U; n < count; n++)
+    {
+        if (consumers[n].pvTask == (void *)xTaskGetCurrentTaskHandle())
+        {
+            consumer_bytes += consumers[n].xBytes;
+            consumer_blocks += consumers[n].xBlocks;
+        }
+    }
+
+    errors += (stats_after.xLiveBlockCount - stats_before.xLiveBlockCount != live_blocks);
+    errors += (stats_after.xLiveRequestedBytes - stats_before.xLiveRequestedBytes != live_bytes);
+    errors += (consumer_bytes != live_bytes);
+    errors += (consumer_blocks != live_blocks);
+    errors += (untracked != 0U);
+    errors += (stats_after.xFreeBytes != xPortGetFreeHeapSize());
+    errors += (stats_after.xFreeBytes + stats_after.xLiveBlockBytes !=
+               stats_before.xFreeBytes + stats_before.xLiveBlockBytes);
+    errors += (histogram_sum(stats_after.xFreeBlockHistogram) != stats_after.xFreeBlockCount);
+    for (n = 0U; n < portHEAP_HISTOGRAM_BINS; n++)
+    {
+        errors += (stats_after.xAllocationHistogram[n] - stats_before.xAllocationHistogram[n] != allocation_tally[n]);
+    }
+    errors += (stats_after.xLargestFreeBlock > stats_after.xFreeBytes);
+
+    return errors;
+}
+#endif /* configHEAP_INSTRUMENTATION */
+
+#ifdef BENCH_HEAP_HEAP5
+static void define_regions(void)
+{
+    HeapRegion_t regions[HEAP_BENCH_REGION_COUNT + 1U];
+    uint8_t *start = region_memory;
+    uint32_t n;
+
+    /* In address order, as vPortDefineHeapRegions() expects */
+    for (n = 0U; n < HEAP_BENCH_REGION_COUNT; n++)
+    {
+        regions[n].pucStartAddress = start;
+        regions[n].xSizeInBytes    = region_sizes[n];
+        start += region_sizes[n] + HEAP_BENCH_REGION_GAP;
+    }
+    regions[n].pucStartAddress = NULL;
+    regions[n].xSizeInBytes    = 0U;
+
+    vPortDefineHeapRegions(regions);
+}
+
+/*!
+ * @brief Counts the live blocks of the benchmark in each region, none may be outside of them.
+ */
+static uint32_t check_regions(void)
+{
+    uint32_t in_region[HEAP_BENCH_REGION_COUNT] = {0U};
+    uint32_t errors = 0U;
+    uint8_t *start;
+    uint32_t n, r;
+
+    for (n = 0U; n < HEAP_BENCH_SLOTS; n++)
+    {
+        if (slots[n] == NULL)
+        {
+            continue;
+        }
+        start = region_memory;
+        for (r = 0U; r < HEAP_BENCH_REGION_COUNT; r++)
+        {
+            if (((uint8_t *)slots[n] >= start) && ((uint8_t *)slots[n] + slot_sizes[n] <= start + region_sizes[r]))
+            {
+                in_region[r]++;
+                break;
+            }
+            start += region_sizes[r] + HEAP_BENCH_REGION_GAP;
+        }
+        errors += (r == HEAP_BENCH_REGION_COUNT);
+    }
+
+    for (r = 0U; r < HEAP_BENCH_REGION_COUNT; r++)
+    {
+        printf("region %u: %u bytes, %u live blocks\r\n", (unsigned)r, (unsigned)region_sizes[r],
+               (unsigned)in_region[r]);
+        errors += (in_region[r] == 0U);
+    }
+    return errors;
+}
+#endif /* BENCH_HEAP_HEAP5 */
+
+#if (configUSE_BLOCK_POOL_MALLOC == 1)
+static void create_pools(void)
+{
+    uint32_t n;
+
+    for (n = 0U; n < HEAP_BENCH_POOL_CLASSES; n++)
+    {
+        pools[n] = xBlockPoolCreate(pool_block_sizes[n], HEAP_BENCH_POOL_BLOCK_COUNT);
+        if ((pools[n] == NULL) || (xBlockPoolAddMallocClass(pools[n]) != pdPASS))
+        {
+            printf("Block pool creation failed!\r\n");
+            vAssertCalled(__FILE__, __LINE__);
+        }
+    }
+}
+
+/* Counts a request of a class size the pools could not serve */
+static void tally_pool_request(size_t size, void *block)
+{
+    uint32_t n;
+
+    for (n = 0U; n < HEAP_BENCH_POOL_CLASSES; n++)
+    {
+        if ((block != NULL) && xBlockPoolOwnsBlock(pools[n], block))
+        {
+            pool_served++;
+            return;
+        }
+    }
+    for (n = 0U; n < HEAP_BENCH_POOL_CLASSES; n++)
+    {
+        if (size <= pool_block_sizes[n])
+        {
+            pool_misses[n]++;
+            return;
+        }
+    }
+}
+
+/*!
+ * @brief Compares the failed allocations of each class with the requests the heap served instead.
+ */
+static uint32_t check_pools(void)
+{
+    BlockPoolStats_t stats;
+    uint32_t errors = 0U;
+    uint32_t n;
+
+    for (n = 0U; n < HEAP_BENCH_POOL_CLASSES; n++)
+    {
+        vBlockPoolGetStats(pools[n], &stats);
+        printf("pool of %u byte blocks: %u in use, high water mark %u, %u failed allocations\r\n",
+               (unsigned)stats.xBlockSize, (unsigned)stats.uxBlocksInUse, (unsigned)stats.uxHighWaterMark,
+               (unsigned)stats.uxFailedAllocations);
+        errors += (stats.uxFailedAllocations != pool_misses[n]);
+    }
+    return errors;
+}
+#endif /* configUSE_BLOCK_POOL_MALLOC */
+
+/*!
+ * @brief Replays a random mix of allocations and frees, timing each call.
+ */
+static void heap_bench_task(void *pvParameters)
+{
+    uint32_t mallocs = 0U;
+    uint32_t frees   = 0U;
+    uint32_t failed  = 0U;
+    uint32_t n, slot;
+    uint64_t start;
+    void *block;
+
+#if (configHEAP_INSTRUMENTATION == 1)
+    vPortGetHeapInstrumentationStats(&stats_before);
+#endif
+#if (configUSE_BLOCK_POOL_MALLOC == 1)
+    create_pools();
+#endif
+
+    for (n = 0U; n < HEAP_BENCH_OPERATIONS; n++)
+    {
+        slot = prng_next() % HEAP_BENCH_SLOTS;
+        if (slots[slot] != NULL)
+        {
+            start = bench_now_ns();
+            vPortFree(slots[slot]);
+            free_ns[frees++] = (uint32_t)(bench_now_ns() - start);
+            slots[slot]      = NULL;
+        }
+        else
+        {
+            size_t size = random_size();
+
+            start = bench_now_ns();
+            block = pvPortMalloc(size);
+            malloc_ns[mallocs++] = (uint32_t)(bench_now_ns() - start);
+#if (configUSE_BLOCK_POOL_MALLOC == 1)
+            tally_pool_request(size, block);
+#endif
+            if (block == NULL)
+            {
+                failed++;
+            }
+            else
+            {
+                /* touch the block like an application would */
+                memset(block, 0xA5, size);
+#if (configHEAP_INSTRUMENTATION == 1)
+                allocation_tally[histogram_bin(size)]++;
+#endif
+            }
+            slots[slot]      = block;
+            slot_sizes[slot] = size;
+        }
+    }
+
+    printf("FreeRTOS %s %s benchmark, %u operations, %u slots\r\n", tskKERNEL_VERSION_NUMBER, HEAP_BENCH_NAME,
+           (unsigned)HEAP_BENCH_OPERATIONS, (unsigned)HEAP_BENCH_SLOTS);
+    printf("%-8s %8s %8s %8s %8s %8s\r\n", "ns", "calls", "p50", "p99", "p99.9", "max");
+    print_latency("malloc", malloc_ns, mallocs);
+    print_latency("free", free_ns, frees);
+    printf("failed allocations: %u\r\n", (unsigned)failed);
+    printf("free heap: %u bytes, minimum ever: %u bytes\r\n", (unsigned)xPortGetFreeHeapSize(),
+           (unsigned)xPortGetMinimumEverFreeHeapSize());
+#if (configUSE_BLOCK_POOL_MALLOC == 1)
+    printf("%u allocations served by the pools\r\n", (unsigned)pool_served);
+    printf("pool failed allocations: %s\r\n", (check_pools() == 0U) ? "exact" : "MISMATCH");
+#endif
+#ifdef BENCH_HEAP_HEAP5
+    printf("heap regions: %s\r\n", (check_regions() == 0U) ? "exact" : "MISMATCH");
+#endif
+#if (configHEAP_INSTRUMENTATION == 1)
+    printf("heap accounting: %s\r\n", (check_accounting() == 0U) ? "exact" : "MISMATCH");
+    vPortHeapReport(print_report_line, 4U);
+#endif
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+#ifdef BENCH_HEAP_HEAP5
+    /* heap_5 has no memory until its regions are defined, before the first allocation */
+    define_regions();
+#endif
+    if (xTaskCreate(heap_bench_task, "heap", configMINIMAL_STACK_SIZE, NULL, HEAP_BENCH_TASK_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
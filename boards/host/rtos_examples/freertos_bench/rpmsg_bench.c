@@ -0,0 +1,719 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+#include "rpmsg_frag.h"
+#include "rpmsg_queue.h"
+#include "rpmsg_platform.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Messages per latency measurement */
+#ifndef RPMSG_BENCH_ROUNDS
+#define RPMSG_BENCH_ROUNDS (5000U)
+#endif
+
+/* Messages sent back to back before waiting for them */
+#define RPMSG_BENCH_BURST (16U)
+
+/* A batch that needs more tx buffers than there are, so it waits for the remote side */
+#define RPMSG_BENCH_LONG_BATCH (2U * RL_BUFFER_COUNT)
+
+/* The best of the runs is printed */
+#define RPMSG_BENCH_RUNS (3U)
+
+#define RPMSG_BENCH_MSG_SIZE (64U)
+
+/* Most endpoints of the remote side for the endpoint lookup */
+#define RPMSG_BENCH_MAX_EPTS (128U)
+
+/* Below the rx worker (RL_RX_WORKER_PRIORITY) and the mailbox task, which preempt the sender */
+#define RPMSG_BENCH_CONTROL_PRIORITY (2U)
+
+/* Both sides of the rpmsg link run on the host, see the host rpmsg platform */
+#define RPMSG_BENCH_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define RPMSG_BENCH_LOCAL_ADDR (30U)
+#define RPMSG_BENCH_REMOTE_ADDR (31U)
+
+/* Messages held by the remote side, released in bursts of half the rx buffers */
+#define RPMSG_BENCH_HOLD_ADDR (202U)
+#define RPMSG_BENCH_HOLD_BURST (RL_BUFFER_COUNT / 2U)
+
+/* Messages received through an rpmsg_queue by the queue task, just above the sender */
+#define RPMSG_BENCH_QUEUE_ADDR (203U)
+#define RPMSG_BENCH_QUEUE_PRIORITY (RPMSG_BENCH_CONTROL_PRIORITY + 1U)
+
+/* Fragmented messages, reassembled in an arena of the remote side */
+#define RPMSG_BENCH_FRAG_LOCAL_ADDR (200U)
+#define RPMSG_BENCH_FRAG_REMOTE_ADDR (201U)
+#define RPMSG_BENCH_FRAG_MAX_SIZE (16384U)
+#define RPMSG_BENCH_FRAG_ARENA_SIZE (4U * RPMSG_BENCH_FRAG_MAX_SIZE)
+/* Size of the header of rpmsg_frag.c */
+#define RPMSG_BENCH_FRAG_HDR_SIZE (2U * sizeof(unsigned short) + 2U * sizeof(unsigned long))
+/* Bytes sent per fragmented message size */
+#define RPMSG_BENCH_FRAG_BYTES (4U * 1024U * 1024U)
+
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+#define RPMSG_BENCH_BUFFERS_NAME "tx buffer size classes"
+#else
+#define RPMSG_BENCH_BUFFERS_NAME "fixed size tx buffers"
+#endif
+
+#if defined(RL_USE_QUEUE_RING) && (RL_USE_QUEUE_RING == 1)
+#define RPMSG_BENCH_QUEUE_NAME "ring"
+#else
+#define RPMSG_BENCH_QUEUE_NAME "environment queue"
+#endif
+
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+#define RPMSG_BENCH_RX_NAME "rx worker"
+#else
+#define RPMSG_BENCH_RX_NAME "ISR"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t rpmsg_shmem[RPMSG_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *rpmsg_master;
+static struct rpmsg_lite_instance *rpmsg_remote;
+static struct rpmsg_lite_endpoint *master_ept;
+static struct rpmsg_lite_endpoint *remote_ept;
+static struct rpmsg_lite_endpoint *remote_epts[RPMSG_BENCH_MAX_EPTS];
+static TaskHandle_t control_task;
+
+static char message[RPMSG_BENCH_MSG_SIZE];
+static char *burst_data[RPMSG_BENCH_LONG_BATCH];
+static unsigned long burst_size[RPMSG_BENCH_LONG_BATCH];
+static uint32_t samples[RPMSG_BENCH_ROUNDS];
+
+static rpmsg_frag_handle master_frag;
+static rpmsg_frag_handle remote_frag;
+static char frag_data[RPMSG_BENCH_FRAG_MAX_SIZE];
+static char frag_arena[RPMSG_BENCH_FRAG_ARENA_SIZE];
+static void *tx_buffers[RL_BUFFER_COUNT];
+static struct rpmsg_lite_endpoint *hold_ept;
+static void *held[RPMSG_BENCH_HOLD_BURST];
+static rpmsg_queue_handle queue;
+static struct rpmsg_lite_endpoint *queue_ept;
+
+static const uint32_t ept_counts[] = {1U, 16U, RPMSG_BENCH_MAX_EPTS};
+static const uint32_t burst_counts[] = {1U, 4U, RPMSG_BENCH_BURST};
+static const uint32_t frag_sizes[] = {256U, 4096U, RPMSG_BENCH_FRAG_MAX_SIZE};
+static const uint32_t msg_sizes[] = {16U, 256U, 2048U};
+
+/* Updated by the remote endpoint callback */
+static volatile uint32_t received;
+static volatile uint64_t received_first_ns;
+static volatile uint64_t received_ns;
+/* The control task is only woken up once this count is reached */
+static volatile uint32_t notify_at;
+/* Reassembled messages which differ from what was sent */
+static volatile uint32_t frag_errors;
+/* Held messages, the next sequence number expected and the ones out of sequence */
+static volatile uint32_t held_count;
+static volatile uint32_t hold_next;
+static volatile uint32_t hold_errors;
+/* The queue task receives with rpmsg_queue_recv_many() instead of rpmsg_queue_recv_nocopy() */
+static volatile int queue_many;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*!
+ * @brief Sorts the samples and prints the minimum, median, p99 and maximum.
+ */
+static void print_percentiles(const char *name, uint32_t *values, uint32_t count)
+{
+    qsort(values, count, sizeof(values[0]), compare_samples);
+    printf("%-24s %8u %8u %8u %8u\r\n", name, (unsigned)values[0], (unsigned)values[count / 2U],
+           (unsigned)values[(count * 99U) / 100U], (unsigned)values[count - 1U]);
+}
+
+/* Runs in the mailbox task, or in the rx worker of the remote instance */
+static int remote_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    received_ns = bench_now_ns();
+    if (!received)
+    {
+        received_first_ns = received_ns;
+    }
+    received++;
+    if (received >= notify_at)
+    {
+        xTaskNotifyGive(control_task);
+    }
+
+    return RL_RELEASE;
+}
+
+/* Keeps the rpmsg buffer, the message carries its sequence number */
+static int remote_hold_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    uint32_t seq;
+
+    memcpy(&seq, payload, sizeof(seq));
+    if (seq != hold_next)
+    {
+        hold_errors++;
+    }
+    hold_next = seq + 1U;
+    held[held_count++] = payload;
+    remote_rx_cb(payload, payload_len, src, priv);
+
+    return RL_HOLD;
+}
+
+static void remote_frag_cb(void *data, unsigned long size, unsigned long src, void *priv)
+{
+    if (memcmp(data, frag_data, size) != 0)
+    {
+        frag_errors++;
+    }
+    remote_rx_cb(data, (int)size, src, priv);
+}
+
+/* The master side only sends fragmented messages */
+static void master_frag_cb(void *data, unsigned long size, unsigned long src, void *priv)
+{
+}
+
+/* Frees what is received from the queue, and counts it like the remote endpoint callback */
+static void queue_task_fn(void *pvParameters)
+{
+    rpmsg_queue_msg_t msgs[RPMSG_BENCH_BURST];
+    int count, i;
+
+    for (;;)
+    {
+        if (queue_many)
+        {
+            count = rpmsg_queue_recv_many(rpmsg_remote, queue, msgs, RPMSG_BENCH_BURST, RL_BLOCK);
+        }
+        else
+        {
+            count = (rpmsg_queue_recv_nocopy(rpmsg_remote, queue, &msgs[0].src, (char **)&msgs[0].data, &msgs[0].len,
+                                             RL_BLOCK) == RL_SUCCESS) ? 1 : 0;
+        }
+        for (i = 0; i < count; i++)
+        {
+            rpmsg_queue_nocopy_free(rpmsg_remote, msgs[i].data);
+        }
+        received += (uint32_t)((count > 0) ? count : 0);
+        if (received >= notify_at)
+        {
+            xTaskNotifyGive(control_task);
+        }
+    }
+}
+
+static void wait_received(uint32_t count)
+{
+    notify_at = count;
+    while (received < count)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+/*!
+ * @brief Brings up both sides of a host rpmsg link.
+ */
+static void rpmsg_init(void)
+{
+    uint32_t n;
+
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    rpmsg_remote = rpmsg_lite_remote_init(rpmsg_shmem, RL_PLATFORM_HOST_REMOTE_LINK_ID, RL_NO_FLAGS);
+    rpmsg_master = rpmsg_lite_master_init(rpmsg_shmem, sizeof(rpmsg_shmem), RL_PLATFORM_HOST_MASTER_LINK_ID, RL_NO_FLAGS);
+    if ((!rpmsg_remote) || (!rpmsg_master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(rpmsg_remote))
+    {
+        vTaskDelay(1);
+    }
+
+    master_ept = rpmsg_lite_create_ept(rpmsg_master, RPMSG_BENCH_LOCAL_ADDR, RL_NULL, RL_NULL);
+    remote_ept = rpmsg_lite_create_ept(rpmsg_remote, RPMSG_BENCH_REMOTE_ADDR, remote_rx_cb, RL_NULL);
+    hold_ept = rpmsg_lite_create_ept(rpmsg_remote, RPMSG_BENCH_HOLD_ADDR, remote_hold_cb, RL_NULL);
+    master_frag = rpmsg_frag_create(rpmsg_master, RPMSG_BENCH_FRAG_LOCAL_ADDR, master_frag_cb, RL_NULL, RL_NULL, 0U);
+    remote_frag = rpmsg_frag_create(rpmsg_remote, RPMSG_BENCH_FRAG_REMOTE_ADDR, remote_frag_cb, RL_NULL, frag_arena,
+                                    sizeof(frag_arena));
+    if ((!master_frag) || (!remote_frag))
+    {
+        printf("rpmsg_frag create failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    queue = rpmsg_queue_create(rpmsg_remote);
+    queue_ept = queue ? rpmsg_lite_create_ept(rpmsg_remote, RPMSG_BENCH_QUEUE_ADDR, rpmsg_queue_rx_cb, queue) : RL_NULL;
+    if ((!queue_ept) || (xTaskCreate(queue_task_fn, "queue", configMINIMAL_STACK_SIZE, NULL,
+                                     RPMSG_BENCH_QUEUE_PRIORITY, NULL) != pdPASS))
+    {
+        printf("rpmsg_queue create failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+
+    for (n = 0U; n < RPMSG_BENCH_LONG_BATCH; n++)
+    {
+        burst_data[n] = message;
+        burst_size[n] = sizeof(message);
+    }
+    for (n = 0U; n < sizeof(frag_data); n++)
+    {
+        frag_data[n] = (char)(n * 7U);
+    }
+}
+
+/*!
+ * @brief Time from rpmsg_lite_send() on the master to the endpoint callback of the remote side,
+ * one message at a time.
+ */
+static void bench_rx_path(void)
+{
+    uint64_t start;
+    uint32_t n;
+
+    for (n = 0U; n < RPMSG_BENCH_ROUNDS; n++)
+    {
+        received = 0U;
+        start = bench_now_ns();
+        rpmsg_lite_send(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, message, sizeof(message), RL_BLOCK);
+        wait_received(1U);
+        samples[n] = (uint32_t)(received_ns - start);
+    }
+    printf("%-24s %8s %8s %8s %8s\r\n", "ns", "min", "p50", "p99", "max");
+    print_percentiles("send to rx callback", samples, RPMSG_BENCH_ROUNDS);
+}
+
+/*!
+ * @brief Sends RPMSG_BENCH_ROUNDS messages in bursts of the given count, with rpmsg_lite_send()
+ * or rpmsg_lite_send_batch(), waiting for each burst to be received.
+ */
+static uint64_t run_bursts(unsigned long dst, uint32_t count, int batch)
+{
+    uint64_t start;
+    uint32_t n, i;
+
+    received = 0U;
+    start = bench_now_ns();
+    for (n = 0U; n < RPMSG_BENCH_ROUNDS; n += count)
+    {
+        if (batch)
+        {
+            rpmsg_lite_send_batch(rpmsg_master, master_ept, dst, burst_data, burst_size, count, RL_BLOCK);
+        }
+        else
+        {
+            for (i = 0U; i < count; i++)
+            {
+                rpmsg_lite_send(rpmsg_master, master_ept, dst, message, sizeof(message), RL_BLOCK);
+            }
+        }
+        wait_received(n + count);
+    }
+
+    return (uint64_t)n * 1000000000ULL / (bench_now_ns() - start);
+}
+
+/*!
+ * @brief Messages/s of bursts of 1 to RPMSG_BENCH_BURST messages sent one by one, each with its own
+ * lock and notification, and with rpmsg_lite_send_batch(), one lock and one notification.
+ */
+static void bench_send_batch(void)
+{
+    uint64_t best[2], rate;
+    uint32_t n, run;
+    int batch, sent;
+
+    printf("%-8s %12s %12s\r\n", "burst", "send", "send_batch");
+    for (n = 0U; n < sizeof(burst_counts) / sizeof(burst_counts[0]); n++)
+    {
+        for (batch = 0; batch < 2; batch++)
+        {
+            best[batch] = 0U;
+            for (run = 0U; run < RPMSG_BENCH_RUNS; run++)
+            {
+                rate = run_bursts(RPMSG_BENCH_REMOTE_ADDR, burst_counts[n], batch);
+                best[batch] = (rate > best[batch]) ? rate : best[batch];
+            }
+        }
+        printf("%-8u %12u %12u\r\n", (unsigned)burst_counts[n], (unsigned)best[0], (unsigned)best[1]);
+    }
+
+    received = 0U;
+    sent = rpmsg_lite_send_batch(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, burst_data, burst_size,
+                                 RPMSG_BENCH_LONG_BATCH, RL_BLOCK);
+    wait_received((sent > 0) ? (uint32_t)sent : 0U);
+    printf("msgs/s, best of %u runs; batch of %u messages with %u tx buffers: %d sent, %u received\r\n",
+           (unsigned)RPMSG_BENCH_RUNS, (unsigned)RPMSG_BENCH_LONG_BATCH, (unsigned)RL_BUFFER_COUNT, sent,
+           (unsigned)received);
+}
+
+/*!
+ * @brief Messages/s received by a task through an rpmsg_queue, one at a time with
+ * rpmsg_queue_recv_nocopy() and in batches with rpmsg_queue_recv_many(), for bursts of 1 to
+ * RPMSG_BENCH_BURST messages sent with rpmsg_lite_send_batch().
+ */
+static void bench_queue(void)
+{
+    uint64_t best[2], rate;
+    uint32_t n, run;
+    int many;
+
+    printf("%-8s %12s %12s\r\n", "burst", "recv_nocopy", "recv_many");
+    for (n = 0U; n < sizeof(burst_counts) / sizeof(burst_counts[0]); n++)
+    {
+        for (many = 0; many < 2; many++)
+        {
+            queue_many = many;
+            best[many] = 0U;
+            for (run = 0U; run < RPMSG_BENCH_RUNS; run++)
+            {
+                rate = run_bursts(RPMSG_BENCH_QUEUE_ADDR, burst_counts[n], 1);
+                best[many] = (rate > best[many]) ? rate : best[many];
+            }
+        }
+        printf("%-8u %12u %12u\r\n", (unsigned)burst_counts[n], (unsigned)best[0], (unsigned)best[1]);
+    }
+    printf("msgs/s through an rpmsg_queue (%s), best of %u runs\r\n", RPMSG_BENCH_QUEUE_NAME,
+           (unsigned)RPMSG_BENCH_RUNS);
+}
+
+/*!
+ * @brief Receive time per message with 1 to RPMSG_BENCH_MAX_EPTS endpoints on the remote side.
+ *
+ * The messages go to the first endpoint created, the last one of its list. A burst is sent with
+ * rpmsg_lite_send_batch() and one notification, and the remote side receives it in one go, so the
+ * time between the first and the last callback is the receive cost of the other messages.
+ */
+static void bench_ept_lookup(void)
+{
+    uint32_t n, count, epts = 1U, rounds = RPMSG_BENCH_ROUNDS / RPMSG_BENCH_BURST;
+    char name[24];
+
+    printf("%-24s %8s %8s %8s %8s\r\n", "ns per message", "min", "p50", "p99", "max");
+    for (count = 0U; count < sizeof(ept_counts) / sizeof(ept_counts[0]); count++)
+    {
+        for (; epts < ept_counts[count]; epts++)
+        {
+            remote_epts[epts] =
+                rpmsg_lite_create_ept(rpmsg_remote, RPMSG_BENCH_REMOTE_ADDR + epts, remote_rx_cb, RL_NULL);
+        }
+
+        for (n = 0U; n < rounds; n++)
+        {
+            received = 0U;
+            rpmsg_lite_send_batch(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, burst_data, burst_size,
+                                  RPMSG_BENCH_BURST, RL_BLOCK);
+            wait_received(RPMSG_BENCH_BURST);
+            samples[n] = (uint32_t)((received_ns - received_first_ns) / (RPMSG_BENCH_BURST - 1U));
+        }
+        snprintf(name, sizeof(name), "receive, %u endpoints", (unsigned)epts);
+        print_percentiles(name, samples, rounds);
+    }
+
+    for (epts = 1U; epts < RPMSG_BENCH_MAX_EPTS; epts++)
+    {
+        rpmsg_lite_destroy_ept(rpmsg_remote, remote_epts[epts]);
+    }
+}
+
+/*!
+ * @brief Messages held by the remote endpoint callback (RL_HOLD) and released with
+ * rpmsg_lite_release_rx_buffer() in bursts of RPMSG_BENCH_HOLD_BURST.
+ *
+ * More messages are sent than there are rx buffers, so the released buffers must get back to
+ * the master. With RL_USE_CACHED_SHMEM the host platform records the cache range calls: their
+ * number per message, and the header of each released buffer must be written back, then
+ * invalidated, before anything else is done with the buffer, so that no dirty line is left in it.
+ */
+static void bench_hold(void)
+{
+    uint64_t start, ns;
+    uint32_t n, i, released = 0U, ordered = 0U;
+    unsigned long seq, flushes, invalidates;
+    struct platform_cache_op first, second;
+
+    flushes = platform_cache_op_count(RL_PLATFORM_CACHE_FLUSH);
+    invalidates = platform_cache_op_count(RL_PLATFORM_CACHE_INVALIDATE);
+    hold_next = 0U;
+    start = bench_now_ns();
+    for (n = 0U; n < RPMSG_BENCH_ROUNDS; n += RPMSG_BENCH_HOLD_BURST)
+    {
+        received = 0U;
+        held_count = 0U;
+        for (i = 0U; i < RPMSG_BENCH_HOLD_BURST; i++)
+        {
+            seq = n + i;
+            memcpy(message, &seq, sizeof(uint32_t));
+            rpmsg_lite_send(rpmsg_master, master_ept, RPMSG_BENCH_HOLD_ADDR, message, sizeof(message), RL_BLOCK);
+        }
+        wait_received(RPMSG_BENCH_HOLD_BURST);
+
+        for (i = 0U; i < held_count; i++)
+        {
+            seq = platform_cache_op_count(RL_PLATFORM_CACHE_FLUSH) +
+                  platform_cache_op_count(RL_PLATFORM_CACHE_INVALIDATE);
+            if (rpmsg_lite_release_rx_buffer(rpmsg_remote, held[i]) == RL_SUCCESS)
+            {
+                released++;
+            }
+            if ((platform_cache_get_op(seq, &first) == 0) && (platform_cache_get_op(seq + 1U, &second) == 0) &&
+                (first.op == RL_PLATFORM_CACHE_FLUSH) && (second.op == RL_PLATFORM_CACHE_INVALIDATE) &&
+                ((char *)first.addr + first.size == (char *)held[i]) && (second.addr == first.addr))
+            {
+                ordered++;
+            }
+        }
+    }
+    ns = bench_now_ns() - start;
+    flushes = platform_cache_op_count(RL_PLATFORM_CACHE_FLUSH) - flushes;
+    invalidates = platform_cache_op_count(RL_PLATFORM_CACHE_INVALIDATE) - invalidates;
+
+    printf("hold and release, %u messages in bursts of %u: %u ns per message, %u released, %u out of sequence\r\n",
+           (unsigned)n, (unsigned)RPMSG_BENCH_HOLD_BURST, (unsigned)(ns / n), (unsigned)released,
+           (unsigned)hold_errors);
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    printf("cache range calls per message, both sides: %lu.%02lu flushes, %lu.%02lu invalidates; "
+           "released headers written back, then invalidated: %u\r\n",
+           flushes / n, (flushes * 100U / n) % 100U, invalidates / n, (invalidates * 100U / n) % 100U,
+           (unsigned)ordered);
+#endif
+}
+
+/*!
+ * @brief Messages/s of bursts of RPMSG_BENCH_BURST messages of a few sizes, and the payload of
+ * the zero-copy tx buffers.
+ *
+ * With RL_USE_BUFFER_CLASSES each message takes the smallest free buffer it fits in, and messages
+ * larger than RL_BUFFER_PAYLOAD_SIZE can be sent. A zero-copy buffer may come from a larger class
+ * than RL_BUFFER_PAYLOAD_SIZE needs, rpmsg_lite_send_nocopy() must accept its whole payload and
+ * no more.
+ */
+static void bench_msg_size(void)
+{
+    uint64_t start, rate, best;
+    uint32_t n, i, run, sent;
+    unsigned long payload;
+    void *buffer;
+    int fits, over;
+
+    printf("%-24s %12s %12s\r\n", "message size", "msgs/s", "MB/s");
+    for (n = 0U; n < sizeof(msg_sizes) / sizeof(msg_sizes[0]); n++)
+    {
+        best = 0U;
+        for (run = 0U; run < RPMSG_BENCH_RUNS; run++)
+        {
+            received = 0U;
+            sent = 0U;
+            start = bench_now_ns();
+            for (i = 0U; i < RPMSG_BENCH_ROUNDS; i++)
+            {
+                if (rpmsg_lite_send(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, frag_data, msg_sizes[n],
+                                    RL_BLOCK) != RL_SUCCESS)
+                {
+                    break;
+                }
+                sent++;
+                if ((sent % RPMSG_BENCH_BURST) == 0U)
+                {
+                    wait_received(sent);
+                }
+            }
+            wait_received(sent);
+            rate = (sent == RPMSG_BENCH_ROUNDS) ? (uint64_t)sent * 1000000000ULL / (bench_now_ns() - start) : 0U;
+            best = (rate > best) ? rate : best;
+        }
+        if (best)
+        {
+            printf("%-24u %12u %12u\r\n", (unsigned)msg_sizes[n], (unsigned)best,
+                   (unsigned)(best * msg_sizes[n] / 1000000U));
+        }
+        else
+        {
+            printf("%-24u %12s %12s\r\n", (unsigned)msg_sizes[n], "too large", "-");
+        }
+    }
+
+    buffer = rpmsg_lite_alloc_tx_buffer(rpmsg_master, &payload, RL_BLOCK);
+    over = rpmsg_lite_send_nocopy(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, buffer, payload + 1U);
+    received = 0U;
+    fits = rpmsg_lite_send_nocopy(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, buffer, payload);
+    if (fits != RL_SUCCESS)
+    {
+        rpmsg_lite_release_tx_buffer(rpmsg_master, buffer);
+    }
+    wait_received((fits == RL_SUCCESS) ? 1U : 0U);
+    printf("msgs/s best of %u runs in bursts of %u; zero-copy buffer payload %lu: sent %s, one byte more %s\r\n",
+           (unsigned)RPMSG_BENCH_RUNS, (unsigned)RPMSG_BENCH_BURST, payload, (fits == RL_SUCCESS) ? "ok" : "failed",
+           (over == RL_ERR_BUFF_SIZE) ? "rejected" : "accepted");
+}
+
+/*!
+ * @brief MB/s of messages sent with rpmsg_frag_send(), which copies them once into the tx buffers,
+ * and reassembled in the arena of the remote side, which checks their content.
+ *
+ * Then all tx buffers are allocated and released unsent with rpmsg_lite_release_tx_buffer(),
+ * as rpmsg_frag_send() does when a fragment cannot be sent, and a message needing all of them
+ * is sent without waiting.
+ */
+static void bench_frag(void)
+{
+    uint64_t start, rate, best;
+    uint32_t n, count, run;
+    uint32_t allocated, released = 0U;
+    unsigned long size, payload;
+    int status;
+
+    /* The rpmsg header is larger on 64 bit hosts, the fragments take what the buffers have left */
+    tx_buffers[0] = rpmsg_lite_alloc_tx_buffer(rpmsg_master, &payload, RL_BLOCK);
+    rpmsg_lite_release_tx_buffer(rpmsg_master, tx_buffers[0]);
+    payload -= RPMSG_BENCH_FRAG_HDR_SIZE;
+
+    printf("%-24s %12s %12s\r\n", "fragmented message", "fragments", "MB/s");
+    for (n = 0U; n < sizeof(frag_sizes) / sizeof(frag_sizes[0]); n++)
+    {
+        count = RPMSG_BENCH_FRAG_BYTES / frag_sizes[n];
+        best = 0U;
+        for (run = 0U; run < RPMSG_BENCH_RUNS; run++)
+        {
+            received = 0U;
+            start = bench_now_ns();
+            for (size = 0U; size < count; size++)
+            {
+                rpmsg_frag_send(master_frag, RPMSG_BENCH_FRAG_REMOTE_ADDR, frag_data, frag_sizes[n], RL_BLOCK);
+            }
+            wait_received(count);
+            rate = (uint64_t)count * frag_sizes[n] * 1000ULL / (bench_now_ns() - start);
+            best = (rate > best) ? rate : best;
+        }
+        printf("%-24u %12u %12u\r\n", (unsigned)frag_sizes[n],
+               (unsigned)((frag_sizes[n] + payload - 1U) / payload),
+               (unsigned)best);
+    }
+
+    for (allocated = 0U; allocated < RL_BUFFER_COUNT; allocated++)
+    {
+        tx_buffers[allocated] = rpmsg_lite_alloc_tx_buffer(rpmsg_master, &size, RL_DONT_BLOCK);
+        if (!tx_buffers[allocated])
+        {
+            break;
+        }
+    }
+    for (n = 0U; n < allocated; n++)
+    {
+        released += (rpmsg_lite_release_tx_buffer(rpmsg_master, tx_buffers[n]) == RL_SUCCESS) ? 1U : 0U;
+    }
+    received = 0U;
+    size = (unsigned long)allocated * payload;
+    status = rpmsg_frag_send(master_frag, RPMSG_BENCH_FRAG_REMOTE_ADDR, frag_data,
+                             (size < sizeof(frag_data)) ? size : sizeof(frag_data), RL_DONT_BLOCK);
+    wait_received((status == RL_SUCCESS) ? 1U : 0U);
+    printf("MB/s best of %u runs, %u content errors; %u tx buffers released unsent, then sent: %s\r\n",
+           (unsigned)RPMSG_BENCH_RUNS, (unsigned)frag_errors, (unsigned)released,
+           (status == RL_SUCCESS) ? "ok" : "failed");
+}
+
+/*!
+ * @brief Deinitializes the remote side with messages still queued for it, then the master side.
+ *
+ * With the rx worker, the sender runs at the priority of the worker, so the worker has been
+ * woken up but has not processed the messages when it is asked to stop.
+ */
+static void bench_deinit(void)
+{
+    uint32_t n;
+
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+    vTaskPrioritySet(NULL, RL_RX_WORKER_PRIORITY);
+#endif
+    received = 0U;
+    for (n = 0U; n < RPMSG_BENCH_BURST; n++)
+    {
+        rpmsg_lite_send(rpmsg_master, master_ept, RPMSG_BENCH_REMOTE_ADDR, message, sizeof(message), RL_BLOCK);
+    }
+
+    if ((rpmsg_lite_deinit(rpmsg_remote) != RL_SUCCESS) || (rpmsg_lite_deinit(rpmsg_master) != RL_SUCCESS))
+    {
+        printf("deinit failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    printf("deinit with %u messages sent: ok, %u received\r\n", (unsigned)RPMSG_BENCH_BURST, (unsigned)received);
+}
+
+static void control_task_fn(void *pvParameters)
+{
+    printf("FreeRTOS %s rpmsg-lite %s receive benchmark, %u messages of %u bytes\r\n", tskKERNEL_VERSION_NUMBER,
+           RPMSG_BENCH_RX_NAME, (unsigned)RPMSG_BENCH_ROUNDS, (unsigned)RPMSG_BENCH_MSG_SIZE);
+    printf("endpoint lookup table of %u buckets, %s\r\n", (unsigned)RL_EPT_LUT_SIZE, RPMSG_BENCH_BUFFERS_NAME);
+
+    rpmsg_init();
+    bench_rx_path();
+    bench_send_batch();
+    bench_queue();
+    bench_ept_lookup();
+    bench_hold();
+    bench_msg_size();
+    bench_frag();
+    bench_deinit();
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, RPMSG_BENCH_CONTROL_PRIORITY,
+                    &control_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Control messages per latency measurement */
+#ifndef RPMSG_LINK_BENCH_ROUNDS
+#define RPMSG_LINK_BENCH_ROUNDS (1000U)
+#endif
+
+#define RPMSG_LINK_BENCH_MSG_SIZE (64U)
+
+/* Time the bulk endpoint callback spends on each message */
+#define RPMSG_LINK_BENCH_BULK_WORK_NS (20000U)
+
+/* The control task may preempt the bulk link, the bulk sender keeps it busy when nothing else runs */
+#define RPMSG_LINK_BENCH_CONTROL_PRIORITY (3U)
+#define RPMSG_LINK_BENCH_BULK_PRIORITY (1U)
+
+/* Links 0 and 1 carry the bulk traffic, links 2 and 3 the control messages, see rpmsg_config.h */
+#define RPMSG_LINK_BENCH_BULK_MASTER_LINK_ID (RL_PLATFORM_HOST_MASTER_LINK_ID)
+#define RPMSG_LINK_BENCH_BULK_REMOTE_LINK_ID (RL_PLATFORM_HOST_REMOTE_LINK_ID)
+#define RPMSG_LINK_BENCH_CONTROL_MASTER_LINK_ID (2)
+#define RPMSG_LINK_BENCH_CONTROL_REMOTE_LINK_ID (3)
+
+/* Both sides of each rpmsg link run on the host, see the host rpmsg platform */
+#define RPMSG_LINK_BENCH_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define RPMSG_LINK_BENCH_LOCAL_ADDR (30U)
+#define RPMSG_LINK_BENCH_REMOTE_ADDR (31U)
+
+#if defined(RL_HOST_BULK_LINK_PRIORITY)
+#define RPMSG_LINK_BENCH_NAME "bulk link rx worker below the control link"
+#else
+#define RPMSG_LINK_BENCH_NAME "rx workers of the same priority"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t bulk_shmem[RPMSG_LINK_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static uint8_t control_shmem[RPMSG_LINK_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *bulk_master;
+static struct rpmsg_lite_instance *bulk_remote;
+static struct rpmsg_lite_instance *control_master;
+static struct rpmsg_lite_instance *control_remote;
+static struct rpmsg_lite_endpoint *bulk_master_ept;
+static struct rpmsg_lite_endpoint *control_master_ept;
+static TaskHandle_t control_task;
+static TaskHandle_t bulk_task;
+
+static char message[RPMSG_LINK_BENCH_MSG_SIZE];
+static uint32_t samples[RPMSG_LINK_BENCH_ROUNDS];
+
+/* Updated by the control endpoint callback */
+static volatile uint64_t control_received_ns;
+/* Updated by the bulk endpoint callback, the bulk sender stops once bulk_stop is set */
+static volatile uint32_t bulk_received;
+static volatile int bulk_stop;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*!
+ * @brief Sorts the samples and prints the minimum, median, p99 and maximum.
+ */
+static void print_percentiles(const char *name, uint32_t *values, uint32_t count)
+{
+    qsort(values, count, sizeof(values[0]), compare_samples);
+    printf("%-24s %8u %8u %8u %8u\r\n", name, (unsigned)values[0], (unsigned)values[count / 2U],
+           (unsigned)values[(count * 99U) / 100U], (unsigned)values[count - 1U]);
+}
+
+/* Runs in the rx worker of the remote side of the bulk link, each message takes a while */
+static int bulk_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    uint64_t end = bench_now_ns() + RPMSG_LINK_BENCH_BULK_WORK_NS;
+
+    while (bench_now_ns() < end)
+    {
+    }
+    bulk_received++;
+
+    return RL_RELEASE;
+}
+
+/* Runs in the rx worker of the remote side of the control link */
+static int control_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    control_received_ns = bench_now_ns();
+    xTaskNotifyGive(control_task);
+
+    return RL_RELEASE;
+}
+
+/*!
+ * @brief Brings up both sides of a host rpmsg link.
+ */
+static void link_init(void *shmem,
+                      int master_link_id,
+                      int remote_link_id,
+                      struct rpmsg_lite_instance **master,
+                      struct rpmsg_lite_instance **remote,
+                      struct rpmsg_lite_endpoint **master_ept,
+                      rl_ept_rx_cb_t rx_cb)
+{
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    *remote = rpmsg_lite_remote_init(shmem, remote_link_id, RL_NO_FLAGS);
+    *master = rpmsg_lite_master_init(shmem, RPMSG_LINK_BENCH_SHMEM_SIZE, master_link_id, RL_NO_FLAGS);
+    if ((!*remote) || (!*master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(*remote))
+    {
+        vTaskDelay(1);
+    }
+
+    *master_ept = rpmsg_lite_create_ept(*master, RPMSG_LINK_BENCH_LOCAL_ADDR, RL_NULL, RL_NULL);
+    if ((!*master_ept) || (!rpmsg_lite_create_ept(*remote, RPMSG_LINK_BENCH_REMOTE_ADDR, rx_cb, RL_NULL)))
+    {
+        printf("rpmsg endpoint create failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+}
+
+/* Keeps the bulk link busy until bulk_stop is set */
+static void bulk_task_fn(void *pvParameters)
+{
+    while (!bulk_stop)
+    {
+        rpmsg_lite_send(bulk_master, bulk_master_ept, RPMSG_LINK_BENCH_REMOTE_ADDR, message, sizeof(message),
+                        RL_BLOCK);
+    }
+    xTaskNotifyGive(control_task);
+    vTaskDelete(NULL);
+}
+
+/*!
+ * @brief Time from rpmsg_lite_send() on the master side of the control link to the endpoint
+ * callback of its remote side, one message per tick.
+ */
+static void bench_control(const char *name)
+{
+    uint64_t start;
+    uint32_t n;
+
+    for (n = 0U; n < RPMSG_LINK_BENCH_ROUNDS; n++)
+    {
+        /* The messages are sent at a tick, anywhere in the work of the bulk link */
+        vTaskDelay(1);
+        start = bench_now_ns();
+        rpmsg_lite_send(control_master, control_master_ept, RPMSG_LINK_BENCH_REMOTE_ADDR, message, sizeof(message),
+                        RL_BLOCK);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        samples[n] = (uint32_t)(control_received_ns - start);
+    }
+    print_percentiles(name, samples, RPMSG_LINK_BENCH_ROUNDS);
+}
+
+static void control_task_fn(void *pvParameters)
+{
+    uint64_t start, ns;
+    uint32_t received;
+
+    printf("FreeRTOS %s rpmsg-lite link priority benchmark, %s\r\n", tskKERNEL_VERSION_NUMBER, RPMSG_LINK_BENCH_NAME);
+    printf("rx worker priority: bulk link %u, control link %u\r\n",
+           (unsigned)RL_RX_WORKER_LINK_PRIORITY(RPMSG_LINK_BENCH_BULK_REMOTE_LINK_ID),
+           (unsigned)RL_RX_WORKER_LINK_PRIORITY(RPMSG_LINK_BENCH_CONTROL_REMOTE_LINK_ID));
+
+    link_init(bulk_shmem, RPMSG_LINK_BENCH_BULK_MASTER_LINK_ID, RPMSG_LINK_BENCH_BULK_REMOTE_LINK_ID, &bulk_master,
+              &bulk_remote, &bulk_master_ept, bulk_rx_cb);
+    link_init(control_shmem, RPMSG_LINK_BENCH_CONTROL_MASTER_LINK_ID, RPMSG_LINK_BENCH_CONTROL_REMOTE_LINK_ID,
+              &control_master, &control_remote, &control_master_ept, control_rx_cb);
+
+    printf("%-24s %8s %8s %8s %8s\r\n", "control message, ns", "min", "p50", "p99", "max");
+    bench_control("idle bulk link");
+
+    if (xTaskCreate(bulk_task_fn, "bulk", configMINIMAL_STACK_SIZE, NULL, RPMSG_LINK_BENCH_BULK_PRIORITY,
+                    &bulk_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    start = bench_now_ns();
+    received = bulk_received;
+    bench_control("busy bulk link");
+    ns = bench_now_ns() - start;
+    received = bulk_received - received;
+
+    bulk_stop = 1;
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    printf("%u control messages each; bulk link meanwhile: %u msgs/s, %u ns of work per message\r\n",
+           (unsigned)RPMSG_LINK_BENCH_ROUNDS, (unsigned)((uint64_t)received * 1000000000ULL / ns),
+           (unsigned)RPMSG_LINK_BENCH_BULK_WORK_NS);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, RPMSG_LINK_BENCH_CONTROL_PRIORITY,
+                    &control_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
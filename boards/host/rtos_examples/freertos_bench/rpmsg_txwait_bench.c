@@ -0,0 +1,275 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Wakeups per latency measurement */
+#ifndef RPMSG_TXWAIT_BENCH_ROUNDS
+#define RPMSG_TXWAIT_BENCH_ROUNDS (1000U)
+#endif
+
+#define RPMSG_TXWAIT_BENCH_MSG_SIZE (64U)
+
+/* The peer returns a buffer anywhere in the tick, up to this long after it */
+#define RPMSG_TXWAIT_BENCH_RELEASE_SPREAD_NS (900000U)
+
+/* The senders preempt the peer task as soon as they are woken up */
+#define RPMSG_TXWAIT_BENCH_SENDER_PRIORITY (3U)
+#define RPMSG_TXWAIT_BENCH_LOW_SENDER_PRIORITY (2U)
+#define RPMSG_TXWAIT_BENCH_PEER_PRIORITY (1U)
+
+/* Both sides of the rpmsg link run on the host, see the host rpmsg platform */
+#define RPMSG_TXWAIT_BENCH_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define RPMSG_TXWAIT_BENCH_LOCAL_ADDR (40U)
+#define RPMSG_TXWAIT_BENCH_REMOTE_ADDR (41U)
+
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+#define RPMSG_TXWAIT_BENCH_NAME "senders sleep on the tx wait event"
+#else
+#define RPMSG_TXWAIT_BENCH_NAME "senders poll every RL_MS_PER_INTERVAL ms"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t shmem[RPMSG_TXWAIT_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *master;
+static struct rpmsg_lite_instance *remote;
+static struct rpmsg_lite_endpoint *master_ept;
+static TaskHandle_t sender_task;
+static TaskHandle_t low_sender_task;
+static TaskHandle_t peer_task;
+
+static uint32_t samples[RPMSG_TXWAIT_BENCH_ROUNDS];
+
+/* Messages held by the remote endpoint callback, returned one by one by the peer task */
+static void *held[RL_BUFFER_COUNT];
+static volatile uint32_t held_head;
+static uint32_t held_tail;
+
+/* Set by the peer task right before it returns a buffer */
+static volatile uint64_t release_ns;
+/* Order in which the senders got their buffer in the fairness check */
+static volatile uint32_t wake_order[2];
+static volatile uint32_t wake_count;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*!
+ * @brief Sorts the samples and prints the minimum, median, p99 and maximum.
+ */
+static void print_percentiles(const char *name, uint32_t *values, uint32_t count)
+{
+    qsort(values, count, sizeof(values[0]), compare_samples);
+    printf("%-24s %8u %8u %8u %8u\r\n", name, (unsigned)values[0], (unsigned)values[count / 2U],
+           (unsigned)values[(count * 99U) / 100U], (unsigned)values[count - 1U]);
+}
+
+/* Runs in the mailbox task, keeps every message so that the master runs out of tx buffers */
+static int remote_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    held[held_head % RL_BUFFER_COUNT] = payload;
+    held_head++;
+
+    return RL_HOLD;
+}
+
+/*!
+ * @brief Returns the oldest held message to the master side, which notifies it.
+ */
+static void release_one(void)
+{
+    configASSERT(held_tail != held_head);
+    release_ns = bench_now_ns();
+    rpmsg_lite_release_rx_buffer(remote, held[held_tail % RL_BUFFER_COUNT]);
+    held_tail++;
+}
+
+/*!
+ * @brief Waits for a tx buffer and sends it, returns the time from the buffer release to the wakeup.
+ */
+static uint32_t send_blocking(void)
+{
+    unsigned long size;
+    void *buffer;
+    uint32_t ns;
+
+    buffer = rpmsg_lite_alloc_tx_buffer(master, &size, RL_BLOCK);
+    ns = (uint32_t)(bench_now_ns() - release_ns);
+    configASSERT(buffer);
+    rpmsg_lite_send_nocopy(master, master_ept, RPMSG_TXWAIT_BENCH_REMOTE_ADDR, buffer, RPMSG_TXWAIT_BENCH_MSG_SIZE);
+
+    return ns;
+}
+
+static void low_sender_task_fn(void *pvParameters)
+{
+    send_blocking();
+    wake_order[wake_count++] = RPMSG_TXWAIT_BENCH_LOW_SENDER_PRIORITY;
+    xTaskNotifyGive(peer_task);
+    vTaskDelete(NULL);
+}
+
+/*!
+ * @brief Fairness check: two senders blocked, the buffers returned one by one go to the higher priority first.
+ */
+static int bench_fairness(void)
+{
+    if (xTaskCreate(low_sender_task_fn, "low sender", configMINIMAL_STACK_SIZE, NULL,
+                    RPMSG_TXWAIT_BENCH_LOW_SENDER_PRIORITY, &low_sender_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    /* Both senders run and block before the peer task runs again */
+    xTaskNotifyGive(sender_task);
+    vTaskDelay(2);
+
+    release_one();
+    vTaskDelay(2);
+    release_one();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    return (wake_count == 2U) && (wake_order[0] == RPMSG_TXWAIT_BENCH_SENDER_PRIORITY) &&
+           (wake_order[1] == RPMSG_TXWAIT_BENCH_LOW_SENDER_PRIORITY);
+}
+
+/* The peer core: returns one buffer per round, at a varying point of the tick */
+static void peer_task_fn(void *pvParameters)
+{
+    uint64_t end;
+    uint32_t n;
+
+    for (n = 0U; n < RPMSG_TXWAIT_BENCH_ROUNDS; n++)
+    {
+        /* The sender has the higher priority, it is blocked on the empty pool by now */
+        vTaskDelay(1);
+        end = bench_now_ns() + (uint64_t)(rand() % RPMSG_TXWAIT_BENCH_RELEASE_SPREAD_NS);
+        while (bench_now_ns() < end)
+        {
+        }
+        release_one();
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    print_percentiles("wakeup after release, ns", samples, RPMSG_TXWAIT_BENCH_ROUNDS);
+    printf("%u wakeups, tick %u ns; higher priority sender woken first: %s\r\n", (unsigned)RPMSG_TXWAIT_BENCH_ROUNDS,
+           (unsigned)(1000000000U / configTICK_RATE_HZ), bench_fairness() ? "yes" : "NO");
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+static void sender_task_fn(void *pvParameters)
+{
+    unsigned long size;
+    void *buffer;
+    uint32_t n, pool = 0U;
+
+    printf("FreeRTOS %s rpmsg-lite tx buffer wait benchmark, %s\r\n", tskKERNEL_VERSION_NUMBER, RPMSG_TXWAIT_BENCH_NAME);
+
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    remote = rpmsg_lite_remote_init(shmem, RL_PLATFORM_HOST_REMOTE_LINK_ID, RL_NO_FLAGS);
+    master = rpmsg_lite_master_init(shmem, RPMSG_TXWAIT_BENCH_SHMEM_SIZE, RL_PLATFORM_HOST_MASTER_LINK_ID, RL_NO_FLAGS);
+    if ((!remote) || (!master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(remote))
+    {
+        vTaskDelay(1);
+    }
+    master_ept = rpmsg_lite_create_ept(master, RPMSG_TXWAIT_BENCH_LOCAL_ADDR, RL_NULL, RL_NULL);
+    if ((!master_ept) || (!rpmsg_lite_create_ept(remote, RPMSG_TXWAIT_BENCH_REMOTE_ADDR, remote_rx_cb, RL_NULL)))
+    {
+        printf("rpmsg endpoint create failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+
+    /* Drain the tx pool, the remote side holds every message */
+    while ((buffer = rpmsg_lite_alloc_tx_buffer(master, &size, RL_DONT_BLOCK)) != RL_NULL)
+    {
+        rpmsg_lite_send_nocopy(master, master_ept, RPMSG_TXWAIT_BENCH_REMOTE_ADDR, buffer, RPMSG_TXWAIT_BENCH_MSG_SIZE);
+        pool++;
+    }
+    printf("tx pool of %u buffers drained\r\n", (unsigned)pool);
+    printf("%-24s %8s %8s %8s %8s\r\n", "", "min", "p50", "p99", "max");
+
+    if (xTaskCreate(peer_task_fn, "peer", configMINIMAL_STACK_SIZE, NULL, RPMSG_TXWAIT_BENCH_PEER_PRIORITY,
+                    &peer_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+
+    for (n = 0U; n < RPMSG_TXWAIT_BENCH_ROUNDS; n++)
+    {
+        samples[n] = send_blocking();
+    }
+    xTaskNotifyGive(peer_task);
+
+    /* Fairness check, blocked again along with the low priority sender */
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    send_blocking();
+    wake_order[wake_count++] = RPMSG_TXWAIT_BENCH_SENDER_PRIORITY;
+
+    vTaskSuspend(NULL);
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(sender_task_fn, "sender", configMINIMAL_STACK_SIZE, NULL, RPMSG_TXWAIT_BENCH_SENDER_PRIORITY,
+                    &sender_task) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
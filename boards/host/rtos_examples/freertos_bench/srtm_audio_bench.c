@@ -0,0 +1,320 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+#include "rpmsg_queue.h"
+#include "srtm_dispatcher.h"
+#include "srtm_peercore.h"
+#include "srtm_message.h"
+#include "srtm_message_struct.h"
+#include "srtm_audio_service.h"
+#include "srtm_rpmsg_endpoint.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Seconds of audio played per configuration */
+#ifndef SRTM_AUDIO_BENCH_SECONDS
+#define SRTM_AUDIO_BENCH_SECONDS (10U)
+#endif
+
+/* 48 kHz S16_LE stereo */
+#define SRTM_AUDIO_BENCH_SRATE (48000U)
+#define SRTM_AUDIO_BENCH_FORMAT (0U)
+#define SRTM_AUDIO_BENCH_CHANNELS (2U)
+#define SRTM_AUDIO_BENCH_FRAME_SIZE (4U)
+#define SRTM_AUDIO_BENCH_BUF_PERIODS (16U)
+
+/* The period done "ISR" is a task below the dispatcher, each period done is handled before the next one */
+#define SRTM_AUDIO_BENCH_CONTROL_PRIORITY (2U)
+#define SRTM_AUDIO_BENCH_DISPATCHER_PRIORITY (3U)
+
+/* Both sides of the rpmsg link run on the host, see the host rpmsg platform */
+#define SRTM_AUDIO_BENCH_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define SRTM_AUDIO_BENCH_SRTM_ADDR (40U)
+#define SRTM_AUDIO_BENCH_LOCAL_ADDR (41U)
+
+/* The audio protocol, see srtm_audio_service.c */
+#define SRTM_AUDIO_BENCH_CATEGORY (0x3U)
+#define SRTM_AUDIO_BENCH_VERSION (0x0102U)
+#define SRTM_AUDIO_BENCH_CMD_TX_OPEN (0x0U)
+#define SRTM_AUDIO_BENCH_CMD_TX_START (0x1U)
+#define SRTM_AUDIO_BENCH_CMD_TX_PAUSE (0x2U)
+#define SRTM_AUDIO_BENCH_CMD_TX_STOP (0x4U)
+#define SRTM_AUDIO_BENCH_CMD_TX_SET_PARAM (0x6U)
+#define SRTM_AUDIO_BENCH_CMD_TX_SET_BUF (0x7U)
+
+typedef struct _srtm_audio_bench_config
+{
+    uint32_t periodFrames;
+    uint32_t coalesce;
+    uint32_t maxLatencyMs;
+} srtm_audio_bench_config_t;
+
+SRTM_PACKED_BEGIN struct _srtm_audio_bench_packet
+{
+    srtm_packet_head_t head;
+    struct _srtm_audio_payload payload;
+} SRTM_PACKED_END;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* 1.3, 5.3 and 21.3 ms periods; each without coalescing, every 4 periods, and every 16 periods up to 20 ms */
+static const srtm_audio_bench_config_t configs[] = {
+    {64U, 1U, 0U}, {64U, 4U, 0U}, {64U, 16U, 20U}, {256U, 1U, 0U},  {256U, 4U, 0U},
+    {256U, 16U, 20U}, {1024U, 1U, 0U}, {1024U, 4U, 0U}, {1024U, 16U, 20U},
+};
+
+static uint8_t rpmsg_shmem[SRTM_AUDIO_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *rpmsg_master;
+static struct rpmsg_lite_instance *rpmsg_remote;
+static struct rpmsg_lite_endpoint *rpmsg_ept;
+static rpmsg_queue_handle rpmsg_q;
+static srtm_service_t audio_service;
+static struct _srtm_sai_adapter sai_adapter;
+static uint8_t audio_buf[SRTM_AUDIO_BENCH_BUF_PERIODS * 1024U * SRTM_AUDIO_BENCH_FRAME_SIZE];
+
+/* Notifications seen by the peer core, and the period index of the last one */
+static volatile uint32_t notifications;
+static volatile uint32_t notified_idx;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* The SAI adapter only accepts the commands, the benchmark plays the DMA interrupts */
+static srtm_status_t sai_command(srtm_sai_adapter_t adapter, srtm_audio_dir_t dir, uint8_t index)
+{
+    return SRTM_Status_Success;
+}
+
+static srtm_status_t sai_set_param(
+    srtm_sai_adapter_t adapter, srtm_audio_dir_t dir, uint8_t index, uint8_t format, uint8_t channels, uint32_t srate)
+{
+    return SRTM_Status_Success;
+}
+
+static srtm_status_t sai_set_buf(srtm_sai_adapter_t adapter,
+                                 srtm_audio_dir_t dir,
+                                 uint8_t index,
+                                 uint8_t *bufAddr,
+                                 uint32_t bufSize,
+                                 uint32_t periodSize,
+                                 uint32_t periodIdx)
+{
+    return SRTM_Status_Success;
+}
+
+/* Peer core endpoint: counts the notifications, queues the responses */
+static int peer_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    struct _srtm_audio_bench_packet *packet = (struct _srtm_audio_bench_packet *)payload;
+
+    if (packet->head.type == SRTM_MessageTypeNotification)
+    {
+        notifications++;
+        notified_idx = packet->payload.periodIdx;
+        return RL_RELEASE;
+    }
+
+    return rpmsg_queue_rx_cb(payload, payload_len, src, priv);
+}
+
+static void srtm_dispatcher_task(void *pvParameters)
+{
+    srtm_dispatcher_t disp = SRTM_Dispatcher_Create();
+    srtm_peercore_t core;
+    srtm_rpmsg_endpoint_config_t config = {0};
+
+    core = SRTM_PeerCore_Create(1U);
+    config.rpmsgHandle = rpmsg_remote;
+    config.localAddr = SRTM_AUDIO_BENCH_SRTM_ADDR;
+    config.peerAddr = RL_ADDR_ANY;
+
+    SRTM_PeerCore_SetState(core, SRTM_PeerCore_State_Activated);
+    SRTM_PeerCore_AddChannel(core, SRTM_RPMsgEndpoint_Create(&config));
+    SRTM_Dispatcher_AddPeerCore(disp, core);
+    SRTM_Dispatcher_RegisterService(disp, audio_service);
+
+    SRTM_Dispatcher_Start(disp);
+    SRTM_Dispatcher_Run(disp);
+}
+
+/*!
+ * @brief Brings up both sides of a host rpmsg link and the audio service on the remote side.
+ */
+static void rpmsg_init(void)
+{
+    sai_adapter.open = sai_command;
+    sai_adapter.start = sai_command;
+    sai_adapter.pause = sai_command;
+    sai_adapter.stop = sai_command;
+    sai_adapter.setParam = sai_set_param;
+    sai_adapter.setBuf = sai_set_buf;
+    audio_service = SRTM_AudioService_Create(&sai_adapter, NULL);
+
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    rpmsg_remote = rpmsg_lite_remote_init(rpmsg_shmem, RL_PLATFORM_HOST_REMOTE_LINK_ID, RL_NO_FLAGS);
+    rpmsg_master = rpmsg_lite_master_init(rpmsg_shmem, sizeof(rpmsg_shmem), RL_PLATFORM_HOST_MASTER_LINK_ID, RL_NO_FLAGS);
+    if ((!rpmsg_remote) || (!rpmsg_master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(rpmsg_remote))
+    {
+        vTaskDelay(1);
+    }
+
+    rpmsg_q = rpmsg_queue_create(rpmsg_master);
+    rpmsg_ept = rpmsg_lite_create_ept(rpmsg_master, SRTM_AUDIO_BENCH_LOCAL_ADDR, peer_rx_cb, rpmsg_q);
+
+    xTaskCreate(srtm_dispatcher_task, "srtm", configMINIMAL_STACK_SIZE * 2U, NULL,
+                SRTM_AUDIO_BENCH_DISPATCHER_PRIORITY, NULL);
+    /* Let the remote side create its endpoint */
+    vTaskDelay(10);
+}
+
+/*!
+ * @brief Sends an audio request on behalf of the peer core and waits for the response.
+ */
+static void audio_request(uint8_t command, struct _srtm_audio_payload *payload)
+{
+    struct _srtm_audio_bench_packet request = {0};
+    struct _srtm_audio_bench_packet response;
+    unsigned long src;
+    int len;
+
+    request.head.category = SRTM_AUDIO_BENCH_CATEGORY;
+    request.head.majorVersion = SRTM_MESSAGE_MAJOR_VERSION(SRTM_AUDIO_BENCH_VERSION);
+    request.head.minorVersion = SRTM_MESSAGE_MINOR_VERSION(SRTM_AUDIO_BENCH_VERSION);
+    request.head.type = SRTM_MessageTypeRequest;
+    request.head.command = command;
+    if (payload)
+    {
+        request.payload = *payload;
+    }
+
+    rpmsg_lite_send(rpmsg_master, rpmsg_ept, SRTM_AUDIO_BENCH_SRTM_ADDR, (char *)&request, sizeof(request), RL_BLOCK);
+    rpmsg_queue_recv(rpmsg_master, rpmsg_q, &src, (char *)&response, sizeof(response), &len, RL_BLOCK);
+    if (response.payload.retCode != 0U)
+    {
+        printf("audio command %u failed!\r\n", (unsigned)command);
+        vAssertCalled(__FILE__, __LINE__);
+    }
+}
+
+/*!
+ * @brief Plays SRTM_AUDIO_BENCH_SECONDS of audio and returns the number of period done.
+ *
+ * The peer core sets up the stream as the Linux driver does, then the benchmark calls the period
+ * done callback of the audio service as the DMA interrupt would. The stream is paused at the end,
+ * which sends the period done held back by the coalescing.
+ */
+static uint32_t run_config(const srtm_audio_bench_config_t *config)
+{
+    struct _srtm_audio_payload payload = {0};
+    uint32_t periodSize = config->periodFrames * SRTM_AUDIO_BENCH_FRAME_SIZE;
+    uint32_t periods = SRTM_AUDIO_BENCH_SECONDS * SRTM_AUDIO_BENCH_SRATE / config->periodFrames;
+    uint32_t n;
+
+    SRTM_AudioService_SetPeriodDoneCoalescing(audio_service, config->coalesce, config->maxLatencyMs);
+
+    payload.format = SRTM_AUDIO_BENCH_FORMAT;
+    payload.channels = SRTM_AUDIO_BENCH_CHANNELS;
+    payload.srate = SRTM_AUDIO_BENCH_SRATE;
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_SET_PARAM, &payload);
+
+    payload.bufAddr = (uint32_t)(uintptr_t)audio_buf;
+    payload.bufSize = SRTM_AUDIO_BENCH_BUF_PERIODS * periodSize;
+    payload.periodSize = periodSize;
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_SET_BUF, &payload);
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_START, &payload);
+
+    notifications = 0U;
+    rpmsg_lite_reset_stats(rpmsg_remote);
+    for (n = 0U; n < periods; n++)
+    {
+        sai_adapter.periodDone(sai_adapter.service, SRTM_AudioDirTx, 0U, (n + 1U) % SRTM_AUDIO_BENCH_BUF_PERIODS);
+    }
+
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_PAUSE, &payload);
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_STOP, &payload);
+
+    return periods;
+}
+
+/*!
+ * @brief Measures the period done notifications and peer core interrupts per second of 48 kHz audio.
+ */
+static void control_task_fn(void *pvParameters)
+{
+    struct rpmsg_lite_stats stats;
+    struct _srtm_audio_payload payload = {0};
+    uint32_t n, periods, latency;
+    uint32_t mismatches = 0U;
+
+    printf("FreeRTOS %s SRTM audio period done benchmark, %u s of 48 kHz S16_LE stereo\r\n", tskKERNEL_VERSION_NUMBER,
+           (unsigned)SRTM_AUDIO_BENCH_SECONDS);
+    printf("%-8s %8s %9s %9s %13s %10s\r\n", "period", "coalesce", "latency", "periods/s", "notifications", "A53 irq/s");
+
+    rpmsg_init();
+    audio_request(SRTM_AUDIO_BENCH_CMD_TX_OPEN, &payload);
+
+    for (n = 0U; n < sizeof(configs) / sizeof(configs[0]); n++)
+    {
+        periods = run_config(&configs[n]);
+        rpmsg_lite_get_stats(rpmsg_remote, &stats);
+        /* The last notification, sent on pause, has the last period index */
+        if (notified_idx != periods % SRTM_AUDIO_BENCH_BUF_PERIODS)
+        {
+            mismatches++;
+        }
+        latency = configs[n].maxLatencyMs;
+        printf("%-8u %8u %7u%2s %9u %13u %10u\r\n", (unsigned)configs[n].periodFrames, (unsigned)configs[n].coalesce,
+               (unsigned)latency, latency ? "ms" : "  ", (unsigned)(periods / SRTM_AUDIO_BENCH_SECONDS),
+               (unsigned)(notifications / SRTM_AUDIO_BENCH_SECONDS), (unsigned)(stats.kicks / SRTM_AUDIO_BENCH_SECONDS));
+    }
+
+    printf("period in frames, latency 0 for no limit, rates per second; last period index mismatches: %u\r\n",
+           (unsigned)mismatches);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, SRTM_AUDIO_BENCH_CONTROL_PRIORITY,
+                    NULL) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
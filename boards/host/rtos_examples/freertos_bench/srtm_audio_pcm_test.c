@@ -0,0 +1,401 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Middleware includes. */
+#include "srtm_audio_pcm.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Random buffers checked against the reference per kernel and format */
+#ifndef PCM_TEST_ROUNDS
+#define PCM_TEST_ROUNDS (2000U)
+#endif
+
+/* Longest random buffer, in samples: odd lengths check the tails of the SIMD loops */
+#define PCM_TEST_MAX_SAMPLES (67U)
+
+#define PCM_TEST_MAX_CHANNELS (4U)
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+#define PCM_TEST_NAME "SIMD"
+#else
+#define PCM_TEST_NAME "C reference"
+#endif
+
+#define PCM_TEST_COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+/* The kernels take 4 bytes aligned buffers */
+#define PCM_TEST_ALIGN __attribute__((aligned(4)))
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const srtm_audio_pcm_format_t formats[] = {SRTM_AudioPcmS16, SRTM_AudioPcmS24, SRTM_AudioPcmS32};
+static const char *const format_names[] = {"S16", "S24", "S32"};
+
+/* 32 bit words keep the buffers 4 bytes aligned */
+static uint32_t src_buf[PCM_TEST_MAX_CHANNELS][PCM_TEST_MAX_SAMPLES * PCM_TEST_MAX_CHANNELS];
+static uint32_t dst_buf[PCM_TEST_MAX_CHANNELS][PCM_TEST_MAX_SAMPLES * PCM_TEST_MAX_CHANNELS];
+static uint32_t ref_buf[PCM_TEST_MAX_CHANNELS][PCM_TEST_MAX_SAMPLES * PCM_TEST_MAX_CHANNELS];
+
+static uint32_t checks;
+static uint32_t failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static int32_t ref_get(const void *buf, srtm_audio_pcm_format_t format, uint32_t i)
+{
+    int32_t value = format == SRTM_AudioPcmS16 ? ((const int16_t *)buf)[i] : ((const int32_t *)buf)[i];
+
+    /* Bits 0 to 23 of S24 samples */
+    return format == SRTM_AudioPcmS24 ? (int32_t)(value & 0x7FFFFF) - (int32_t)(value & 0x800000) : value;
+}
+
+static void ref_set(void *buf, srtm_audio_pcm_format_t format, uint32_t i, int64_t value)
+{
+    if (format == SRTM_AudioPcmS16)
+    {
+        ((int16_t *)buf)[i] = (int16_t)value;
+    }
+    else
+    {
+        ((int32_t *)buf)[i] = (int32_t)value;
+    }
+}
+
+static uint32_t ref_bits(srtm_audio_pcm_format_t format)
+{
+    return format == SRTM_AudioPcmS16 ? 16U : (format == SRTM_AudioPcmS24 ? 24U : 32U);
+}
+
+static int64_t ref_clamp(int64_t value, uint32_t bits)
+{
+    int64_t max = ((int64_t)1 << (bits - 1U)) - 1;
+
+    return value > max ? max : (value < -max - 1 ? -max - 1 : value);
+}
+
+/* floor() of value / 2^shift, whatever the compiler does with >> on negative values */
+static int64_t ref_floor_shift(int64_t value, uint32_t shift)
+{
+    int64_t div = (int64_t)1 << shift;
+
+    return value >= 0 ? value / div : -((-value + div - 1) / div);
+}
+
+/* The sample as a fraction of full scale, in 1/2^32 */
+static int64_t ref_to_q32(int32_t value, srtm_audio_pcm_format_t format)
+{
+    return (int64_t)value * ((int64_t)1 << (32U - ref_bits(format)));
+}
+
+static void ref_convert(
+    void *dst, srtm_audio_pcm_format_t dstFormat, const void *src, srtm_audio_pcm_format_t srcFormat, uint32_t samples)
+{
+    uint32_t i;
+
+    for (i = 0; i < samples; i++)
+    {
+        ref_set(dst, dstFormat, i,
+                ref_floor_shift(ref_to_q32(ref_get(src, srcFormat, i), srcFormat), 32U - ref_bits(dstFormat)));
+    }
+}
+
+static void ref_gain(void *dst, const void *src, srtm_audio_pcm_format_t format, uint32_t samples, int16_t gain)
+{
+    uint32_t i;
+
+    for (i = 0; i < samples; i++)
+    {
+        ref_set(dst, format, i,
+                ref_clamp(ref_floor_shift((int64_t)ref_get(src, format, i) * gain, 14U), ref_bits(format)));
+    }
+}
+
+static void ref_mix(void *dst,
+                    srtm_audio_pcm_format_t dstFormat,
+                    const int16_t *const *src,
+                    const int16_t *gain,
+                    uint32_t streams,
+                    uint32_t samples)
+{
+    uint32_t i, s;
+    int64_t acc;
+
+    for (i = 0; i < samples; i++)
+    {
+        /* Q14 sum of S16 samples, to the dst format */
+        acc = 0;
+        for (s = 0; s < streams; s++)
+        {
+            acc += (int64_t)src[s][i] * gain[s];
+        }
+        ref_set(dst, dstFormat, i,
+                ref_clamp(ref_floor_shift(acc * ((int64_t)1 << (ref_bits(dstFormat) - 16U)), 14U),
+                          ref_bits(dstFormat)));
+    }
+}
+
+static void check(const char *name, const void *result, const void *expected, uint32_t size)
+{
+    checks++;
+    if (memcmp(result, expected, size) != 0)
+    {
+        failures++;
+        if (failures <= 10U)
+        {
+            printf("FAIL %s\r\n", name);
+        }
+    }
+}
+
+/* A random sample of the format, full scale values one time in four */
+static int32_t random_sample(srtm_audio_pcm_format_t format)
+{
+    uint32_t bits = ref_bits(format);
+    int64_t max = ((int64_t)1 << (bits - 1U)) - 1;
+    uint32_t r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+    switch (rand() & 7)
+    {
+        case 0:
+            return (int32_t)max;
+        case 1:
+            return (int32_t)(-max - 1);
+        default:
+            return (int32_t)ref_clamp((int64_t)(int32_t)r >> (32U - bits), bits);
+    }
+}
+
+static void random_fill(void *buf, srtm_audio_pcm_format_t format, uint32_t samples)
+{
+    uint32_t i;
+
+    for (i = 0; i < samples; i++)
+    {
+        ref_set(buf, format, i, random_sample(format));
+    }
+}
+
+static int16_t random_gain(void)
+{
+    switch (rand() & 3)
+    {
+        case 0:
+            return SRTM_AUDIO_PCM_GAIN_UNITY;
+        case 1:
+            return 0x7FFF;
+        default:
+            return (int16_t)(rand() & 0x7FFF);
+    }
+}
+
+static void test_golden(void)
+{
+    static const int16_t PCM_TEST_ALIGN s16[] = {0x7FFF, -0x8000, 1, -1, 0x1234};
+    static const int32_t s16_to_s32[] = {0x7FFF0000, INT32_MIN, 0x10000, -0x10000, 0x12340000};
+    static const int32_t s16_to_s24[] = {0x7FFF00, -0x800000, 0x100, -0x100, 0x123400};
+    static const int32_t s32[] = {0x7FFFFFFF, INT32_MIN, 0x1FFFF, -1, 0x1234ABCD};
+    static const int32_t s24[] = {0x7FFFFF, -0x800000, 0x1FF, -1, 0x1234AB};
+    static const int16_t to_s16[] = {0x7FFF, -0x8000, 1, -1, 0x1234};
+    static const int32_t s24_to_s32[] = {0x7FFFFF00, INT32_MIN, 0x1FF00, -0x100, 0x1234AB00};
+    static const int32_t s32_to_s24[] = {0x7FFFFF, -0x800000, 0x1FF, -1, 0x1234AB};
+    static const int16_t PCM_TEST_ALIGN left[] = {1, 2, 3}, right[] = {-1, -2, -3};
+    static const int16_t PCM_TEST_ALIGN stereo[] = {1, -1, 2, -2, 3, -3};
+    static const int32_t ch0[] = {10, 11}, ch1[] = {20, 21}, ch2[] = {30, 31};
+    static const int32_t three[] = {10, 20, 30, 11, 21, 31};
+    static const int16_t PCM_TEST_ALIGN gain_s16[] = {0x7FFF, -0x8000, 1000, -1000, 3};
+    static const int16_t gain_s16_x15[] = {0x7FFF, -0x8000, 1500, -1500, 4};
+    static const int16_t PCM_TEST_ALIGN half_s16[] = {-3, 3, 0x7FFF};
+    static const int16_t half_s16_x05[] = {-2, 1, 0x3FFF};
+    static const int32_t gain_s24[] = {0x7FFFFF, -0x800000, 0x100000, 0x00FFFFF0};
+    static const int32_t gain_s24_x15[] = {0x7FFFFF, -0x800000, 0x180000, -24};
+    static const int32_t gain_s32[] = {0x7FFFFFFF, INT32_MIN, 0x10000000};
+    static const int32_t gain_s32_x15[] = {0x7FFFFFFF, INT32_MIN, 0x18000000};
+    static const int16_t PCM_TEST_ALIGN mix_a[] = {0x7000, -0x7000, 100, 1, 0x4000};
+    static const int16_t PCM_TEST_ALIGN mix_b[] = {0x7000, -0x7000, -50, 1, 0x4000};
+    static const int16_t PCM_TEST_ALIGN mix_c[] = {-0x7000, 0x7000, 100, 1, 0x4000};
+    static const int16_t mix_ab_s16[] = {0x7FFF, -0x8000, 50, 2, 0x7FFF};
+    static const int32_t mix_ab_s24[] = {0x7FFFFF, -0x800000, 50 << 8, 2 << 8, 0x7FFFFF};
+    static const int32_t mix_ab_s32[] = {0x7FFFFFFF, INT32_MIN, 50 << 16, 2 << 16, 0x7FFFFFFF};
+    static const int16_t mix_abc_s16[] = {0x7000, -0x7000, 150, 3, 0x7FFF};
+    static const int16_t mix_gains[] = {SRTM_AUDIO_PCM_GAIN_UNITY, 0x2000, 0x6000};
+    static const int16_t mix_gains_out[] = {0, 0, 225, 3, 0x7FFF};
+    static const int16_t unity[] = {SRTM_AUDIO_PCM_GAIN_UNITY, SRTM_AUDIO_PCM_GAIN_UNITY, SRTM_AUDIO_PCM_GAIN_UNITY};
+    const int16_t *mix_src[] = {mix_a, mix_b, mix_c};
+    const void *planes[3];
+    void *out_planes[3];
+
+    /* Widening puts the sample in the MSBs */
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS32, s16, SRTM_AudioPcmS16, 5U);
+    check("convert S16 to S32", dst_buf[0], s16_to_s32, sizeof(s16_to_s32));
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS24, s16, SRTM_AudioPcmS16, 5U);
+    check("convert S16 to S24", dst_buf[0], s16_to_s24, sizeof(s16_to_s24));
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS32, s24, SRTM_AudioPcmS24, 5U);
+    check("convert S24 to S32", dst_buf[0], s24_to_s32, sizeof(s24_to_s32));
+
+    /* Narrowing truncates */
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS16, s32, SRTM_AudioPcmS32, 5U);
+    check("convert S32 to S16", dst_buf[0], to_s16, sizeof(to_s16));
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS16, s24, SRTM_AudioPcmS24, 5U);
+    check("convert S24 to S16", dst_buf[0], to_s16, sizeof(to_s16));
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS24, s32, SRTM_AudioPcmS32, 5U);
+    check("convert S32 to S24", dst_buf[0], s32_to_s24, sizeof(s32_to_s24));
+
+    /* In place between formats of the same size */
+    memcpy(dst_buf[0], s32, sizeof(s32));
+    SRTM_AudioPcm_Convert(dst_buf[0], SRTM_AudioPcmS24, dst_buf[0], SRTM_AudioPcmS32, 5U);
+    check("convert S32 to S24 in place", dst_buf[0], s32_to_s24, sizeof(s32_to_s24));
+
+    planes[0] = left;
+    planes[1] = right;
+    SRTM_AudioPcm_Interleave(dst_buf[0], planes, 2U, 3U, SRTM_AudioPcmS16);
+    check("interleave S16 stereo", dst_buf[0], stereo, sizeof(stereo));
+    out_planes[0] = dst_buf[1];
+    out_planes[1] = dst_buf[2];
+    SRTM_AudioPcm_Deinterleave(out_planes, stereo, 2U, 3U, SRTM_AudioPcmS16);
+    check("deinterleave S16 stereo left", dst_buf[1], left, sizeof(left));
+    check("deinterleave S16 stereo right", dst_buf[2], right, sizeof(right));
+
+    planes[0] = ch0;
+    planes[1] = ch1;
+    planes[2] = ch2;
+    SRTM_AudioPcm_Interleave(dst_buf[0], planes, 3U, 2U, SRTM_AudioPcmS32);
+    check("interleave S32 3 channels", dst_buf[0], three, sizeof(three));
+    out_planes[2] = dst_buf[3];
+    SRTM_AudioPcm_Deinterleave(out_planes, three, 3U, 2U, SRTM_AudioPcmS32);
+    check("deinterleave S32 3 channels", dst_buf[1], ch0, sizeof(ch0));
+    check("deinterleave S32 3 channels", dst_buf[2], ch1, sizeof(ch1));
+    check("deinterleave S32 3 channels", dst_buf[3], ch2, sizeof(ch2));
+
+    /* 1.5 saturates full scale samples, 0.5 rounds toward minus infinity */
+    SRTM_AudioPcm_Gain(dst_buf[0], gain_s16, SRTM_AudioPcmS16, 5U, 0x6000);
+    check("gain S16 1.5", dst_buf[0], gain_s16_x15, sizeof(gain_s16_x15));
+    memcpy(dst_buf[0], half_s16, sizeof(half_s16));
+    SRTM_AudioPcm_Gain(dst_buf[0], dst_buf[0], SRTM_AudioPcmS16, 3U, 0x2000);
+    check("gain S16 0.5 in place", dst_buf[0], half_s16_x05, sizeof(half_s16_x05));
+    /* -16 without sign extension */
+    SRTM_AudioPcm_Gain(dst_buf[0], gain_s24, SRTM_AudioPcmS24, 4U, 0x6000);
+    check("gain S24 1.5", dst_buf[0], gain_s24_x15, sizeof(gain_s24_x15));
+    SRTM_AudioPcm_Gain(dst_buf[0], gain_s32, SRTM_AudioPcmS32, 3U, 0x6000);
+    check("gain S32 1.5", dst_buf[0], gain_s32_x15, sizeof(gain_s32_x15));
+
+    /* Two unity streams, the saturating add */
+    SRTM_AudioPcm_Mix(dst_buf[0], SRTM_AudioPcmS16, mix_src, unity, 2U, 5U);
+    check("mix 2 streams to S16", dst_buf[0], mix_ab_s16, sizeof(mix_ab_s16));
+    SRTM_AudioPcm_Mix(dst_buf[0], SRTM_AudioPcmS24, mix_src, unity, 2U, 5U);
+    check("mix 2 streams to S24", dst_buf[0], mix_ab_s24, sizeof(mix_ab_s24));
+    SRTM_AudioPcm_Mix(dst_buf[0], SRTM_AudioPcmS32, mix_src, unity, 2U, 5U);
+    check("mix 2 streams to S32", dst_buf[0], mix_ab_s32, sizeof(mix_ab_s32));
+    /* The sum only saturates at the end: 0x7000 + 0x7000 - 0x7000 */
+    SRTM_AudioPcm_Mix(dst_buf[0], SRTM_AudioPcmS16, mix_src, unity, 3U, 5U);
+    check("mix 3 streams to S16", dst_buf[0], mix_abc_s16, sizeof(mix_abc_s16));
+    SRTM_AudioPcm_Mix(dst_buf[0], SRTM_AudioPcmS16, mix_src, mix_gains, 3U, 5U);
+    check("mix 3 streams with gains to S16", dst_buf[0], mix_gains_out, sizeof(mix_gains_out));
+}
+
+static void test_random(void)
+{
+    uint32_t round, f, g, samples, channels, streams, s;
+    srtm_audio_pcm_format_t src_format, dst_format;
+    const void *planes[PCM_TEST_MAX_CHANNELS];
+    void *out_planes[PCM_TEST_MAX_CHANNELS];
+    void *ref_planes[PCM_TEST_MAX_CHANNELS];
+    const int16_t *streams_src[SRTM_AUDIO_PCM_MAX_MIX_STREAMS];
+    int16_t *mix_buf = (int16_t *)src_buf;
+    int16_t gains[SRTM_AUDIO_PCM_MAX_MIX_STREAMS];
+    int16_t gain;
+    uint32_t size;
+
+    for (round = 0; round < PCM_TEST_ROUNDS; round++)
+    {
+        samples = (uint32_t)rand() % (PCM_TEST_MAX_SAMPLES + 1U);
+
+        for (f = 0; f < PCM_TEST_COUNT(formats); f++)
+        {
+            src_format = formats[f];
+            size = samples * SRTM_AudioPcm_GetSampleSize(src_format);
+
+            for (g = 0; g < PCM_TEST_COUNT(formats); g++)
+            {
+                dst_format = formats[g];
+                random_fill(src_buf[0], src_format, samples);
+                SRTM_AudioPcm_Convert(dst_buf[0], dst_format, src_buf[0], src_format, samples);
+                ref_convert(ref_buf[0], dst_format, src_buf[0], src_format, samples);
+                check(format_names[g], dst_buf[0], ref_buf[0], samples * SRTM_AudioPcm_GetSampleSize(dst_format));
+            }
+
+            gain = random_gain();
+            SRTM_AudioPcm_Gain(dst_buf[0], src_buf[0], src_format, samples, gain);
+            ref_gain(ref_buf[0], src_buf[0], src_format, samples, gain);
+            check("gain", dst_buf[0], ref_buf[0], size);
+
+            channels = 1U + (uint32_t)rand() % PCM_TEST_MAX_CHANNELS;
+            for (s = 0; s < channels; s++)
+            {
+                random_fill(src_buf[s], src_format, samples);
+                planes[s] = src_buf[s];
+                out_planes[s] = dst_buf[s];
+                ref_planes[s] = ref_buf[s];
+            }
+            SRTM_AudioPcm_Interleave(dst_buf[0], planes, channels, samples, src_format);
+            for (s = 0; s < samples * channels; s++)
+            {
+                ref_set(ref_buf[0], src_format, s, ref_get(planes[s % channels], src_format, s / channels));
+            }
+            check("interleave", dst_buf[0], ref_buf[0], size * channels);
+
+            memcpy(src_buf[0], dst_buf[0], size * channels);
+            SRTM_AudioPcm_Deinterleave(out_planes, src_buf[0], channels, samples, src_format);
+            for (s = 0; s < samples * channels; s++)
+            {
+                ref_set(ref_planes[s % channels], src_format, s / channels, ref_get(src_buf[0], src_format, s));
+            }
+            for (s = 0; s < channels; s++)
+            {
+                check("deinterleave", out_planes[s], ref_planes[s], size);
+            }
+
+            /* Streams side by side in src_buf, each 4 bytes aligned */
+            streams = 1U + (uint32_t)rand() % SRTM_AUDIO_PCM_MAX_MIX_STREAMS;
+            for (s = 0; s < streams; s++)
+            {
+                streams_src[s] = &mix_buf[s * (PCM_TEST_MAX_SAMPLES + 1U)];
+                random_fill((void *)streams_src[s], SRTM_AudioPcmS16, samples);
+                gains[s] = (rand() & 1) ? SRTM_AUDIO_PCM_GAIN_UNITY : random_gain();
+            }
+            SRTM_AudioPcm_Mix(dst_buf[0], src_format, streams_src, gains, streams, samples);
+            ref_mix(ref_buf[0], src_format, streams_src, gains, streams, samples);
+            check("mix", dst_buf[0], ref_buf[0], size);
+        }
+    }
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    srand(1U);
+
+    printf("SRTM audio PCM kernels test, %s build\r\n", PCM_TEST_NAME);
+
+    test_golden();
+    printf("golden vectors: %u failures\r\n", (unsigned)failures);
+
+    test_random();
+    printf("%u checks, %u failures\r\n", (unsigned)checks, (unsigned)failures);
+
+    return failures ? 1 : 0;
+}
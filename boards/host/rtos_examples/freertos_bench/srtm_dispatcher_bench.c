@@ -0,0 +1,236 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* SRTM includes. */
+#include "fsl_common.h"
+#include "srtm_dispatcher.h"
+#include "srtm_message.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of fill/drain rounds */
+#ifndef DISPATCHER_BENCH_ROUNDS
+#define DISPATCHER_BENCH_ROUNDS (200U)
+#endif
+
+#define DISPATCHER_BENCH_MAX_QUEUED (256U)
+
+/* The probe has a higher priority than the queued messages, so it goes in front of all of them */
+#define DISPATCHER_BENCH_QUEUED_PRIO (0U)
+#define DISPATCHER_BENCH_PROBE_PRIO (1U)
+
+/* The ordering check uses the priorities every dispatcher configuration keeps apart */
+#define DISPATCHER_BENCH_CHECK_PRIOS (8U)
+#define DISPATCHER_BENCH_SEED (0x12345678U)
+
+#define DISPATCHER_BENCH_CONTROL_PRIORITY (2U)
+#define DISPATCHER_BENCH_DISPATCHER_PRIORITY (3U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint32_t queued_counts[] = {1U, 32U, DISPATCHER_BENCH_MAX_QUEUED};
+
+static srtm_dispatcher_t dispatcher;
+static uint32_t enqueue_ns[sizeof(queued_counts) / sizeof(queued_counts[0])][DISPATCHER_BENCH_ROUNDS];
+static uint32_t dequeue_ns[DISPATCHER_BENCH_ROUNDS];
+
+static uint32_t irq_off_depth;
+static uint64_t irq_off_at;
+static uint32_t irq_off_max;
+
+static uint32_t handled;
+static uint32_t handled_prio;
+static uint32_t handled_seq;
+static uint32_t misordered;
+static uint32_t prng_state = DISPATCHER_BENCH_SEED;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* DisableGlobalIRQ()/EnableGlobalIRQ() of the SRTM library built with HOST_IRQ_OFF_TRACE */
+void HOST_IrqOffEnter(void)
+{
+    if (irq_off_depth++ == 0U)
+    {
+        irq_off_at = bench_now_ns();
+    }
+}
+
+void HOST_IrqOffExit(void)
+{
+    uint32_t elapsed;
+
+    if (--irq_off_depth == 0U)
+    {
+        elapsed = (uint32_t)(bench_now_ns() - irq_off_at);
+        if (elapsed > irq_off_max)
+        {
+            irq_off_max = elapsed;
+        }
+    }
+}
+
+static uint32_t prng_next(void)
+{
+    prng_state ^= prng_state << 13;
+    prng_state ^= prng_state >> 17;
+    prng_state ^= prng_state << 5;
+    return prng_state;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Messages must come out by decreasing priority, and in posting order within a priority */
+static void handle_proc(srtm_dispatcher_t disp, void *param1, void *param2)
+{
+    uint32_t seq  = (uint32_t)(uintptr_t)param1;
+    uint32_t prio = (uint32_t)(uintptr_t)param2;
+
+    if ((handled != 0U) && ((prio > handled_prio) || ((prio == handled_prio) && (seq < handled_seq))))
+    {
+        misordered++;
+    }
+    handled++;
+    handled_prio = prio;
+    handled_seq  = seq;
+}
+
+static void post_proc(uint32_t seq, uint32_t prio)
+{
+    srtm_procedure_t proc = SRTM_Procedure_Create(handle_proc, (void *)(uintptr_t)seq, (void *)(uintptr_t)prio);
+
+    configASSERT(proc != NULL);
+    SRTM_Message_SetPriority(proc, (uint8_t)prio);
+    SRTM_Dispatcher_PostProc(dispatcher, proc);
+}
+
+/* The dispatcher task has the higher priority, it handles all the queued messages before Start returns */
+static void drain(void)
+{
+    handled = 0U;
+    SRTM_Dispatcher_Start(dispatcher);
+    SRTM_Dispatcher_Stop(dispatcher);
+}
+
+static void dispatcher_task_fn(void *pvParameters)
+{
+    SRTM_Dispatcher_Run(dispatcher);
+}
+
+/*!
+ * @brief Measures the longest IRQ disabled section of posting a message with 1, 32 and 256 queued.
+ *
+ * The dispatcher is stopped while the messages are posted, so they stay queued.  Each probe is
+ * posted with a higher priority than the queued messages, the worst case of an ordered insertion.
+ * The queue is then drained by the dispatcher, and the longest IRQ disabled section of the drain
+ * is the dequeue time.
+ */
+static void control_task_fn(void *pvParameters)
+{
+    uint32_t n, round, queued, seq;
+
+    printf("FreeRTOS %s SRTM dispatcher benchmark, %u rounds\r\n", tskKERNEL_VERSION_NUMBER,
+           (unsigned)DISPATCHER_BENCH_ROUNDS);
+
+    dispatcher = SRTM_Dispatcher_Create();
+    configASSERT(dispatcher != NULL);
+    if (xTaskCreate(dispatcher_task_fn, "srtm", configMINIMAL_STACK_SIZE, NULL, DISPATCHER_BENCH_DISPATCHER_PRIORITY,
+                    NULL) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        vTaskEndScheduler();
+    }
+
+    /* Ordering check with mixed priorities */
+    for (seq = 0U; seq < DISPATCHER_BENCH_MAX_QUEUED; seq++)
+    {
+        post_proc(seq, prng_next() % DISPATCHER_BENCH_CHECK_PRIOS);
+    }
+    drain();
+    printf("ordering: %u messages, %u out of order\r\n", (unsigned)handled, (unsigned)misordered);
+
+    for (round = 0U; round < DISPATCHER_BENCH_ROUNDS; round++)
+    {
+        queued = 0U;
+        for (n = 0U; n < sizeof(queued_counts) / sizeof(queued_counts[0]); n++)
+        {
+            for (; queued < queued_counts[n]; queued++)
+            {
+                post_proc(queued, DISPATCHER_BENCH_QUEUED_PRIO);
+            }
+
+            irq_off_max = 0U;
+            post_proc(queued++, DISPATCHER_BENCH_PROBE_PRIO);
+            enqueue_ns[n][round] = irq_off_max;
+        }
+
+        irq_off_max = 0U;
+        drain();
+        dequeue_ns[round] = irq_off_max;
+    }
+
+    printf("%-8s %8s %8s\r\n", "queued", "enqueue", "p50");
+    for (n = 0U; n < sizeof(queued_counts) / sizeof(queued_counts[0]); n++)
+    {
+        qsort(enqueue_ns[n], DISPATCHER_BENCH_ROUNDS, sizeof(enqueue_ns[n][0]), compare_u32);
+        printf("%-8u %8u %8u\r\n", (unsigned)queued_counts[n], (unsigned)enqueue_ns[n][0],
+               (unsigned)enqueue_ns[n][DISPATCHER_BENCH_ROUNDS / 2U]);
+    }
+    qsort(dequeue_ns, DISPATCHER_BENCH_ROUNDS, sizeof(dequeue_ns[0]), compare_u32);
+    printf("%-8s %8u %8u\r\n", "dequeue", (unsigned)dequeue_ns[0], (unsigned)dequeue_ns[DISPATCHER_BENCH_ROUNDS / 2U]);
+    printf("ns with the IRQ disabled, minimum and median; out of order: %u\r\n", (unsigned)misordered);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, DISPATCHER_BENCH_CONTROL_PRIORITY,
+                    NULL) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Middleware includes. */
+#include "rpmsg_lite.h"
+#include "rpmsg_queue.h"
+#include "srtm_dispatcher.h"
+#include "srtm_dispatcher_struct.h"
+#include "srtm_peercore.h"
+#include "srtm_message.h"
+#include "srtm_message_struct.h"
+#include "srtm_service.h"
+#include "srtm_service_struct.h"
+#include "srtm_rpmsg_endpoint.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Requests sent per request size and run */
+#ifndef SRTM_RX_BENCH_REQUESTS
+#define SRTM_RX_BENCH_REQUESTS (20000U)
+#endif
+
+/* The best of the runs is printed */
+#define SRTM_RX_BENCH_RUNS (3U)
+
+/* As many requests in flight as the dispatcher has RX messages, the most buffers it can hold */
+#define SRTM_RX_BENCH_BURST (SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER)
+
+/* The requests are sent in bursts: the dispatcher only runs once the control task waits for the responses */
+#define SRTM_RX_BENCH_CONTROL_PRIORITY (3U)
+#define SRTM_RX_BENCH_DISPATCHER_PRIORITY (2U)
+
+/* Both sides of the rpmsg link run on the host, see the host rpmsg platform */
+#define SRTM_RX_BENCH_SHMEM_SIZE (RL_VRING_OVERHEAD + 2U * RL_BUFFER_COUNT * (RL_BUFFER_PAYLOAD_SIZE + 16U))
+#define SRTM_RX_BENCH_SRTM_ADDR (40U)
+#define SRTM_RX_BENCH_LOCAL_ADDR (41U)
+#define SRTM_RX_BENCH_CATEGORY (0x7FU)
+#define SRTM_RX_BENCH_VERSION (0x0100U)
+
+#if SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY
+#define SRTM_RX_BENCH_NAME "zero-copy"
+#define SRTM_RX_BENCH_MSG_SIZE (sizeof(struct _srtm_message))
+#else
+#define SRTM_RX_BENCH_NAME "copy"
+#define SRTM_RX_BENCH_MSG_SIZE (sizeof(struct _srtm_message) + SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN)
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* From the header only to the longest message of the copy receive */
+static const uint32_t request_sizes[] = {sizeof(srtm_packet_head_t), 64U, 128U, SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN};
+
+static uint8_t rpmsg_shmem[SRTM_RX_BENCH_SHMEM_SIZE] __attribute__((aligned(VRING_ALIGN)));
+static struct rpmsg_lite_instance *rpmsg_master;
+static struct rpmsg_lite_instance *rpmsg_remote;
+static struct rpmsg_lite_endpoint *rpmsg_ept;
+static rpmsg_queue_handle rpmsg_q;
+static struct _srtm_service srtm_rx_service;
+static uint8_t request[SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN];
+
+/* Requests whose payload did not match what was sent */
+static uint32_t corrupted;
+static uint32_t dispatcher_heap;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* The payload bytes are the request command, the service looks at both ends of it */
+static srtm_status_t srtm_rx_request(srtm_service_t service, srtm_request_t request)
+{
+    uint8_t command = SRTM_CommMessage_GetCommand(request);
+    uint8_t *payload = SRTM_CommMessage_GetPayload(request);
+    uint32_t len = SRTM_CommMessage_GetPayloadLen(request);
+    srtm_response_t response;
+
+    if ((len != 0U) && ((payload[0] != command) || (payload[len - 1U] != command)))
+    {
+        corrupted++;
+    }
+
+    response = SRTM_Response_Create(SRTM_CommMessage_GetChannel(request), SRTM_RX_BENCH_CATEGORY,
+                                    SRTM_RX_BENCH_VERSION, command, 0U);
+    if (!response)
+    {
+        return SRTM_Status_OutOfMemory;
+    }
+
+    return SRTM_Dispatcher_DeliverResponse(service->dispatcher, response);
+}
+
+static void srtm_dispatcher_task(void *pvParameters)
+{
+    size_t heap = xPortGetFreeHeapSize();
+    srtm_dispatcher_t disp = SRTM_Dispatcher_Create();
+    srtm_peercore_t core;
+    srtm_rpmsg_endpoint_config_t config = {0};
+    srtm_channel_t channel;
+
+    dispatcher_heap = (uint32_t)(heap - xPortGetFreeHeapSize());
+
+    core = SRTM_PeerCore_Create(1U);
+    config.rpmsgHandle = rpmsg_remote;
+    config.localAddr = SRTM_RX_BENCH_SRTM_ADDR;
+    config.peerAddr = RL_ADDR_ANY;
+    channel = SRTM_RPMsgEndpoint_Create(&config);
+
+    SRTM_PeerCore_SetState(core, SRTM_PeerCore_State_Activated);
+    SRTM_PeerCore_AddChannel(core, channel);
+    SRTM_Dispatcher_AddPeerCore(disp, core);
+
+    SRTM_List_Init(&srtm_rx_service.node);
+    srtm_rx_service.category = SRTM_RX_BENCH_CATEGORY;
+    srtm_rx_service.request = srtm_rx_request;
+    SRTM_Dispatcher_RegisterService(disp, &srtm_rx_service);
+
+    SRTM_Dispatcher_Start(disp);
+    SRTM_Dispatcher_Run(disp);
+}
+
+/*!
+ * @brief Brings up both sides of a host rpmsg link and the SRTM dispatcher on the remote side.
+ */
+static void rpmsg_init(void)
+{
+    /* The remote side registers its interrupts first, the master kicks it when ready */
+    rpmsg_remote = rpmsg_lite_remote_init(rpmsg_shmem, RL_PLATFORM_HOST_REMOTE_LINK_ID, RL_NO_FLAGS);
+    rpmsg_master = rpmsg_lite_master_init(rpmsg_shmem, sizeof(rpmsg_shmem), RL_PLATFORM_HOST_MASTER_LINK_ID, RL_NO_FLAGS);
+    if ((!rpmsg_remote) || (!rpmsg_master))
+    {
+        printf("rpmsg init failed!\r\n");
+        vAssertCalled(__FILE__, __LINE__);
+    }
+    while (!rpmsg_lite_is_link_up(rpmsg_remote))
+    {
+        vTaskDelay(1);
+    }
+
+    rpmsg_q = rpmsg_queue_create(rpmsg_master);
+    rpmsg_ept = rpmsg_lite_create_ept(rpmsg_master, SRTM_RX_BENCH_LOCAL_ADDR, rpmsg_queue_rx_cb, rpmsg_q);
+
+    xTaskCreate(srtm_dispatcher_task, "srtm", configMINIMAL_STACK_SIZE * 2U, NULL, SRTM_RX_BENCH_DISPATCHER_PRIORITY,
+                NULL);
+    /* Let the remote side create its endpoint */
+    vTaskDelay(10);
+}
+
+/*!
+ * @brief Sends SRTM_RX_BENCH_REQUESTS requests of the given size in bursts, and waits for the responses.
+ */
+static uint64_t run_size(uint32_t size)
+{
+    srtm_packet_head_t *head = (srtm_packet_head_t *)request;
+    srtm_packet_head_t response;
+    uint32_t sent, n;
+    uint64_t start;
+    unsigned long src;
+    int len;
+
+    head->category = SRTM_RX_BENCH_CATEGORY;
+    head->majorVersion = SRTM_MESSAGE_MAJOR_VERSION(SRTM_RX_BENCH_VERSION);
+    head->minorVersion = SRTM_MESSAGE_MINOR_VERSION(SRTM_RX_BENCH_VERSION);
+    head->type = SRTM_MessageTypeRequest;
+
+    start = bench_now_ns();
+    for (sent = 0U; sent < SRTM_RX_BENCH_REQUESTS; sent += SRTM_RX_BENCH_BURST)
+    {
+        for (n = 0U; n < SRTM_RX_BENCH_BURST; n++)
+        {
+            head->command = (uint8_t)(sent + n);
+            memset(head + 1, head->command, size - sizeof(*head));
+            rpmsg_lite_send(rpmsg_master, rpmsg_ept, SRTM_RX_BENCH_SRTM_ADDR, (char *)request, size, RL_BLOCK);
+        }
+        for (n = 0U; n < SRTM_RX_BENCH_BURST; n++)
+        {
+            rpmsg_queue_recv(rpmsg_master, rpmsg_q, &src, (char *)&response, sizeof(response), &len, RL_BLOCK);
+        }
+    }
+
+    /* Requests per second */
+    return (uint64_t)sent * 1000000000ULL / (bench_now_ns() - start);
+}
+
+/*!
+ * @brief Measures the SRTM requests/s for request sizes up to SRTM_DISPATCHER_CONFIG_RX_MSG_MAX_LEN.
+ *
+ * Along with the rate, the memory the dispatcher sets aside for the received data is printed,
+ * and the most rpmsg buffers the remote side held at once.
+ */
+static void control_task_fn(void *pvParameters)
+{
+    struct rpmsg_lite_stats stats;
+    uint64_t best, rate;
+    uint32_t n, run;
+
+    printf("FreeRTOS %s SRTM %s receive benchmark, %u requests in bursts of %u\r\n", tskKERNEL_VERSION_NUMBER,
+           SRTM_RX_BENCH_NAME, (unsigned)SRTM_RX_BENCH_REQUESTS, (unsigned)SRTM_RX_BENCH_BURST);
+    printf("%-8s %12s\r\n", "request", "requests/s");
+
+    rpmsg_init();
+
+    for (n = 0U; n < sizeof(request_sizes) / sizeof(request_sizes[0]); n++)
+    {
+        best = 0U;
+        for (run = 0U; run < SRTM_RX_BENCH_RUNS; run++)
+        {
+            rate = run_size(request_sizes[n]);
+            best = (rate > best) ? rate : best;
+        }
+        printf("%-8u %12u\r\n", (unsigned)request_sizes[n], (unsigned)best);
+    }
+
+    rpmsg_lite_get_stats(rpmsg_remote, &stats);
+    printf("best of %u runs; RX messages: %u x %u bytes, dispatcher heap: %u bytes\r\n", (unsigned)SRTM_RX_BENCH_RUNS,
+           (unsigned)SRTM_DISPATCHER_CONFIG_RX_MSG_NUMBER, (unsigned)SRTM_RX_BENCH_MSG_SIZE, (unsigned)dispatcher_heap);
+    printf("rpmsg buffers held at most: %u of %u; corrupted requests: %u\r\n", (unsigned)stats.rx_held_max,
+           (unsigned)RL_BUFFER_COUNT, (unsigned)corrupted);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(control_task_fn, "control", configMINIMAL_STACK_SIZE, NULL, SRTM_RX_BENCH_CONTROL_PRIORITY,
+                    NULL) != pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
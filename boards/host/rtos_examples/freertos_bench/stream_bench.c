@@ -0,0 +1,258 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Bytes sent per record size, path and run */
+#ifndef STREAM_BENCH_BYTES
+#define STREAM_BENCH_BYTES (8U * 1024U * 1024U)
+#endif
+
+/* The best of the runs is printed */
+#define STREAM_BENCH_RUNS (3U)
+
+/* Not a multiple of the record sizes, so the records wrap at the end of the storage area */
+#define STREAM_BENCH_BUFFER_SIZE (16U * 1024U + 100U)
+#define STREAM_BENCH_MAX_RECORD (4096U)
+
+#define STREAM_BENCH_TASK_PRIORITY (2U)
+
+typedef enum _stream_bench_path
+{
+    kSTREAM_BENCH_StreamCopy = 0U,
+    kSTREAM_BENCH_StreamZeroCopy,
+    kSTREAM_BENCH_MessageCopy,
+    kSTREAM_BENCH_MessageZeroCopy,
+    kSTREAM_BENCH_PathCount,
+} stream_bench_path_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint32_t record_sizes[] = {4U, 16U, 64U, 256U, 1024U, 4096U};
+
+static StreamBufferHandle_t stream_buffer;
+static MessageBufferHandle_t message_buffer;
+static uint8_t tx_record[STREAM_BENCH_MAX_RECORD];
+static uint8_t rx_record[STREAM_BENCH_MAX_RECORD];
+
+/* Bytes whose content did not match what was sent */
+static uint32_t corrupted;
+static uint32_t wrapped_regions;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* The producer writes the record sequence number in every byte of the record */
+static void fill_region(const StreamBufferRegion_t *region, uint32_t length, uint8_t value)
+{
+    uint32_t first = (length < region->xFirstLength) ? length : (uint32_t)region->xFirstLength;
+
+    memset(region->pucFirst, value, first);
+    if (length > first)
+    {
+        memset(region->pucSecond, value, length - first);
+        wrapped_regions++;
+    }
+}
+
+/* The consumer only looks at both ends of each part, so the copies are not hidden by the check */
+static void check_part(const uint8_t *data, uint32_t length, uint8_t value)
+{
+    if ((length != 0U) && ((data[0] != value) || (data[length - 1U] != value)))
+    {
+        corrupted += length;
+    }
+}
+
+static void check_region(const StreamBufferRegion_t *region, uint32_t length, uint8_t value)
+{
+    uint32_t first = (length < region->xFirstLength) ? length : (uint32_t)region->xFirstLength;
+
+    check_part(region->pucFirst, first, value);
+    check_part(region->pucSecond, length - first, value);
+}
+
+/*!
+ * @brief Fills the buffer with records, then drains it, until STREAM_BENCH_BYTES went through.
+ *
+ * The copy path fills a record in a local buffer and sends it, then receives it in a local
+ * buffer and checks it.  The zero-copy path fills the reserved region and checks the acquired
+ * region, without the two copies.
+ */
+static uint64_t run_path(stream_bench_path_t path, uint32_t record)
+{
+    StreamBufferRegion_t region;
+    uint32_t total = 0U, length;
+    uint32_t tx_seq = 0U, rx_seq = 0U;
+    uint64_t start;
+    size_t done;
+
+    start = bench_now_ns();
+    while (total < STREAM_BENCH_BYTES)
+    {
+        for (;;)
+        {
+            tx_seq++;
+            switch (path)
+            {
+                case kSTREAM_BENCH_StreamCopy:
+                    /* A stream buffer accepts part of a record, only send whole records */
+                    if (xStreamBufferSpacesAvailable(stream_buffer) < record)
+                    {
+                        done = 0U;
+                        break;
+                    }
+                    memset(tx_record, (uint8_t)tx_seq, record);
+                    done = xStreamBufferSend(stream_buffer, tx_record, record, 0U);
+                    break;
+                case kSTREAM_BENCH_StreamZeroCopy:
+                    done = xStreamBufferReserve(stream_buffer, record, &region, 0U);
+                    if (done != 0U)
+                    {
+                        fill_region(&region, record, (uint8_t)tx_seq);
+                        done = xStreamBufferCommit(stream_buffer, record);
+                    }
+                    break;
+                case kSTREAM_BENCH_MessageCopy:
+                    memset(tx_record, (uint8_t)tx_seq, record);
+                    done = xMessageBufferSend(message_buffer, tx_record, record, 0U);
+                    break;
+                default:
+                    done = xMessageBufferReserve(message_buffer, record, &region, 0U);
+                    if (done != 0U)
+                    {
+                        fill_region(&region, record, (uint8_t)tx_seq);
+                        done = xMessageBufferCommit(message_buffer, record);
+                    }
+                    break;
+            }
+            if (done == 0U)
+            {
+                tx_seq--;
+                break;
+            }
+        }
+
+        while (rx_seq != tx_seq)
+        {
+            rx_seq++;
+            switch (path)
+            {
+                case kSTREAM_BENCH_StreamCopy:
+                    length = xStreamBufferReceive(stream_buffer, rx_record, record, 0U);
+                    check_part(rx_record, length, (uint8_t)rx_seq);
+                    break;
+                case kSTREAM_BENCH_StreamZeroCopy:
+                    length = xStreamBufferAcquire(stream_buffer, &region, 0U);
+                    length = (length < record) ? length : record;
+                    check_region(&region, length, (uint8_t)rx_seq);
+                    xStreamBufferRelease(stream_buffer, length);
+                    break;
+                case kSTREAM_BENCH_MessageCopy:
+                    length = xMessageBufferReceive(message_buffer, rx_record, sizeof(rx_record), 0U);
+                    check_part(rx_record, length, (uint8_t)rx_seq);
+                    break;
+                default:
+                    length = xMessageBufferAcquire(message_buffer, &region, 0U);
+                    check_region(&region, length, (uint8_t)rx_seq);
+                    xMessageBufferRelease(message_buffer);
+                    break;
+            }
+            if (length != record)
+            {
+                corrupted += record;
+            }
+            total += length;
+        }
+    }
+
+    /* Bytes per second */
+    return (uint64_t)total * 1000000000ULL / (bench_now_ns() - start);
+}
+
+/*!
+ * @brief Measures the throughput of stream and message buffers for 4 B to 4 KB records.
+ */
+static void stream_bench_task(void *pvParameters)
+{
+    uint64_t best, rate;
+    uint32_t n, path, run;
+
+    printf("FreeRTOS %s stream buffer zero-copy benchmark, %u bytes per record size\r\n", tskKERNEL_VERSION_NUMBER,
+           (unsigned)STREAM_BENCH_BYTES);
+    printf("%-8s %12s %12s %12s %12s\r\n", "record", "stream copy", "zero-copy", "msg copy", "zero-copy");
+
+    stream_buffer  = xStreamBufferCreate(STREAM_BENCH_BUFFER_SIZE, 1U);
+    message_buffer = xMessageBufferCreate(STREAM_BENCH_BUFFER_SIZE);
+    configASSERT((stream_buffer != NULL) && (message_buffer != NULL));
+
+    for (n = 0U; n < sizeof(record_sizes) / sizeof(record_sizes[0]); n++)
+    {
+        printf("%-8u", (unsigned)record_sizes[n]);
+        for (path = 0U; path < kSTREAM_BENCH_PathCount; path++)
+        {
+            best = 0U;
+            for (run = 0U; run < STREAM_BENCH_RUNS; run++)
+            {
+                rate = run_path((stream_bench_path_t)path, record_sizes[n]);
+                best = (rate > best) ? rate : best;
+            }
+            printf(" %12u", (unsigned)(best / 1000U));
+        }
+        printf("\r\n");
+    }
+
+    printf("kB/s, best of %u runs; wrapped regions: %u, corrupted bytes: %u\r\n", (unsigned)STREAM_BENCH_RUNS,
+           (unsigned)wrapped_regions, (unsigned)corrupted);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(stream_bench_task, "stream", configMINIMAL_STACK_SIZE, NULL, STREAM_BENCH_TASK_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
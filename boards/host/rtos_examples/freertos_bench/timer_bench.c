@@ -0,0 +1,200 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*System includes.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of measured batches per operation and timer count */
+#ifndef TIMER_BENCH_ROUNDS
+#define TIMER_BENCH_ROUNDS (1000U)
+#endif
+
+/* Commands sent per batch, the timer queue must hold them all */
+#define TIMER_BENCH_BATCH (configTIMER_QUEUE_LENGTH)
+#define TIMER_BENCH_MAX_TIMERS (1000U)
+
+/* Long enough for no timer to expire during the benchmark */
+#define TIMER_BENCH_MIN_PERIOD (10000U)
+#define TIMER_BENCH_MAX_PERIOD (60000U)
+
+#define TIMER_BENCH_SEED (0x12345678U)
+#define TIMER_BENCH_TASK_PRIORITY (2U)
+
+#if (configUSE_TIMER_WHEEL == 1)
+#define TIMER_BENCH_NAME "timer wheel"
+#else
+#define TIMER_BENCH_NAME "sorted list"
+#endif
+
+typedef enum _timer_bench_op
+{
+    kTIMER_BENCH_Start = 0U,
+    kTIMER_BENCH_Stop,
+    kTIMER_BENCH_Reset,
+    kTIMER_BENCH_OpCount,
+} timer_bench_op_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const uint32_t timer_counts[] = {10U, 100U, 1000U};
+
+static TimerHandle_t timers[TIMER_BENCH_MAX_TIMERS];
+static uint32_t op_ns[kTIMER_BENCH_OpCount][TIMER_BENCH_ROUNDS];
+static volatile uint32_t expired_count;
+static uint32_t prng_state = TIMER_BENCH_SEED;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void vAssertCalled(const char *file, int line)
+{
+    fprintf(stderr, "ASSERT %s:%d\r\n", file, line);
+    abort();
+}
+
+/* xorshift32, the same timers are used with both timer implementations */
+static uint32_t prng_next(void)
+{
+    prng_state ^= prng_state << 13;
+    prng_state ^= prng_state >> 17;
+    prng_state ^= prng_state << 5;
+    return prng_state;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t median(uint32_t *samples, uint32_t count)
+{
+    qsort(samples, count, sizeof(samples[0]), compare_u32);
+    return samples[count / 2U];
+}
+
+static void timer_callback(TimerHandle_t timer)
+{
+    expired_count++;
+}
+
+/*!
+ * @brief Sends one batch of commands and returns the time per command.
+ *
+ * The commands are queued with the scheduler suspended, the timer service task
+ * has the highest priority and processes the whole batch when the scheduler is
+ * resumed, so the context switches are shared by TIMER_BENCH_BATCH commands.
+ */
+static uint32_t run_batch(timer_bench_op_t op, uint32_t first, uint32_t count)
+{
+    uint64_t start;
+    uint32_t n;
+
+    start = bench_now_ns();
+    vTaskSuspendAll();
+    for (n = 0U; n < TIMER_BENCH_BATCH; n++)
+    {
+        TimerHandle_t timer = timers[(first + n) % count];
+
+        switch (op)
+        {
+            case kTIMER_BENCH_Start:
+                xTimerStart(timer, 0U);
+                break;
+            case kTIMER_BENCH_Stop:
+                xTimerStop(timer, 0U);
+                break;
+            default:
+                xTimerReset(timer, 0U);
+                break;
+        }
+    }
+    xTaskResumeAll();
+
+    return (uint32_t)((bench_now_ns() - start) / TIMER_BENCH_BATCH);
+}
+
+/*!
+ * @brief Measures start, stop and reset with 10, 100 and 1000 active timers.
+ */
+static void timer_bench_task(void *pvParameters)
+{
+    uint32_t created = 0U;
+    uint32_t n, round, count, first;
+
+    printf("FreeRTOS %s %s benchmark, %u batches of %u commands\r\n", tskKERNEL_VERSION_NUMBER, TIMER_BENCH_NAME,
+           (unsigned)TIMER_BENCH_ROUNDS, (unsigned)TIMER_BENCH_BATCH);
+    printf("%-8s %8s %8s %8s\r\n", "timers", "start", "stop", "reset");
+
+    for (n = 0U; n < sizeof(timer_counts) / sizeof(timer_counts[0]); n++)
+    {
+        count = timer_counts[n];
+        for (; created < count; created++)
+        {
+            TickType_t period = TIMER_BENCH_MIN_PERIOD + prng_next() % (TIMER_BENCH_MAX_PERIOD - TIMER_BENCH_MIN_PERIOD);
+
+            timers[created] = xTimerCreate("bench", period, pdFALSE, NULL, timer_callback);
+            configASSERT(timers[created] != NULL);
+            xTimerStart(timers[created], portMAX_DELAY);
+        }
+
+        /* Stop then start the same timers, so each start inserts a timer among count - 1 others */
+        for (round = 0U; round < TIMER_BENCH_ROUNDS; round++)
+        {
+            first = prng_next() % count;
+            op_ns[kTIMER_BENCH_Stop][round]  = run_batch(kTIMER_BENCH_Stop, first, count);
+            op_ns[kTIMER_BENCH_Start][round] = run_batch(kTIMER_BENCH_Start, first, count);
+            op_ns[kTIMER_BENCH_Reset][round] = run_batch(kTIMER_BENCH_Reset, prng_next() % count, count);
+        }
+
+        printf("%-8u %8u %8u %8u\r\n", (unsigned)count, (unsigned)median(op_ns[kTIMER_BENCH_Start], TIMER_BENCH_ROUNDS),
+               (unsigned)median(op_ns[kTIMER_BENCH_Stop], TIMER_BENCH_ROUNDS),
+               (unsigned)median(op_ns[kTIMER_BENCH_Reset], TIMER_BENCH_ROUNDS));
+    }
+
+    printf("ns per command, median; timers expired during the benchmark: %u\r\n", (unsigned)expired_count);
+    fflush(stdout);
+
+    vTaskEndScheduler();
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    if (xTaskCreate(timer_bench_task, "timer", configMINIMAL_STACK_SIZE, NULL, TIMER_BENCH_TASK_PRIORITY, NULL) !=
+        pdPASS)
+    {
+        printf("Task creation failed!.\r\n");
+        return 1;
+    }
+    vTaskStartScheduler();
+
+    return 0;
+}
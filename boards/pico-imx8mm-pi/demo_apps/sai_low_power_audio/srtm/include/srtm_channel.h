@@ -60,6 +60,18 @@ srtm_status_t SRTM_Channel_Stop(srtm_channel_t channel);
  */
 srtm_status_t SRTM_Channel_SendData(srtm_channel_t channel, void *data, uint32_t len);
 
+/*!
+ * @brief Give received data back to SRTM channel.
+ *
+ * Used by the dispatcher with SRTM_DISPATCHER_CONFIG_RX_ZERO_COPY, once the
+ * message referencing the channel buffer is processed. Does nothing for a
+ * channel without a releaseData hook.
+ *
+ * @param channel SRTM channel the data was received from.
+ * @param data start address of received data.
+ */
+void SRTM_Channel_ReleaseData(srtm_channel_t channel, void *data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,17 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
+/**
+* @brief SRTM dispatcher message priorities
+*
+* The dispatcher handles the queued messages by decreasing priority, and in
+* queuing order within a priority. It keeps SRTM_DISPATCHER_CONFIG_PRIO_NUM
+* levels (default 8, see srtm_dispatcher_struct.h): the priorities below
+* SRTM_DISPATCHER_CONFIG_PRIO_NUM - 1 each have their own level, all the higher
+* ones are clamped to the last level. This includes the priorities up to 255
+* set by the peer core in the packet head of a received message.
+*/
+
 /**
 * @brief SRTM response callback function
 */
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __SRTM_AUDIO_PCM_H__
+#define __SRTM_AUDIO_PCM_H__
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup srtm_service
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Use the Cortex-M4 SIMD instructions, the C reference of the kernels otherwise. */
+#ifndef SRTM_AUDIO_PCM_USE_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define SRTM_AUDIO_PCM_USE_SIMD (1)
+#else
+#define SRTM_AUDIO_PCM_USE_SIMD (0)
+#endif
+#endif
+
+/*! @brief Gain of 1.0, the gains are Q14 values from 0 to 2.0 excluded. */
+#define SRTM_AUDIO_PCM_GAIN_UNITY (0x4000)
+
+/*! @brief Most streams mixed by SRTM_AudioPcm_Mix(). */
+#ifndef SRTM_AUDIO_PCM_MAX_MIX_STREAMS
+#define SRTM_AUDIO_PCM_MAX_MIX_STREAMS (8U)
+#endif
+
+/**
+ * @brief PCM sample formats, the same values as the audio service sample formats.
+ */
+typedef enum _srtm_audio_pcm_format
+{
+    SRTM_AudioPcmS16 = 0, /*!< 16 bits samples in 16 bits. */
+    SRTM_AudioPcmS24 = 1, /*!< 24 bits samples in the LSBs of 32 bits, sign extended on output, top byte ignored
+                               on input. */
+    SRTM_AudioPcmS32 = 2, /*!< 32 bits samples in 32 bits. */
+} srtm_audio_pcm_format_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Get the size in bytes of a sample in memory.
+ *
+ * @param format sample format.
+ * @return 2 for S16, 4 for S24 and S32.
+ */
+uint32_t SRTM_AudioPcm_GetSampleSize(srtm_audio_pcm_format_t format);
+
+/*!
+ * @brief Convert samples from a format to another. Narrowing keeps the MSBs (truncation), widening puts the
+ *        sample in the MSBs of the wider format. The buffers are 4 bytes aligned, dst and src may be the same
+ *        buffer when the formats have the same sample size.
+ *
+ * @param dst destination samples.
+ * @param dstFormat destination format.
+ * @param src source samples.
+ * @param srcFormat source format.
+ * @param samples number of samples, all channels included.
+ */
+void SRTM_AudioPcm_Convert(void *dst,
+                           srtm_audio_pcm_format_t dstFormat,
+                           const void *src,
+                           srtm_audio_pcm_format_t srcFormat,
+                           uint32_t samples);
+
+/*!
+ * @brief Interleave channels: frame n of dst holds sample n of each src buffer in the order of src.
+ *        The buffers are 4 bytes aligned.
+ *
+ * @param dst interleaved frames.
+ * @param src array of channels buffers.
+ * @param channels number of channels.
+ * @param frames number of frames.
+ * @param format sample format of dst and src.
+ */
+void SRTM_AudioPcm_Interleave(
+    void *dst, const void *const *src, uint32_t channels, uint32_t frames, srtm_audio_pcm_format_t format);
+
+/*!
+ * @brief De-interleave channels: sample n of each dst buffer is taken from frame n of src.
+ *        The buffers are 4 bytes aligned.
+ *
+ * @param dst array of channels buffers.
+ * @param src interleaved frames.
+ * @param channels number of channels.
+ * @param frames number of frames.
+ * @param format sample format of dst and src.
+ */
+void SRTM_AudioPcm_Deinterleave(
+    void *const *dst, const void *src, uint32_t channels, uint32_t frames, srtm_audio_pcm_format_t format);
+
+/*!
+ * @brief Apply a gain to samples, with saturation. The buffers are 4 bytes aligned, dst and src may be the same
+ *        buffer.
+ *
+ * @param dst destination samples.
+ * @param src source samples.
+ * @param format sample format of dst and src.
+ * @param samples number of samples, all channels included.
+ * @param gain Q14 gain, SRTM_AUDIO_PCM_GAIN_UNITY for 1.0.
+ */
+void SRTM_AudioPcm_Gain(void *dst, const void *src, srtm_audio_pcm_format_t format, uint32_t samples, int16_t gain);
+
+/*!
+ * @brief Mix S16 streams of the same layout, each with its gain, into dst. The sum is saturated once, when
+ *        converted to the dst format. The buffers are 4 bytes aligned.
+ *
+ * @param dst mixed samples.
+ * @param dstFormat format of dst.
+ * @param src array of S16 streams.
+ * @param gain array of Q14 gains of the streams, SRTM_AUDIO_PCM_GAIN_UNITY for 1.0.
+ * @param streams number of streams, up to SRTM_AUDIO_PCM_MAX_MIX_STREAMS.
+ * @param samples number of samples of each stream, all channels included.
+ */
+void SRTM_AudioPcm_Mix(void *dst,
+                       srtm_audio_pcm_format_t dstFormat,
+                       const int16_t *const *src,
+                       const int16_t *gain,
+                       uint32_t streams,
+                       uint32_t samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
+
+#endif /* __SRTM_AUDIO_PCM_H__ */
@@ -67,6 +67,7 @@
 /* Audio Service Sample Format definition */
 #define SRTM_AUDIO_SAMPLE_FORMAT_S16_LE (0x0U)
 #define SRTM_AUDIO_SAMPLE_FORMAT_S24_LE (0x1U)
+#define SRTM_AUDIO_SAMPLE_FORMAT_S32_LE (0x2U)
 
 /* Audio Service Channel identifier definition */
 #define SRTM_AUDIO_CHANNEL_LEFT (0x0U)
@@ -78,8 +79,21 @@ typedef struct _srtm_audio_service
 {
     struct _srtm_service service;
     srtm_list_t ifaces;
+    uint32_t coalescePeriods;      /* periods done per notification. */
+    uint32_t coalesceMaxLatencyMs; /* longest delay of a period done notification, 0 for no limit. */
 } * srtm_audio_service_t;
 
+/* Period done coalescing of a stream */
+struct _srtm_audio_coalesce
+{
+    uint32_t byteRate;  /* stream bytes per second, 0 if unknown. */
+    uint32_t periods;   /* periods done per notification. */
+    uint32_t pending;   /* periods done not notified yet. */
+    uint32_t periodIdx; /* latest period done. */
+    uint32_t probing;   /* period done still notified one by one, the pacing of the stream is not known yet. */
+    bool paced;         /* peer core sends period ready, every period done is notified. */
+};
+
 /* Audio interface */
 typedef struct _srtm_audio_iface
 {
@@ -91,6 +105,7 @@ typedef struct _srtm_audio_iface
     srtm_channel_t channel;
     srtm_list_t freeProcs;
     uint32_t useCount;
+    struct _srtm_audio_coalesce coalesce[2]; /* indexed by srtm_audio_dir_t */
 } * srtm_audio_iface_t;
 
 /*******************************************************************************
@@ -172,10 +187,26 @@ static srtm_status_t SRTM_AudioService_PeriodDone(srtm_service_t service,
     uint32_t primask;
     srtm_list_t *list;
     srtm_procedure_t proc = NULL;
+    struct _srtm_audio_coalesce *coalesce;
 
     assert(iface);
 
+    coalesce = &iface->coalesce[dir];
+
     primask = DisableGlobalIRQ();
+    coalesce->periodIdx = periodIdx;
+    if (coalesce->probing)
+    {
+        /* Until the peer core had the time to send a period ready, the stream may be paced */
+        coalesce->probing--;
+    }
+    else if (!coalesce->paced && ++coalesce->pending < coalesce->periods)
+    {
+        /* Notified along with a later period done */
+        EnableGlobalIRQ(primask);
+        return SRTM_Status_Success;
+    }
+    coalesce->pending = 0;
     if (!SRTM_List_IsEmpty(&iface->freeProcs))
     {
         list = iface->freeProcs.next;
@@ -201,6 +232,79 @@ static srtm_status_t SRTM_AudioService_PeriodDone(srtm_service_t service,
     return SRTM_Dispatcher_PostProc(service->dispatcher, proc);
 }
 
+/* Bytes per second of the stream, 0 for the formats whose rate is not known */
+static uint32_t SRTM_AudioService_GetByteRate(uint8_t format, uint8_t channels, uint32_t srate)
+{
+    uint32_t sampleSize;
+
+    switch (format)
+    {
+        case SRTM_AUDIO_SAMPLE_FORMAT_S16_LE:
+            sampleSize = 2U;
+            break;
+        case SRTM_AUDIO_SAMPLE_FORMAT_S24_LE:
+        case SRTM_AUDIO_SAMPLE_FORMAT_S32_LE:
+            /* 24 bits samples are in 32 bits */
+            sampleSize = 4U;
+            break;
+        default:
+            return 0;
+    }
+
+    return srate * sampleSize * (channels == SRTM_AUDIO_CHANNEL_STEREO ? 2U : 1U);
+}
+
+/* CALLED IN SRTM DISPATCHER TASK */
+static void SRTM_AudioService_SetCoalescing(srtm_audio_service_t handle,
+                                            srtm_audio_iface_t iface,
+                                            srtm_audio_dir_t dir,
+                                            uint32_t periodSize)
+{
+    struct _srtm_audio_coalesce *coalesce = &iface->coalesce[dir];
+    uint32_t periods = handle->coalescePeriods;
+    uint64_t latencyPeriods;
+
+    if (periods > 1U && handle->coalesceMaxLatencyMs)
+    {
+        if (coalesce->byteRate && periodSize)
+        {
+            /* The first period done held back is notified periods - 1 periods later */
+            latencyPeriods =
+                (uint64_t)handle->coalesceMaxLatencyMs * coalesce->byteRate / (1000U * (uint64_t)periodSize) + 1U;
+            periods = MIN(periods, (uint32_t)latencyPeriods);
+        }
+        else
+        {
+            /* The latency cannot be bounded */
+            periods = 1U;
+        }
+    }
+
+    coalesce->periods = periods ? periods : 1U;
+    coalesce->pending = 0;
+}
+
+/* CALLED IN SRTM DISPATCHER TASK */
+static void SRTM_AudioService_FlushPeriodDone(srtm_audio_service_t handle,
+                                              srtm_audio_iface_t iface,
+                                              srtm_audio_dir_t dir)
+{
+    struct _srtm_audio_coalesce *coalesce = &iface->coalesce[dir];
+    uint32_t primask;
+    uint32_t pending;
+
+    primask = DisableGlobalIRQ();
+    pending = coalesce->pending;
+    coalesce->pending = 0;
+    EnableGlobalIRQ(primask);
+
+    if (pending && iface->channel)
+    {
+        SRTM_AudioService_HandlePeriodDone(handle->service.dispatcher, dir, handle,
+                                           (((uint32_t)iface->index) << 24U) | (coalesce->periodIdx & 0xFFFFFFU));
+    }
+}
+
 static uint16_t SRTM_AudioService_GetRespLen(uint8_t command)
 {
     return sizeof(struct _srtm_audio_payload);
@@ -290,6 +394,11 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     }
                     break;
                 case SRTM_AUDIO_CMD_TX_START:
+                    /* The pacing is learnt again: the first periods of a coalescing window are notified one by
+                     * one, the stream runs free if the peer core sends no period ready meanwhile */
+                    iface->coalesce[SRTM_AudioDirTx].paced = false;
+                    iface->coalesce[SRTM_AudioDirTx].probing = iface->coalesce[SRTM_AudioDirTx].periods;
+                    iface->coalesce[SRTM_AudioDirTx].pending = 0;
                     if (sai && sai->start)
                     {
                         status = sai->start(sai, SRTM_AudioDirTx, audioReq->index);
@@ -310,6 +419,11 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    if (status == SRTM_Status_Success)
+                    {
+                        /* The peer core gets the position where the stream paused */
+                        SRTM_AudioService_FlushPeriodDone(handle, iface, SRTM_AudioDirTx);
+                    }
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -334,6 +448,8 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    /* The adapter is back in free run */
+                    iface->coalesce[SRTM_AudioDirTx].paced = false;
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -367,6 +483,8 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                         status = sai->setParam(sai, SRTM_AudioDirTx, audioReq->index, audioReq->format,
                                                audioReq->channels, audioReq->srate);
                     }
+                    iface->coalesce[SRTM_AudioDirTx].byteRate =
+                        SRTM_AudioService_GetByteRate(audioReq->format, audioReq->channels, audioReq->srate);
                     status = (status == SRTM_Status_Success && codec && codec->setParam) ?
                                  codec->setParam(codec, audioReq->index, audioReq->format, audioReq->srate) :
                                  status;
@@ -383,6 +501,7 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    SRTM_AudioService_SetCoalescing(handle, iface, SRTM_AudioDirTx, audioReq->periodSize);
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -436,6 +555,11 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     }
                     break;
                 case SRTM_AUDIO_CMD_RX_START:
+                    /* The pacing is learnt again: the first periods of a coalescing window are notified one by
+                     * one, the stream runs free if the peer core sends no period ready meanwhile */
+                    iface->coalesce[SRTM_AudioDirRx].paced = false;
+                    iface->coalesce[SRTM_AudioDirRx].probing = iface->coalesce[SRTM_AudioDirRx].periods;
+                    iface->coalesce[SRTM_AudioDirRx].pending = 0;
                     if (sai && sai->start)
                     {
                         status = sai->start(sai, SRTM_AudioDirRx, audioReq->index);
@@ -456,6 +580,11 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    if (status == SRTM_Status_Success)
+                    {
+                        /* The peer core gets the position where the stream paused */
+                        SRTM_AudioService_FlushPeriodDone(handle, iface, SRTM_AudioDirRx);
+                    }
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -480,6 +609,8 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    /* The adapter is back in free run */
+                    iface->coalesce[SRTM_AudioDirRx].paced = false;
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -513,6 +644,8 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                         status = sai->setParam(sai, SRTM_AudioDirRx, audioReq->index, audioReq->format,
                                                audioReq->channels, audioReq->srate);
                     }
+                    iface->coalesce[SRTM_AudioDirRx].byteRate =
+                        SRTM_AudioService_GetByteRate(audioReq->format, audioReq->channels, audioReq->srate);
                     status = (status == SRTM_Status_Success && codec && codec->setParam) ?
                                  codec->setParam(codec, audioReq->index, audioReq->format, audioReq->srate) :
                                  status;
@@ -529,6 +662,7 @@ static srtm_status_t SRTM_AudioService_Request(srtm_service_t service, srtm_requ
                     {
                         status = SRTM_Status_Error;
                     }
+                    SRTM_AudioService_SetCoalescing(handle, iface, SRTM_AudioDirRx, audioReq->periodSize);
                     audioRespBuf[1] =
                         status == SRTM_Status_Success ? SRTM_AUDIO_RETURN_CODE_SUCEESS : SRTM_AUDIO_RETURN_CODE_FAIL;
                     break;
@@ -661,12 +795,14 @@ static srtm_status_t SRTM_AudioService_Notify(srtm_service_t service, srtm_notif
                     {
                         status = sai->periodReady(sai, SRTM_AudioDirTx, payload->index, payload->periodIdx);
                     }
+                    iface->coalesce[SRTM_AudioDirTx].paced = true;
                     break;
                 case SRTM_AUDIO_NTF_RX_PERIOD_DONE:
                     if (sai && sai->periodReady)
                     {
                         status = sai->periodReady(sai, SRTM_AudioDirRx, payload->index, payload->periodIdx);
                     }
+                    iface->coalesce[SRTM_AudioDirRx].paced = true;
                     break;
                 default:
                     SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_WARN, "%s: command %d unsupported!\r\n", __func__, command);
@@ -702,6 +838,9 @@ static srtm_audio_iface_t SRTM_AudioService_CreateIface(srtm_audio_service_t han
         iface->sai = sai;
         iface->codec = codec;
         iface->channel = NULL;
+        memset(iface->coalesce, 0, sizeof(iface->coalesce));
+        iface->coalesce[SRTM_AudioDirRx].periods = 1U;
+        iface->coalesce[SRTM_AudioDirTx].periods = 1U;
         /* Create procedure messages list to be used in ISR */
         SRTM_List_Init(&iface->freeProcs);
         for (i = 0; i < SRTM_AUDIO_SERVICE_CONFIG_PROC_NUMBER; i++)
@@ -773,6 +912,8 @@ srtm_service_t SRTM_AudioService_Create(srtm_sai_adapter_t sai, srtm_codec_adapt
     handle->service.destroy = SRTM_AudioService_Destroy;
     handle->service.request = SRTM_AudioService_Request;
     handle->service.notify = SRTM_AudioService_Notify;
+    handle->coalescePeriods = SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_COALESCE;
+    handle->coalesceMaxLatencyMs = SRTM_AUDIO_SERVICE_CONFIG_PERIOD_DONE_MAX_LATENCY_MS;
 
     SRTM_List_Init(&handle->ifaces);
     iface = SRTM_AudioService_CreateIface(handle, 0, sai, codec);
@@ -828,6 +969,8 @@ void SRTM_AudioService_Reset(srtm_service_t service, srtm_peercore_t core)
             iface->sai->close(iface->sai, SRTM_AudioDirRx, iface->index);
             iface->sai->close(iface->sai, SRTM_AudioDirTx, iface->index);
         }
+        iface->coalesce[SRTM_AudioDirRx].paced = false;
+        iface->coalesce[SRTM_AudioDirTx].paced = false;
         iface->channel = NULL;
         iface->useCount = 0;
     }
@@ -859,3 +1002,13 @@ srtm_status_t SRTM_AudioService_SetAudioInterface(srtm_service_t service,
 
     return SRTM_Status_Success;
 }
+
+void SRTM_AudioService_SetPeriodDoneCoalescing(srtm_service_t service, uint32_t periods, uint32_t maxLatencyMs)
+{
+    srtm_audio_service_t handle = (srtm_audio_service_t)service;
+
+    assert(service);
+
+    handle->coalescePeriods = periods ? periods : 1U;
+    handle->coalesceMaxLatencyMs = maxLatencyMs;
+}
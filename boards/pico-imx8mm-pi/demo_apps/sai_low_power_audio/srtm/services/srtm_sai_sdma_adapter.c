@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "srtm_sai_sdma_adapter.h"
+#include "srtm_audio_pcm.h"
 #include "srtm_heap.h"
 #if (defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET)
 #include "fsl_memory.h"
@@ -47,8 +48,24 @@ struct _srtm_sai_sdma_local_runtime
     uint32_t periodSize;
     struct _srtm_sai_sdma_buf_runtime bufRtm;
     struct _srtm_sai_sdma_local_period periodsInfo[SRTM_SAI_SDMA_MAX_LOCAL_BUF_PERIODS];
+    uint32_t copySize;      /* bytes being copied by DMA to local buffer, 0 if no DMA copy is on going. */
+    volatile bool copyDone; /* DMA copy completed, the local buffer is updated in SRTM context. */
 };
 
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES >= SRTM_AUDIO_PCM_MAX_MIX_STREAMS
+#error "SRTM_SAI_SDMA_MAX_MIX_SOURCES must be below SRTM_AUDIO_PCM_MAX_MIX_STREAMS, the playback stream is mixed too"
+#endif
+
+/* M4 side stream mixed into the playback stream */
+struct _srtm_sai_sdma_mix_source
+{
+    srtm_sai_sdma_mix_fill_t fill; /* NULL if the source is not set. */
+    void *param;
+    int16_t gain; /* Q14 gain of the source. */
+};
+#endif
+
 typedef struct _srtm_sai_sdma_runtime
 {
     srtm_audio_state_t state;
@@ -63,11 +80,21 @@ typedef struct _srtm_sai_sdma_runtime
     uint32_t periods;
     uint32_t readyIdx;                        /* period ready index. */
     srtm_procedure_t proc;                    /* proc message to trigger DMA transfer in SRTM context. */
+    srtm_procedure_t copyProc;                /* proc message to handle local buffer DMA copy done in SRTM context. */
     struct _srtm_sai_sdma_buf_runtime bufRtm; /* buffer provided by audio client. */
     srtm_sai_sdma_local_buf_t localBuf;
     struct _srtm_sai_sdma_local_runtime localRtm; /* buffer set by application. */
     bool freeRun;               /* flag to indicate that no periodReady will be sent by audio client. */
     uint32_t finishedBufOffset; /* offset from bufAddr where the data transfer has completed. */
+    sdma_handle_t copyDmaHandle;          /* SDMA handle of the local buffer copy. */
+    sdma_context_data_t copyContext;      /* SDMA channel context of the local buffer copy. */
+    int16_t gain;                         /* Q14 gain applied in the local buffer copy. */
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+    struct _srtm_sai_sdma_mix_source mixSources[SRTM_SAI_SDMA_MAX_MIX_SOURCES]; /* mixed in the local buffer copy. */
+#endif
+#if SRTM_SAI_SDMA_COPY_STATS
+    srtm_sai_sdma_copy_stats_t copyStats; /* local buffer copy statistics. */
+#endif
 } * srtm_sai_sdma_runtime_t;
 
 /* SAI SDMA adapter */
@@ -97,6 +124,10 @@ static const sai_mono_stereo_t saiChannelMap[] = {kSAI_MonoLeft, kSAI_MonoRight,
 #ifdef SRTM_DEBUG_MESSAGE_FUNC
 static const char *saiDirection[] = {"Rx", "Tx"};
 #endif
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+/* Samples of the mix sources, only used in the SRTM dispatcher context. uint32_t keeps them 4 bytes aligned. */
+static uint32_t mixBlocks[SRTM_SAI_SDMA_MAX_MIX_SOURCES][SRTM_SAI_SDMA_MIX_BLOCK_SAMPLES / 2U];
+#endif
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -167,6 +198,28 @@ static void SRTM_SaiSdmaAdapter_RecycleTxMessage(srtm_message_t msg, void *param
     handle->txRtm.proc = msg;
 }
 
+static void SRTM_SaiSdmaAdapter_RecycleCopyMessage(srtm_message_t msg, void *param)
+{
+    srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)param;
+    srtm_sai_sdma_runtime_t rtm = &handle->txRtm;
+    uint32_t primask;
+
+    assert(rtm->copyProc == NULL);
+
+    primask = DisableGlobalIRQ();
+    if (rtm->localRtm.copyDone && rtm->state == SRTM_AudioStateStarted)
+    {
+        /* The DMA copy started by this proc completed before the proc was recycled */
+        EnableGlobalIRQ(primask);
+        SRTM_Dispatcher_PostProc(handle->adapter.service->dispatcher, msg);
+    }
+    else
+    {
+        rtm->copyProc = msg;
+        EnableGlobalIRQ(primask);
+    }
+}
+
 static void SRTM_SaiSdmaAdapter_RecycleRxMessage(srtm_message_t msg, void *param)
 {
     srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)param;
@@ -195,6 +248,8 @@ static void SRTM_SaiSdmaAdaptor_ResetLocalBuf(srtm_sai_sdma_runtime_t rtm)
             rtm->localRtm.periodsInfo[i].remoteIdx = 0;
             rtm->localRtm.periodsInfo[i].remoteOffset = 0;
         }
+        rtm->localRtm.copySize = 0;
+        rtm->localRtm.copyDone = false;
     }
 }
 
@@ -260,16 +315,138 @@ static void SRTM_SaiSdmaAdapter_DmaTransfer(srtm_sai_sdma_adapter_t handle, srtm
     }
 }
 
+static void SRTM_SaiSdmaAdapter_DmaCopy(srtm_sai_sdma_runtime_t rtm, uint8_t *dst, uint8_t *src, uint32_t size)
+{
+    sdma_transfer_config_t config = {0};
+
+    SDMA_PrepareTransfer(&config, (uint32_t)src, (uint32_t)dst, 4U, 4U, 4U, size, 0U, kSDMA_PeripheralNormal,
+                         kSDMA_MemoryToMemory);
+    SDMA_SubmitTransfer(&rtm->copyDmaHandle, &config);
+    SDMA_StartTransfer(&rtm->copyDmaHandle);
+}
+
+static void SRTM_SaiSdmaAdapter_LocalBufferFilled(srtm_sai_sdma_runtime_t rtm, uint32_t size)
+{
+    srtm_sai_sdma_buf_runtime_t srcRtm = &rtm->bufRtm;
+    srtm_sai_sdma_buf_runtime_t dstRtm = &rtm->localRtm.bufRtm;
+
+    srcRtm->offset += size;
+    dstRtm->offset += size;
+    if (srcRtm->offset == rtm->periodSize) /* whole remote buffer loaded */
+    {
+        rtm->localRtm.periodsInfo[dstRtm->leadIdx].endRemoteIdx = srcRtm->loadIdx;
+        srcRtm->loadIdx = (srcRtm->loadIdx + 1) % rtm->periods;
+        srcRtm->offset = 0;
+        srcRtm->remainingLoadPeriods--;
+    }
+
+    if (dstRtm->offset == rtm->localRtm.periodSize || srcRtm->offset == 0)
+    {
+        /* local period full or remote period ends */
+        rtm->localRtm.periodsInfo[dstRtm->leadIdx].dataSize = dstRtm->offset;
+        rtm->localRtm.periodsInfo[dstRtm->leadIdx].remoteIdx = srcRtm->loadIdx;
+        rtm->localRtm.periodsInfo[dstRtm->leadIdx].remoteOffset = srcRtm->offset;
+        dstRtm->leadIdx = (dstRtm->leadIdx + 1) % rtm->localBuf.periods;
+        dstRtm->remainingPeriods++;
+        dstRtm->remainingLoadPeriods++;
+        dstRtm->offset = 0;
+    }
+}
+
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+static bool SRTM_SaiSdmaAdapter_IsMixing(srtm_sai_sdma_runtime_t rtm)
+{
+    uint32_t i;
+
+    if (rtm->format != kAUDIO_Stereo16Bits)
+    {
+        return false;
+    }
+
+    for (i = 0; i < SRTM_SAI_SDMA_MAX_MIX_SOURCES; i++)
+    {
+        if (rtm->mixSources[i].fill)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Copies S16 samples of the shared buffer to the local buffer, mixed with the mix sources */
+static void SRTM_SaiSdmaAdapter_MixData(srtm_sai_sdma_runtime_t rtm, int16_t *dst, const int16_t *src, uint32_t samples)
+{
+    struct _srtm_sai_sdma_mix_source sources[SRTM_SAI_SDMA_MAX_MIX_SOURCES];
+    const int16_t *streams[SRTM_SAI_SDMA_MAX_MIX_SOURCES + 1U];
+    int16_t gains[SRTM_SAI_SDMA_MAX_MIX_SOURCES + 1U];
+    uint32_t i, n, count, filled;
+    int16_t *block;
+    uint32_t primask;
+
+    /* The sources may be changed by the application at any time */
+    primask = DisableGlobalIRQ();
+    memcpy(sources, rtm->mixSources, sizeof(sources));
+    EnableGlobalIRQ(primask);
+
+    while (samples)
+    {
+        count = MIN(samples, SRTM_SAI_SDMA_MIX_BLOCK_SAMPLES);
+        streams[0] = src;
+        gains[0] = rtm->gain;
+        n = 1U;
+        for (i = 0; i < SRTM_SAI_SDMA_MAX_MIX_SOURCES; i++)
+        {
+            if (sources[i].fill)
+            {
+                block = (int16_t *)mixBlocks[i];
+                filled = MIN(sources[i].fill(sources[i].param, block, count), count);
+                memset(block + filled, 0, (count - filled) * sizeof(int16_t));
+                streams[n] = block;
+                gains[n] = sources[i].gain;
+                n++;
+            }
+        }
+        SRTM_AudioPcm_Mix(dst, SRTM_AudioPcmS16, streams, gains, n, count);
+
+        dst += count;
+        src += count;
+        samples -= count;
+    }
+}
+#endif
+
 static void SRTM_SaiSdmaAdapter_CopyData(srtm_sai_sdma_adapter_t handle)
 {
     srtm_sai_sdma_runtime_t rtm;
     uint32_t srcSize, dstSize, size;
     srtm_sai_sdma_buf_runtime_t srcRtm, dstRtm;
     uint8_t *src, *dst;
+    bool mixing = false;
+#if SRTM_SAI_SDMA_COPY_STATS
+    uint32_t start = DWT->CYCCNT;
+    uint32_t primask;
+#endif
 
     rtm = &handle->txRtm;
     srcRtm = &rtm->bufRtm;
     dstRtm = &rtm->localRtm.bufRtm;
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+    mixing = SRTM_SaiSdmaAdapter_IsMixing(rtm);
+#endif
+
+    if (rtm->localRtm.copySize)
+    {
+        if (!rtm->localRtm.copyDone)
+        {
+            /* DMA copy still on going, its completion will bring us back here. */
+            return;
+        }
+        size = rtm->localRtm.copySize;
+        rtm->localRtm.copySize = 0;
+        rtm->localRtm.copyDone = false;
+        SRTM_SaiSdmaAdapter_LocalBufferFilled(rtm, size);
+    }
 
     while (srcRtm->remainingLoadPeriods && (rtm->localBuf.periods - dstRtm->remainingPeriods))
     {
@@ -278,31 +455,43 @@ static void SRTM_SaiSdmaAdapter_CopyData(srtm_sai_sdma_adapter_t handle)
         srcSize = rtm->periodSize - srcRtm->offset;
         dstSize = rtm->localRtm.periodSize - dstRtm->offset;
         size = MIN(srcSize, dstSize);
-        SRTM_SaidmaAdapter_LocalBufferUpdate((uint32_t *)(dst + dstRtm->offset), (uint32_t *)(src + srcRtm->offset),
-                                             size / 4U);
-
-        srcRtm->offset += size;
-        dstRtm->offset += size;
-        if (srcRtm->offset == rtm->periodSize) /* whole remote buffer loaded */
+#if SRTM_SAI_SDMA_COPY_STATS
+        rtm->copyStats.bytes += size;
+#endif
+        if (rtm->localBuf.dmaCopy && rtm->gain == SRTM_AUDIO_PCM_GAIN_UNITY && !mixing)
         {
-            rtm->localRtm.periodsInfo[dstRtm->leadIdx].endRemoteIdx = srcRtm->loadIdx;
-            srcRtm->loadIdx = (srcRtm->loadIdx + 1) % rtm->periods;
-            srcRtm->offset = 0;
-            srcRtm->remainingLoadPeriods--;
+            /* Local buffer is updated once the DMA copy completes. */
+            rtm->localRtm.copySize = size;
+            SRTM_SaiSdmaAdapter_DmaCopy(rtm, dst + dstRtm->offset, src + srcRtm->offset, size);
+            break;
         }
 
-        if (dstRtm->offset == rtm->localRtm.periodSize || srcRtm->offset == 0)
+        if (mixing)
+        {
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+            SRTM_SaiSdmaAdapter_MixData(rtm, (int16_t *)(dst + dstRtm->offset), (int16_t *)(src + srcRtm->offset),
+                                        size / sizeof(int16_t));
+#endif
+        }
+        else if (rtm->gain != SRTM_AUDIO_PCM_GAIN_UNITY && rtm->format <= kAUDIO_Stereo32Bits)
         {
-            /* local period full or remote period ends */
-            rtm->localRtm.periodsInfo[dstRtm->leadIdx].dataSize = dstRtm->offset;
-            rtm->localRtm.periodsInfo[dstRtm->leadIdx].remoteIdx = srcRtm->loadIdx;
-            rtm->localRtm.periodsInfo[dstRtm->leadIdx].remoteOffset = srcRtm->offset;
-            dstRtm->leadIdx = (dstRtm->leadIdx + 1) % rtm->localBuf.periods;
-            dstRtm->remainingPeriods++;
-            dstRtm->remainingLoadPeriods++;
-            dstRtm->offset = 0;
+            /* The PCM formats have the values of the PCM library formats */
+            SRTM_AudioPcm_Gain(dst + dstRtm->offset, src + srcRtm->offset, (srtm_audio_pcm_format_t)rtm->format,
+                               size / SRTM_AudioPcm_GetSampleSize((srtm_audio_pcm_format_t)rtm->format), rtm->gain);
         }
+        else
+        {
+            SRTM_SaidmaAdapter_LocalBufferUpdate((uint32_t *)(dst + dstRtm->offset),
+                                                 (uint32_t *)(src + srcRtm->offset), size / 4U);
+        }
+        SRTM_SaiSdmaAdapter_LocalBufferFilled(rtm, size);
     }
+#if SRTM_SAI_SDMA_COPY_STATS
+    /* The 64-bit sum is also updated by SRTM_SaiSdmaCopyCallback() in the SDMA ISR */
+    primask = DisableGlobalIRQ();
+    rtm->copyStats.cycles += DWT->CYCCNT - start;
+    EnableGlobalIRQ(primask);
+#endif
 }
 
 static void SRTM_SaiSdmaAdapter_AddNewPeriods(srtm_sai_sdma_runtime_t rtm, uint32_t periodIdx)
@@ -332,9 +521,9 @@ static void SRTM_SaiSdmaAdapter_Transfer(srtm_sai_sdma_adapter_t handle, srtm_au
 
     if (dir == SRTM_AudioDirTx && rtm->localBuf.buf)
     {
-        if (rtm->localRtm.bufRtm.remainingPeriods <= rtm->localBuf.threshold)
+        if (rtm->localRtm.copySize || rtm->localRtm.bufRtm.remainingPeriods <= rtm->localBuf.threshold)
         {
-            /* Copy data from remote buffer to local buffer. */
+            /* Copy data from remote buffer to local buffer, or go on with the DMA copy. */
             SRTM_SaiSdmaAdapter_CopyData(handle);
         }
     }
@@ -420,6 +609,28 @@ static void SRTM_SaiSdmaTxCallback(I2S_Type *sai, sai_sdma_handle_t *sdmaHandle,
     }
 }
 
+static void SRTM_SaiSdmaCopyCallback(sdma_handle_t *sdmaHandle, void *userData, bool transferDone, uint32_t bdIndex)
+{
+    srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)userData;
+    srtm_sai_sdma_runtime_t rtm = &handle->txRtm;
+    srtm_sai_adapter_t adapter = &handle->adapter;
+#if SRTM_SAI_SDMA_COPY_STATS
+    uint32_t start = DWT->CYCCNT;
+#endif
+
+    rtm->localRtm.copyDone = true;
+
+    if (adapter->service && rtm->state == SRTM_AudioStateStarted && rtm->copyProc)
+    {
+        /* Update local buffer and copy next data in SRTM context */
+        SRTM_Dispatcher_PostProc(adapter->service->dispatcher, rtm->copyProc);
+        rtm->copyProc = NULL;
+    }
+#if SRTM_SAI_SDMA_COPY_STATS
+    rtm->copyStats.cycles += DWT->CYCCNT - start;
+#endif
+}
+
 static void SRTM_SaiSdmaRxCallback(I2S_Type *sai, sai_sdma_handle_t *sdmaHandle, status_t status, void *userData)
 {
     srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)userData;
@@ -727,6 +938,13 @@ static srtm_status_t SRTM_SaiSdmaAdapter_Start(srtm_sai_adapter_t adapter, srtm_
         thisRtm->readyIdx = thisRtm->bufRtm.leadIdx;
     }
     SRTM_SaiSdmaAdaptor_ResetLocalBuf(thisRtm);
+    if (dir == SRTM_AudioDirTx && thisRtm->localBuf.buf && thisRtm->localBuf.dmaCopy)
+    {
+        SDMA_CreateHandle(&thisRtm->copyDmaHandle, handle->dma, thisRtm->localBuf.dmaCopyChannel,
+                          &thisRtm->copyContext);
+        thisRtm->copyDmaHandle.priority = thisRtm->localBuf.dmaCopyChannelPriority;
+        SDMA_SetCallback(&thisRtm->copyDmaHandle, SRTM_SaiSdmaCopyCallback, (void *)handle);
+    }
 
     SRTM_SaiSdmaAdapter_AddNewPeriods(thisRtm, thisRtm->readyIdx);
     SRTM_SaiSdmaAdapter_Transfer(handle, dir);
@@ -771,6 +989,13 @@ static srtm_status_t SRTM_SaiSdmaAdapter_End(srtm_sai_adapter_t adapter, srtm_au
         if (dir == SRTM_AudioDirTx)
         {
             SAI_TransferAbortSendSDMA(handle->sai, &thisRtm->saiHandle);
+            if (thisRtm->localRtm.copySize)
+            {
+                /* Drop the local buffer DMA copy on going, local buffer is reset on start. */
+                SDMA_AbortTransfer(&thisRtm->copyDmaHandle);
+                thisRtm->localRtm.copySize = 0;
+                thisRtm->localRtm.copyDone = false;
+            }
         }
         else
         {
@@ -1097,6 +1322,7 @@ srtm_sai_adapter_t SRTM_SaiSdmaAdapter_Create(I2S_Type *sai,
     handle = (srtm_sai_sdma_adapter_t)SRTM_Heap_Malloc(sizeof(struct _srtm_sai_sdma_adapter));
     assert(handle);
     memset(handle, 0, sizeof(struct _srtm_sai_sdma_adapter));
+    handle->txRtm.gain = SRTM_AUDIO_PCM_GAIN_UNITY;
 
     handle->sai = sai;
     handle->dma = dma;
@@ -1106,6 +1332,9 @@ srtm_sai_adapter_t SRTM_SaiSdmaAdapter_Create(I2S_Type *sai,
         handle->txRtm.proc = SRTM_Procedure_Create(SRTM_SaiSdmaAdapter_TxTransferProc, handle, NULL);
         assert(handle->txRtm.proc);
         SRTM_Message_SetFreeFunc(handle->txRtm.proc, SRTM_SaiSdmaAdapter_RecycleTxMessage, handle);
+        handle->txRtm.copyProc = SRTM_Procedure_Create(SRTM_SaiSdmaAdapter_TxTransferProc, handle, NULL);
+        assert(handle->txRtm.copyProc);
+        SRTM_Message_SetFreeFunc(handle->txRtm.copyProc, SRTM_SaiSdmaAdapter_RecycleCopyMessage, handle);
         /* If not support DSD mode, the ReconfigSai pointer sould be set to NULL. */
         handle->txConfig.ReconfigSai = SRTM_SaiSdmaAdapter_ReconfigSAI;
     }
@@ -1119,6 +1348,12 @@ srtm_sai_adapter_t SRTM_SaiSdmaAdapter_Create(I2S_Type *sai,
         handle->rxConfig.ReconfigSai = SRTM_SaiSdmaAdapter_ReconfigSAI;
     }
 
+#if SRTM_SAI_SDMA_COPY_STATS
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
     /* Adapter interfaces. */
     handle->adapter.open = SRTM_SaiSdmaAdapter_Open;
     handle->adapter.start = SRTM_SaiSdmaAdapter_Start;
@@ -1150,6 +1385,12 @@ void SRTM_SaiSdmaAdapter_Destroy(srtm_sai_adapter_t adapter)
         SRTM_Procedure_Destroy(handle->txRtm.proc);
     }
 
+    if (handle->txRtm.copyProc)
+    {
+        SRTM_Message_SetFreeFunc(handle->txRtm.copyProc, NULL, NULL);
+        SRTM_Procedure_Destroy(handle->txRtm.copyProc);
+    }
+
     if (handle->rxRtm.proc)
     {
         SRTM_Message_SetFreeFunc(handle->rxRtm.proc, NULL, NULL);
@@ -1177,3 +1418,58 @@ void SRTM_SaiSdmaAdapter_SetTxLocalBuf(srtm_sai_adapter_t adapter, srtm_sai_sdma
         handle->txRtm.localBuf.buf = NULL;
     }
 }
+
+void SRTM_SaiSdmaAdapter_SetTxGain(srtm_sai_adapter_t adapter, int16_t gain)
+{
+    srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)adapter;
+
+    assert(adapter);
+    assert(gain >= 0);
+
+    SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_INFO, "%s: 0x%x\r\n", __func__, gain);
+
+    handle->txRtm.gain = gain;
+}
+
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+void SRTM_SaiSdmaAdapter_SetTxMixSource(
+    srtm_sai_adapter_t adapter, uint32_t source, srtm_sai_sdma_mix_fill_t fill, void *param, int16_t gain)
+{
+    srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)adapter;
+    struct _srtm_sai_sdma_mix_source *mixSource;
+    uint32_t primask;
+
+    assert(adapter);
+    assert(source < SRTM_SAI_SDMA_MAX_MIX_SOURCES);
+    assert(gain >= 0);
+
+    SRTM_DEBUG_MESSAGE(SRTM_DEBUG_VERBOSE_INFO, "%s: %d 0x%x\r\n", __func__, source, gain);
+
+    mixSource = &handle->txRtm.mixSources[source];
+    primask = DisableGlobalIRQ();
+    mixSource->fill = fill;
+    mixSource->param = param;
+    mixSource->gain = gain;
+    EnableGlobalIRQ(primask);
+}
+#endif
+
+#if SRTM_SAI_SDMA_COPY_STATS
+void SRTM_SaiSdmaAdapter_GetCopyStats(srtm_sai_adapter_t adapter, srtm_sai_sdma_copy_stats_t *stats)
+{
+    srtm_sai_sdma_adapter_t handle = (srtm_sai_sdma_adapter_t)adapter;
+    srtm_sai_sdma_runtime_t rtm = &handle->txRtm;
+    uint32_t primask;
+
+    assert(adapter);
+    assert(stats);
+
+    primask = DisableGlobalIRQ();
+    *stats = rtm->copyStats;
+    rtm->copyStats.bytes = 0;
+    rtm->copyStats.cycles = 0;
+    EnableGlobalIRQ(primask);
+
+    stats->byteRate = rtm->srate * (rtm->channels == kSAI_Stereo ? 2U : 1U) * rtm->bitWidth / 8U;
+}
+#endif
@@ -22,6 +22,27 @@
 #define SRTM_SAI_SDMA_MAX_LOCAL_BUF_PERIODS (4)
 #define SRTM_SAI_SDMA_MAX_LOCAL_PERIOD_ALIGNMENT (4U)
 #define SRTM_SAI_SDMA_MAX_LOCAL_PERIOD_ALIGNMENT_MASK (SRTM_SAI_SDMA_MAX_LOCAL_PERIOD_ALIGNMENT - 1)
+
+/* Set to 1 to count the CPU cycles spent to copy the share buffer to the local buffer, see
+   SRTM_SaiSdmaAdapter_GetCopyStats(). The cycles are read from DWT->CYCCNT. */
+#ifndef SRTM_SAI_SDMA_COPY_STATS
+#define SRTM_SAI_SDMA_COPY_STATS (0)
+#endif
+
+/* Number of M4 side streams that can be mixed into the playback stream, see SRTM_SaiSdmaAdapter_SetTxMixSource().
+   Each one takes SRTM_SAI_SDMA_MIX_BLOCK_SAMPLES * 2 bytes of RAM. */
+#ifndef SRTM_SAI_SDMA_MAX_MIX_SOURCES
+#define SRTM_SAI_SDMA_MAX_MIX_SOURCES (0U)
+#endif
+/* Samples of each mix source fetched at once, even so that the blocks stay 4 bytes aligned. */
+#ifndef SRTM_SAI_SDMA_MIX_BLOCK_SAMPLES
+#define SRTM_SAI_SDMA_MIX_BLOCK_SAMPLES (128U)
+#endif
+
+/* Fills up to count S16 samples of a mix source, in the channel layout of the playback stream, and returns the
+   number of samples written. The remaining samples are silence. Called in the SRTM dispatcher context. */
+typedef uint32_t (*srtm_sai_sdma_mix_fill_t)(void *param, int16_t *samples, uint32_t count);
+
 typedef struct _srtm_sai_sdma_config
 {
     sai_config_t config;
@@ -50,8 +71,19 @@ typedef struct _srtm_sai_sdma_local_buf
     uint32_t periods;   /* periods in local buffer */
     uint32_t threshold; /* Threshold period number: under which will trigger copy from share buf to local buf
                            in playback case. */
+    bool dmaCopy;                   /* Copy from share buf to local buf with a SDMA memory to memory channel
+                                       instead of CPU. */
+    uint32_t dmaCopyChannel;        /* SDMA channel for the copy, not 0 and not used by SAI. */
+    uint8_t dmaCopyChannelPriority; /* SDMA channel priority for the copy. */
 } srtm_sai_sdma_local_buf_t;
 
+typedef struct _srtm_sai_sdma_copy_stats
+{
+    uint32_t bytes;    /* bytes copied from share buf to local buf */
+    uint64_t cycles;   /* CPU cycles spent in the copy, including the DMA setup and completion */
+    uint32_t byteRate; /* bytes per second of the playback stream */
+} srtm_sai_sdma_copy_stats_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -83,13 +115,56 @@ void SRTM_SaiSdmaAdapter_Destroy(srtm_sai_adapter_t adapter);
 /*!
 * @brief Set local buffer to use in DMA transfer. If local buffer is set, the audio data will be copied
 * from shared buffer to local buffer and then transfered to I2S interface. Otherwise the data will be
-* transfered from shared buffer to I2S interface directly.
+* transfered from shared buffer to I2S interface directly. The copy is done by CPU, or by the SDMA channel
+* localBuf->dmaCopyChannel when localBuf->dmaCopy is set.
 * NOTE: it must be called before service start.
 *
 * @param adapter SAI SDMA adapter to set.
 * @param localBuf Local buffer information to be set to the adapter TX path.
 */
 void SRTM_SaiSdmaAdapter_SetTxLocalBuf(srtm_sai_adapter_t adapter, srtm_sai_sdma_local_buf_t *localBuf);
+
+/*!
+ * @brief Set the gain of the playback stream. The gain is applied with saturation when the CPU copies the
+ * shared buffer to the local buffer, so it needs a local buffer, and a gain other than
+ * SRTM_AUDIO_PCM_GAIN_UNITY makes the copy use the CPU even if localBuf->dmaCopy is set. DSD streams
+ * are not scaled. It takes effect from the next period copied.
+ *
+ * @param adapter SAI SDMA adapter to set.
+ * @param gain Q14 gain from 0 to 0x7FFF, SRTM_AUDIO_PCM_GAIN_UNITY (default) for 1.0.
+ */
+void SRTM_SaiSdmaAdapter_SetTxGain(srtm_sai_adapter_t adapter, int16_t gain);
+
+#if SRTM_SAI_SDMA_MAX_MIX_SOURCES
+/*!
+ * @brief Set a stream of the M4, such as a prompt or a tone, to mix into the playback stream of the peer core.
+ * The sources are mixed with SRTM_AudioPcm_Mix() when the CPU copies the shared buffer to the local buffer, so
+ * it needs a local buffer, and a source set makes the copy use the CPU even if localBuf->dmaCopy is set. Only
+ * S16 playback streams are mixed, the sources of other formats are ignored. The mix is paced by the playback
+ * stream: the sources are only read while the peer core plays. It takes effect from the next period copied.
+ *
+ * @param adapter SAI SDMA adapter to set.
+ * @param source index of the source, below SRTM_SAI_SDMA_MAX_MIX_SOURCES.
+ * @param fill function that provides the samples of the source, NULL to remove the source.
+ * @param param parameter passed to fill.
+ * @param gain Q14 gain of the source from 0 to 0x7FFF, SRTM_AUDIO_PCM_GAIN_UNITY for 1.0.
+ */
+void SRTM_SaiSdmaAdapter_SetTxMixSource(
+    srtm_sai_adapter_t adapter, uint32_t source, srtm_sai_sdma_mix_fill_t fill, void *param, int16_t gain);
+#endif
+
+#if SRTM_SAI_SDMA_COPY_STATS
+/*!
+ * @brief Get the local buffer copy statistics since the previous call, and reset them.
+ *
+ * The CPU load of the copy in cycles per second of audio is cycles * byteRate / bytes.
+ *
+ * @param adapter SAI SDMA adapter to get the statistics from.
+ * @param stats Local buffer copy statistics.
+ */
+void SRTM_SaiSdmaAdapter_GetCopyStats(srtm_sai_adapter_t adapter, srtm_sai_sdma_copy_stats_t *stats);
+#endif
+
 /*!
  * @brief Get the audio service status.
  * @param sai adapter value.
@@ -57,3 +57,14 @@ srtm_status_t SRTM_Channel_SendData(srtm_channel_t channel, void *data, uint32_t
 
     return channel->sendData(channel, data, len);
 }
+
+void SRTM_Channel_ReleaseData(srtm_channel_t channel, void *data)
+{
+    assert(channel);
+
+    /* Channels that do not lend their buffers to the messages have no releaseData */
+    if (channel->releaseData)
+    {
+        channel->releaseData(channel, data);
+    }
+}
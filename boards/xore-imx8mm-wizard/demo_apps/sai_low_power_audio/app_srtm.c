@@ -23,6 +23,10 @@
 #include "srtm_sai_sdma_adapter.h"
 #include "srtm_rpmsg_endpoint.h"
 
+#if SRTM_SAI_SDMA_COPY_STATS
+#include "fsl_debug_console.h"
+#endif
+
 #if APP_SRTM_CODEC_USED_I2C
 #include "fsl_i2c_freertos.h"
 #include "srtm_i2c_codec_adapter.h"
@@ -36,8 +40,13 @@
 #define BUFFER_LEN (80 * 1024)
 uint8_t g_buffer[BUFFER_LEN];
 srtm_sai_sdma_local_buf_t g_local_buf = {
-    .buf = (uint8_t *)&g_buffer, .bufSize = BUFFER_LEN, .periods = SRTM_SAI_SDMA_MAX_LOCAL_BUF_PERIODS, .threshold = 1,
-
+    .buf = (uint8_t *)&g_buffer,
+    .bufSize = BUFFER_LEN,
+    .periods = SRTM_SAI_SDMA_MAX_LOCAL_BUF_PERIODS,
+    .threshold = 1,
+    .dmaCopy = APP_SRTM_LOCAL_BUF_DMA_COPY,
+    .dmaCopyChannel = APP_SAI_TX_COPY_DMA_CHANNEL,
+    .dmaCopyChannelPriority = APP_SAI_TX_COPY_DMA_CHANNEL_PRIORITY,
 };
 
 /*******************************************************************************
@@ -78,6 +87,9 @@ struct rpmsg_lite_instance *rpmsgHandle;
 
 void *rpmsgMonitorParam;
 TimerHandle_t linkupTimer;
+#if SRTM_SAI_SDMA_COPY_STATS
+TimerHandle_t copyStatsTimer;
+#endif
 #if APP_SRTM_CODEC_USED_I2C
 static codec_config_t codecConfig = {.I2C_SendFunc = Codec_I2C_SendFunc,
                                      .I2C_ReceiveFunc = Codec_I2C_ReceiveFunc,
@@ -325,6 +337,34 @@ static void APP_LinkupTimerCallback(TimerHandle_t xTimer)
     }
 }
 
+#if SRTM_SAI_SDMA_COPY_STATS
+/* Prints the M4 cycles spent refilling the local buffer per second of audio played */
+static void APP_CopyStatsTimerCallback(TimerHandle_t xTimer)
+{
+    srtm_sai_sdma_copy_stats_t stats;
+#if (configGENERATE_RUN_TIME_STATS == 1) && defined(configRUN_TIME_STATS_USE_DWT) && (configRUN_TIME_STATS_USE_DWT == 1)
+    static RunTimeStatsSnapshot_t last;
+    RunTimeStatsSnapshot_t now;
+#endif
+
+    SRTM_SaiSdmaAdapter_GetCopyStats(saiAdapter, &stats);
+    if (stats.bytes && stats.byteRate)
+    {
+        PRINTF("local buffer %s copy: %u bytes, %u cycles per audio second\r\n", g_local_buf.dmaCopy ? "DMA" : "CPU",
+               stats.bytes, (uint32_t)(stats.cycles * stats.byteRate / stats.bytes));
+    }
+#if (configGENERATE_RUN_TIME_STATS == 1) && defined(configRUN_TIME_STATS_USE_DWT) && (configRUN_TIME_STATS_USE_DWT == 1)
+    vPortRunTimeStatsGetSnapshot(&now);
+    if (now.ullTime != last.ullTime)
+    {
+        PRINTF("sleep residency: %u/1000\r\n",
+               (uint32_t)((now.ullSleepTime - last.ullSleepTime) * 1000U / (now.ullTime - last.ullTime)));
+    }
+    last = now;
+#endif
+}
+#endif
+
 static void APP_SRTM_NotifyPeerCoreReady(struct rpmsg_lite_instance *rpmsgHandle, bool ready)
 {
     if (rpmsgMonitor)
@@ -520,6 +560,12 @@ void APP_SRTM_Init(void)
     linkupTimer =
         xTimerCreate("Linkup", APP_MS2TICK(APP_LINKUP_TIMER_PERIOD_MS), pdFALSE, NULL, APP_LinkupTimerCallback);
     assert(linkupTimer);
+#if SRTM_SAI_SDMA_COPY_STATS
+    copyStatsTimer = xTimerCreate("CopyStats", APP_MS2TICK(APP_COPY_STATS_TIMER_PERIOD_MS), pdTRUE, NULL,
+                                  APP_CopyStatsTimerCallback);
+    assert(copyStatsTimer);
+    xTimerStart(copyStatsTimer, portMAX_DELAY);
+#endif
     /* Create SRTM dispatcher */
     disp = SRTM_Dispatcher_Create();
 
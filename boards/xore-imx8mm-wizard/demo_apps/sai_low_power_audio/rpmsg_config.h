@@ -21,6 +21,9 @@
 
 #define RL_USE_STATIC_API (0)
 
+/* Senders wait for the tx buffer notifications of Linux instead of polling every tick */
+#define RL_USE_TX_WAIT_EVENT (1)
+
 /* } END */
 
 #endif /* _RPMSG_CONFIG_H */
@@ -161,6 +161,7 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
         timeoutTicks = LPM_EnterTicklessIdle(timeoutMilliSec, &counter);
         if (timeoutTicks)
         {
+            portRUN_TIME_STATS_SLEEP_ENTER();
             if (APP_SRTM_ServiceIdle() && LPM_AllowSleep())
             {
                 LPM_MCORE_ChangeM4Clock(LPM_M4_LOW_FREQ);
@@ -183,6 +184,7 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
                 __ISB();
                 __WFI();
             }
+            portRUN_TIME_STATS_SLEEP_EXIT();
         }
         LPM_ExitTicklessIdle(timeoutTicks, counter);
     }
@@ -0,0 +1,335 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "fsl_common.h"
+
+#include "srtm_audio_pcm.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Q14 gains */
+#define SRTM_AUDIO_PCM_GAIN_SHIFT (14U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static inline int32_t SRTM_AudioPcm_Read(const void *buf, srtm_audio_pcm_format_t format, uint32_t i)
+{
+    int32_t value = format == SRTM_AudioPcmS16 ? ((const int16_t *)buf)[i] : ((const int32_t *)buf)[i];
+
+    /* The top byte of S24 samples is not always the sign extension */
+    return format == SRTM_AudioPcmS24 ? (int32_t)((uint32_t)value << 8) >> 8 : value;
+}
+
+static inline void SRTM_AudioPcm_Write(void *buf, srtm_audio_pcm_format_t format, uint32_t i, int32_t value)
+{
+    if (format == SRTM_AudioPcmS16)
+    {
+        ((int16_t *)buf)[i] = (int16_t)value;
+    }
+    else
+    {
+        ((int32_t *)buf)[i] = value;
+    }
+}
+
+static inline int32_t SRTM_AudioPcm_Saturate(int64_t value, uint32_t bits)
+{
+    int64_t max = ((int64_t)1 << (bits - 1U)) - 1;
+
+    return (int32_t)(value > max ? max : (value < -max - 1 ? -max - 1 : value));
+}
+
+/* Sample value in the format, from its MSBs aligned to 32 bits */
+static inline int32_t SRTM_AudioPcm_FromS32(int32_t value, srtm_audio_pcm_format_t format)
+{
+    return format == SRTM_AudioPcmS16 ? value >> 16 : (format == SRTM_AudioPcmS24 ? value >> 8 : value);
+}
+
+static inline int32_t SRTM_AudioPcm_ToS32(int32_t value, srtm_audio_pcm_format_t format)
+{
+    return (int32_t)((uint32_t)value << (format == SRTM_AudioPcmS16 ? 16U : (format == SRTM_AudioPcmS24 ? 8U : 0U)));
+}
+
+/* Mixed sum of Q14 products to the dst format */
+static inline int32_t SRTM_AudioPcm_FromMix(int64_t acc, srtm_audio_pcm_format_t format)
+{
+    int32_t value;
+
+    switch (format)
+    {
+        case SRTM_AudioPcmS16:
+            value = __SSAT((int32_t)(acc >> SRTM_AUDIO_PCM_GAIN_SHIFT), 16);
+            break;
+        case SRTM_AudioPcmS24:
+            value = __SSAT((int32_t)(acc >> (SRTM_AUDIO_PCM_GAIN_SHIFT - 8U)), 24);
+            break;
+        default:
+            value = SRTM_AudioPcm_Saturate(acc * (1 << (16U - SRTM_AUDIO_PCM_GAIN_SHIFT)), 32U);
+            break;
+    }
+
+    return value;
+}
+
+uint32_t SRTM_AudioPcm_GetSampleSize(srtm_audio_pcm_format_t format)
+{
+    return format == SRTM_AudioPcmS16 ? 2U : 4U;
+}
+
+void SRTM_AudioPcm_Convert(void *dst,
+                           srtm_audio_pcm_format_t dstFormat,
+                           const void *src,
+                           srtm_audio_pcm_format_t srcFormat,
+                           uint32_t samples)
+{
+    uint32_t i = 0;
+
+    assert(((uint32_t)(uintptr_t)dst & 3U) == 0U && ((uint32_t)(uintptr_t)src & 3U) == 0U);
+
+    if (dstFormat == srcFormat)
+    {
+        if (dst != src)
+        {
+            memcpy(dst, src, samples * SRTM_AudioPcm_GetSampleSize(srcFormat));
+        }
+        return;
+    }
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+    if (srcFormat == SRTM_AudioPcmS16)
+    {
+        const uint32_t *in = (const uint32_t *)src;
+        int32_t *out = (int32_t *)dst;
+        uint32_t shift = dstFormat == SRTM_AudioPcmS24 ? 8U : 0U;
+
+        /* One load for two samples, each moved to the MSBs */
+        for (; i + 1U < samples; i += 2U)
+        {
+            uint32_t pair = *in++;
+
+            *out++ = (int32_t)(pair << 16) >> shift;
+            *out++ = (int32_t)(pair & 0xFFFF0000U) >> shift;
+        }
+    }
+    else if (dstFormat == SRTM_AudioPcmS16)
+    {
+        const int32_t *in = (const int32_t *)src;
+        uint32_t *out = (uint32_t *)dst;
+
+        /* Two samples packed in one store */
+        if (srcFormat == SRTM_AudioPcmS32)
+        {
+            for (; i + 1U < samples; i += 2U, in += 2)
+            {
+                *out++ = __PKHTB(in[1], in[0], 16);
+            }
+        }
+        else
+        {
+            for (; i + 1U < samples; i += 2U, in += 2)
+            {
+                *out++ = __PKHBT(in[0] >> 8, in[1] >> 8, 16);
+            }
+        }
+    }
+#endif
+
+    /* S24 <-> S32, and the last sample */
+    for (; i < samples; i++)
+    {
+        SRTM_AudioPcm_Write(dst, dstFormat, i,
+                            SRTM_AudioPcm_FromS32(SRTM_AudioPcm_ToS32(SRTM_AudioPcm_Read(src, srcFormat, i), srcFormat),
+                                                  dstFormat));
+    }
+}
+
+void SRTM_AudioPcm_Interleave(
+    void *dst, const void *const *src, uint32_t channels, uint32_t frames, srtm_audio_pcm_format_t format)
+{
+    uint32_t i = 0;
+    uint32_t ch;
+
+    assert(dst && src && channels);
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+    if (format == SRTM_AudioPcmS16 && channels == 2U)
+    {
+        const uint32_t *left = (const uint32_t *)src[0];
+        const uint32_t *right = (const uint32_t *)src[1];
+        uint32_t *out = (uint32_t *)dst;
+
+        /* Two frames from one load of each channel */
+        for (; i + 1U < frames; i += 2U)
+        {
+            uint32_t l = *left++;
+            uint32_t r = *right++;
+
+            *out++ = __PKHBT(l, r, 16);
+            *out++ = __PKHTB(r, l, 16);
+        }
+    }
+#endif
+
+    for (; i < frames; i++)
+    {
+        for (ch = 0; ch < channels; ch++)
+        {
+            SRTM_AudioPcm_Write(dst, format, i * channels + ch, SRTM_AudioPcm_Read(src[ch], format, i));
+        }
+    }
+}
+
+void SRTM_AudioPcm_Deinterleave(
+    void *const *dst, const void *src, uint32_t channels, uint32_t frames, srtm_audio_pcm_format_t format)
+{
+    uint32_t i = 0;
+    uint32_t ch;
+
+    assert(dst && src && channels);
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+    if (format == SRTM_AudioPcmS16 && channels == 2U)
+    {
+        const uint32_t *in = (const uint32_t *)src;
+        uint32_t *left = (uint32_t *)dst[0];
+        uint32_t *right = (uint32_t *)dst[1];
+
+        /* Two frames to one store of each channel */
+        for (; i + 1U < frames; i += 2U, in += 2)
+        {
+            *left++ = __PKHBT(in[0], in[1], 16);
+            *right++ = __PKHTB(in[1], in[0], 16);
+        }
+    }
+#endif
+
+    for (; i < frames; i++)
+    {
+        for (ch = 0; ch < channels; ch++)
+        {
+            SRTM_AudioPcm_Write(dst[ch], format, i, SRTM_AudioPcm_Read(src, format, i * channels + ch));
+        }
+    }
+}
+
+void SRTM_AudioPcm_Gain(void *dst, const void *src, srtm_audio_pcm_format_t format, uint32_t samples, int16_t gain)
+{
+    uint32_t i = 0;
+    int64_t value;
+
+    assert(gain >= 0);
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+    if (format == SRTM_AudioPcmS16)
+    {
+        const uint32_t *in = (const uint32_t *)src;
+        uint32_t *out = (uint32_t *)dst;
+        uint32_t g = (uint16_t)gain;
+
+        /* The gain in the bottom half multiplies the bottom sample, and the top one when exchanged */
+        for (; i + 1U < samples; i += 2U)
+        {
+            uint32_t pair = *in++;
+            int32_t lo = __SSAT((int32_t)__SMUAD(pair, g) >> SRTM_AUDIO_PCM_GAIN_SHIFT, 16);
+            int32_t hi = __SSAT((int32_t)__SMUADX(pair, g) >> SRTM_AUDIO_PCM_GAIN_SHIFT, 16);
+
+            *out++ = __PKHBT(lo, hi, 16);
+        }
+    }
+#endif
+
+    for (; i < samples; i++)
+    {
+        value = ((int64_t)SRTM_AudioPcm_Read(src, format, i) * gain) >> SRTM_AUDIO_PCM_GAIN_SHIFT;
+        SRTM_AudioPcm_Write(dst, format, i,
+                            SRTM_AudioPcm_Saturate(value, format == SRTM_AudioPcmS16 ?
+                                                              16U :
+                                                              (format == SRTM_AudioPcmS24 ? 24U : 32U)));
+    }
+}
+
+void SRTM_AudioPcm_Mix(void *dst,
+                       srtm_audio_pcm_format_t dstFormat,
+                       const int16_t *const *src,
+                       const int16_t *gain,
+                       uint32_t streams,
+                       uint32_t samples)
+{
+    uint32_t i = 0;
+    uint32_t s;
+    int64_t acc;
+
+    assert(dst && src && gain && streams && streams <= SRTM_AUDIO_PCM_MAX_MIX_STREAMS);
+
+#if SRTM_AUDIO_PCM_USE_SIMD
+    if (streams == 2U && dstFormat == SRTM_AudioPcmS16 && gain[0] == SRTM_AUDIO_PCM_GAIN_UNITY &&
+        gain[1] == SRTM_AUDIO_PCM_GAIN_UNITY)
+    {
+        const uint32_t *a = (const uint32_t *)src[0];
+        const uint32_t *b = (const uint32_t *)src[1];
+        uint32_t *out = (uint32_t *)dst;
+
+        /* Saturating add of two samples of each stream at once */
+        for (; i + 1U < samples; i += 2U)
+        {
+            *out++ = __QADD16(*a++, *b++);
+        }
+    }
+    else
+    {
+        uint32_t pairGain[(SRTM_AUDIO_PCM_MAX_MIX_STREAMS + 1U) / 2U];
+        uint64_t acc0, acc1;
+        uint32_t a, b;
+
+        /* Gains of the streams s and s + 1 packed, for the dual multiply-accumulate */
+        for (s = 0; s < streams; s += 2U)
+        {
+            pairGain[s / 2U] = __PKHBT(gain[s], s + 1U < streams ? gain[s + 1U] : 0, 16);
+        }
+
+        for (; i + 1U < samples; i += 2U)
+        {
+            acc0 = 0;
+            acc1 = 0;
+            for (s = 0; s < streams; s += 2U)
+            {
+                a = *(const uint32_t *)&src[s][i];
+                b = s + 1U < streams ? *(const uint32_t *)&src[s + 1U][i] : 0U;
+                /* Sample i of both streams, then sample i + 1 */
+                acc0 = __SMLALD(__PKHBT(a, b, 16), pairGain[s / 2U], acc0);
+                acc1 = __SMLALD(__PKHTB(b, a, 16), pairGain[s / 2U], acc1);
+            }
+            SRTM_AudioPcm_Write(dst, dstFormat, i, SRTM_AudioPcm_FromMix((int64_t)acc0, dstFormat));
+            SRTM_AudioPcm_Write(dst, dstFormat, i + 1U, SRTM_AudioPcm_FromMix((int64_t)acc1, dstFormat));
+        }
+    }
+#endif
+
+    for (; i < samples; i++)
+    {
+        acc = 0;
+        for (s = 0; s < streams; s++)
+        {
+            acc += (int32_t)src[s][i] * gain[s];
+        }
+        SRTM_AudioPcm_Write(dst, dstFormat, i, SRTM_AudioPcm_FromMix(acc, dstFormat));
+    }
+}
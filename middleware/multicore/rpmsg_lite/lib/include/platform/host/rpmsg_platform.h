@@ -0,0 +1,97 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MACHINE_SYSTEM_H
+#define _MACHINE_SYSTEM_H
+
+/*
+ * Host (POSIX) stand-in platform, used with the FreeRTOS POSIX port.
+ * Both sides of a link run in the same process: link 2n and link 2n+1 are
+ * connected back to back through a shared memory buffer of the application,
+ * a notification of a vq on one link raises the same vq of the peer link.
+ * The interrupts are delivered by a mailbox task at the highest priority.
+ */
+
+/* Number of links, limited by the vq notification mask */
+#define RL_PLATFORM_LINK_COUNT (16)
+
+/* Peer of a link, both links share the same shared memory */
+#define RL_PLATFORM_PEER_LINK_ID(link_id) ((link_id) ^ 1)
+
+/* Priority of the mailbox task delivering the interrupts */
+#ifndef RL_PLATFORM_MAILBOX_PRIORITY
+#define RL_PLATFORM_MAILBOX_PRIORITY (configMAX_PRIORITIES - 1)
+#endif
+
+#ifndef VRING_ALIGN
+#define VRING_ALIGN (0x1000)
+#endif
+
+/* contains pool of descriptors and two circular buffers */
+#ifndef VRING_SIZE
+#define VRING_SIZE (0x8000)
+#endif
+
+/* size of shared memory + 2*VRING size */
+#define RL_VRING_OVERHEAD (2 * VRING_SIZE)
+
+#define RL_GET_VQ_ID(core_id, queue_id) (((queue_id)&0x1) | (((core_id) << 1) & 0xFFFFFFFE))
+#define RL_GET_LINK_ID(id) (((id)&0xFFFFFFFE) >> 1)
+#define RL_GET_Q_ID(id) ((id)&0x1)
+
+#define RL_PLATFORM_HOST_MASTER_LINK_ID (0)
+#define RL_PLATFORM_HOST_REMOTE_LINK_ID (1)
+#define RL_PLATFORM_HIGHEST_LINK_ID (RL_PLATFORM_LINK_COUNT - 1)
+
+/* platform interrupt related functions */
+int platform_init_interrupt(int vector_id, void *isr_data);
+int platform_deinit_interrupt(int vector_id);
+int platform_interrupt_enable(unsigned int vector_id);
+int platform_interrupt_disable(unsigned int vector_id);
+int platform_in_isr(void);
+void platform_notify(int vector_id);
+
+/* platform global interrupt masking */
+unsigned int platform_global_isr_disable(void);
+void platform_global_isr_restore(unsigned int state);
+
+/* platform low-level time-delay (busy loop) */
+void platform_time_delay(int num_msec);
+
+/* platform time stamp (nanoseconds) */
+unsigned long long platform_get_timestamp(void);
+
+/* platform memory functions */
+void platform_map_mem_region(unsigned int va, unsigned int pa, unsigned int size, unsigned int flags);
+void platform_cache_all_flush_invalidate(void);
+void platform_cache_disable(void);
+void platform_cache_range_flush(void *addr, unsigned int size);
+void platform_cache_range_invalidate(void *addr, unsigned int size);
+unsigned long platform_vatopa(void *addr);
+void *platform_patova(unsigned long addr);
+
+/* Cache maintenance record, the host memory is coherent so the range calls are only recorded */
+#define RL_PLATFORM_CACHE_FLUSH (0)
+#define RL_PLATFORM_CACHE_INVALIDATE (1)
+#define RL_PLATFORM_CACHE_LOG_SIZE (16)
+
+struct platform_cache_op
+{
+    void *addr;
+    unsigned int size;
+    int op; /* RL_PLATFORM_CACHE_FLUSH or RL_PLATFORM_CACHE_INVALIDATE */
+};
+
+unsigned long platform_cache_op_count(int op);
+int platform_cache_get_op(unsigned long seq, struct platform_cache_op *cache_op);
+
+/* platform init/deinit */
+int platform_init(void);
+int platform_deinit(void);
+
+#endif /* _MACHINE_SYSTEM_H */
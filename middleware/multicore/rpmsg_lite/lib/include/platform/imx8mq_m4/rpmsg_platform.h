@@ -13,6 +13,20 @@
 /* RPMSG MU channel index */
 #define RPMSG_MU_CHANNEL (1)
 
+/* Number of MU data channels */
+#define RPMSG_MU_CHANNEL_COUNT (4)
+
+/*
+ * MU channel used to notify the given link. Links sharing a channel are
+ * demultiplexed by the vq id carried in the message, links on separate
+ * channels do not wait for each other's MU transmit register.
+ * Define to spread the links over several channels, the other side
+ * has to use the same mapping.
+ */
+#ifndef RL_PLATFORM_LINK_MU_CHANNEL
+#define RL_PLATFORM_LINK_MU_CHANNEL(link_id) (RPMSG_MU_CHANNEL)
+#endif
+
 /*
  * Linux requires the ALIGN to 0x1000(4KB) instead of 0x80
  */
@@ -43,13 +57,22 @@ int platform_interrupt_disable(unsigned int vector_id);
 int platform_in_isr(void);
 void platform_notify(int vector_id);
 
+/* platform global interrupt masking */
+unsigned int platform_global_isr_disable(void);
+void platform_global_isr_restore(unsigned int state);
+
 /* platform low-level time-delay (busy loop) */
 void platform_time_delay(int num_msec);
 
+/* platform time stamp (CPU cycles) */
+unsigned long long platform_get_timestamp(void);
+
 /* platform memory functions */
 void platform_map_mem_region(unsigned int va, unsigned int pa, unsigned int size, unsigned int flags);
 void platform_cache_all_flush_invalidate(void);
 void platform_cache_disable(void);
+void platform_cache_range_flush(void *addr, unsigned int size);
+void platform_cache_range_invalidate(void *addr, unsigned int size);
 unsigned long platform_vatopa(void *addr);
 void *platform_patova(unsigned long addr);
 
@@ -60,7 +60,12 @@
 /* GNUC */
 #elif defined(__GNUC__)
 
+#if defined(__arm__)
 #define MEM_BARRIER() asm volatile("dsb" : : : "memory")
+#else
+/* host builds */
+#define MEM_BARRIER() __sync_synchronize()
+#endif
 
 #ifndef RL_PACKED_BEGIN
 #define RL_PACKED_BEGIN
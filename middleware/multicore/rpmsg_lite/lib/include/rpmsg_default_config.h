@@ -73,6 +73,87 @@
 #define RL_BUFFER_COUNT (2)
 #endif
 
+//! @def RL_USE_QUEUE_RING
+//!
+//! When enabled, an RPMsg queue (rpmsg_queue) is a lock-free single
+//! producer/single consumer ring of received buffers, the receiving task
+//! is woken by a direct task notification, it must not use its notification
+//! value for anything else. Only one task at a time may receive from a
+//! queue. Requires an RTOS environment layer.
+//! The default value is 0 (RPMsg queue is an environment layer queue).
+#ifndef RL_USE_QUEUE_RING
+#define RL_USE_QUEUE_RING (0)
+#endif
+
+//! @def RL_USE_CACHED_SHMEM
+//!
+//! When enabled, the vrings and rpmsg buffers may be mapped cacheable
+//! (the application configures the MPU accordingly) and rpmsg-lite cleans
+//! and invalidates exactly the descriptor, avail/used ring and buffer
+//! ranges it writes and reads, using the platform range cache hooks.
+//! The default value is 0 (shared memory must be non-cacheable).
+#ifndef RL_USE_CACHED_SHMEM
+#define RL_USE_CACHED_SHMEM (0)
+#endif
+
+//! @def RL_USE_BUFFER_CLASSES
+//!
+//! When enabled, the master side carves its tx buffers into several size
+//! classes (RL_BUFFER_CLASS_SIZES/RL_BUFFER_CLASS_COUNTS) instead of
+//! RL_BUFFER_COUNT buffers of RL_BUFFER_PAYLOAD_SIZE + 16 bytes, and senders
+//! get the smallest free buffer the message fits in. The rx buffers and the
+//! remote side are not affected, so a remote using fixed size buffers (like
+//! Linux virtio_rpmsg) still receives any message the master sends, as long
+//! as it fits in its own buffers. Has no effect on the remote side.
+//! The default value is 0 (disabled).
+#ifndef RL_USE_BUFFER_CLASSES
+#define RL_USE_BUFFER_CLASSES (0)
+#endif
+
+//! @def RL_BUFFER_CLASSES
+//!
+//! Number of tx buffer size classes, see RL_USE_BUFFER_CLASSES.
+#ifndef RL_BUFFER_CLASSES
+#define RL_BUFFER_CLASSES (3)
+#endif
+
+//! @def RL_BUFFER_CLASS_SIZES
+//!
+//! Buffer size of each class including the 16 bytes rpmsg header, in
+//! ascending order, multiples of 4 (of the cache line size with
+//! RL_USE_CACHED_SHMEM). A class of at least
+//! RL_BUFFER_PAYLOAD_SIZE + 16 bytes must have buffers, it is used
+//! by rpmsg_lite_alloc_tx_buffer().
+#ifndef RL_BUFFER_CLASS_SIZES
+#define RL_BUFFER_CLASS_SIZES \
+    {                         \
+        64, 512, 4096         \
+    }
+#endif
+
+//! @def RL_BUFFER_CLASS_COUNTS
+//!
+//! Number of buffers of each class, the sum must not exceed RL_BUFFER_COUNT.
+//! A class may have no buffers.
+#ifndef RL_BUFFER_CLASS_COUNTS
+#define RL_BUFFER_CLASS_COUNTS                                                                \
+    {                                                                                         \
+        RL_BUFFER_COUNT / 2, RL_BUFFER_COUNT / 2 - RL_BUFFER_COUNT / 16, RL_BUFFER_COUNT / 16 \
+    }
+#endif
+
+//! @def RL_EPT_LUT_SIZE
+//!
+//! Number of buckets of the endpoint lookup table, it must be power
+//! of two (1, 2, 4, ...). Endpoints are hashed into the buckets by the
+//! low bits of their address, so the received message dispatch cost is
+//! constant as long as the number of endpoints does not exceed this value.
+//! The value 1 gives the plain endpoint list.
+//! The default value is 16.
+#ifndef RL_EPT_LUT_SIZE
+#define RL_EPT_LUT_SIZE (16)
+#endif
+
 //! @def RL_API_HAS_ZEROCOPY
 //!
 //! Zero-copy API functions enabled/disabled.
@@ -81,6 +162,15 @@
 #define RL_API_HAS_ZEROCOPY (1)
 #endif
 
+//! @def RL_FRAG_MAX_MSGS
+//!
+//! Maximum number of partially received messages the fragmentation
+//! layer (rpmsg_frag) reassembles at the same time on one endpoint.
+//! The default value is 4.
+#ifndef RL_FRAG_MAX_MSGS
+#define RL_FRAG_MAX_MSGS (4)
+#endif
+
 //! @def RL_USE_STATIC_API
 //!
 //! Static API functions (no dynamic allocation) enabled/disabled.
@@ -98,6 +188,116 @@
 #define RL_CLEAR_USED_BUFFERS (0)
 #endif
 
+//! @def RL_USE_TX_WAIT_EVENT
+//!
+//! When enabled, senders waiting for a free tx buffer (rpmsg_lite_send(),
+//! rpmsg_lite_alloc_tx_buffer() with non-zero timeout) sleep on a per-instance
+//! sync lock signalled by the tx virtqueue callback, instead of polling
+//! the vring every RL_MS_PER_INTERVAL milliseconds.
+//! The other side must notify when it returns used tx buffers: Linux does,
+//! rpmsg-lite does with RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION.
+//! The default value is 0 (polling).
+#ifndef RL_USE_TX_WAIT_EVENT
+#define RL_USE_TX_WAIT_EVENT (0)
+#endif
+
+//! @def RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION
+//!
+//! When enabled, the other side is notified each time received buffers
+//! are returned to it (after the endpoint callbacks of a notification,
+//! and in rpmsg_lite_release_rx_buffer()), so that its senders waiting
+//! with RL_USE_TX_WAIT_EVENT are woken up.
+//! The default value is 0 (disabled).
+#ifndef RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION
+#define RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION (0)
+#endif
+
+//! @def RL_USE_RX_WORKER
+//!
+//! When enabled, the rvq notification (MU interrupt) only masks further
+//! rvq notifications and wakes up a per-instance rx worker task. Endpoint
+//! rx callbacks are then called from that task instead of interrupt context.
+//! Requires an RTOS environment layer.
+//! The default value is 0 (rx callbacks run in interrupt context).
+#ifndef RL_USE_RX_WORKER
+#define RL_USE_RX_WORKER (0)
+#endif
+
+//! @def RL_RX_WORKER_PRIORITY
+//!
+//! Priority of the rx worker task, in units of the environment (RTOS) layer.
+//! The default value is 3.
+#ifndef RL_RX_WORKER_PRIORITY
+#define RL_RX_WORKER_PRIORITY (3)
+#endif
+
+//! @def RL_RX_WORKER_LINK_PRIORITY
+//!
+//! Priority of the rx worker task of the given link, so that independent
+//! instances (e.g. a control link and a bulk data link) are served
+//! at different priorities.
+//! The default value is RL_RX_WORKER_PRIORITY for all links.
+#ifndef RL_RX_WORKER_LINK_PRIORITY
+#define RL_RX_WORKER_LINK_PRIORITY(link_id) (RL_RX_WORKER_PRIORITY)
+#endif
+
+//! @def RL_RX_WORKER_STACK_SIZE
+//!
+//! Stack size of the rx worker task, in units of the environment (RTOS) layer.
+//! The default value is 256.
+#ifndef RL_RX_WORKER_STACK_SIZE
+#define RL_RX_WORKER_STACK_SIZE (256)
+#endif
+
+//! @def RL_RX_WORKER_BATCH_SIZE
+//!
+//! Maximum number of rx buffers the rx worker processes before yielding
+//! to other tasks of the same priority.
+//! The default value is 8.
+#ifndef RL_RX_WORKER_BATCH_SIZE
+#define RL_RX_WORKER_BATCH_SIZE (8)
+#endif
+
+//! @def RL_USE_STATS
+//!
+//! When enabled, every RPMsg-Lite instance keeps statistics (message and
+//! byte counters, kicks, tx buffer waits, rx batches, held buffers and
+//! latency histograms), see rpmsg_lite_get_stats().
+//! The default value is 0 (no statistics, no overhead).
+#ifndef RL_USE_STATS
+#define RL_USE_STATS (0)
+#endif
+
+//! @def RL_STATS_HIST_BINS
+//!
+//! Number of log2 buckets of the statistics latency histograms,
+//! bucket n counts latencies of [2^(n-1), 2^n) timestamp units,
+//! the last bucket also counts all longer latencies.
+//! The default value is 16.
+#ifndef RL_STATS_HIST_BINS
+#define RL_STATS_HIST_BINS (16)
+#endif
+
+//! @def RL_USE_STATS_EPT
+//!
+//! When enabled together with RL_USE_STATS, any message the other side
+//! sends to address RL_STATS_EPT_ADDR (with no local endpoint bound to it)
+//! is answered with a struct rpmsg_lite_stats snapshot of the instance.
+//! The rx worker answers right away; without RL_USE_RX_WORKER the request
+//! is answered from task context by rpmsg_lite_stats_ept_poll().
+//! The default value is 0 (disabled).
+#ifndef RL_USE_STATS_EPT
+#define RL_USE_STATS_EPT (0)
+#endif
+
+//! @def RL_STATS_EPT_ADDR
+//!
+//! Address of the statistics endpoint, see RL_USE_STATS_EPT.
+//! The default value is 54 (next to the name service endpoint).
+#ifndef RL_STATS_EPT_ADDR
+#define RL_STATS_EPT_ADDR (54)
+#endif
+
 //! @def RL_USE_MCMGR_IPC_ISR_HANDLER
 //!
 //! When enabled IPC interrupts are managed by the Multicore Manager (IPC 
@@ -72,6 +72,9 @@
 *       env_delete_queue
 *       env_put_queue
 *       env_get_queue
+*       env_get_current_task
+*       env_notify_task
+*       env_wait_task_notify
 *
 **************************************************************************/
 #ifndef _RPMSG_ENV_H_
@@ -305,6 +308,21 @@ void env_acquire_sync_lock(void *lock);
  */
 void env_release_sync_lock(void *lock);
 
+/*!
+ * env_acquire_sync_lock_timeout
+ *
+ * Tries to acquire the sync lock, waits at most the given time.
+ * On return, timeout_ms holds the time left from the original timeout,
+ * so the call can be repeated after a spurious wakeup.
+ *
+ * @param lock       - sync lock to acquire.
+ * @param timeout_ms - in: maximum wait in ms (RL_BLOCK waits forever),
+ *                     out: remaining wait in ms
+ *
+ * @returns - 1 when the lock was acquired, 0 on timeout
+ */
+int env_acquire_sync_lock_timeout(void *lock, unsigned long *timeout_ms);
+
 /*!
  * env_sleep_msec
  *
@@ -314,6 +332,32 @@ void env_release_sync_lock(void *lock);
  */
 void env_sleep_msec(int num_msec);
 
+/*!
+ * env_create_task
+ *
+ * Creates a task (thread) running the given function.
+ *
+ * @param task       - pointer to created task handle
+ * @param entry      - task entry function, must not return
+ * @param name       - task name
+ * @param stack_size - task stack size, in units of the OS
+ * @param priority   - task priority, in units of the OS
+ * @param arg        - argument passed to entry
+ *
+ * @return - status of function execution
+ */
+int env_create_task(
+    void **task, void (*entry)(void *arg), const char *name, unsigned int stack_size, unsigned int priority, void *arg);
+
+/*!
+ * env_delete_task
+ *
+ * Deletes the given task, or the calling task if task is NULL.
+ *
+ * @param task - task to delete
+ */
+void env_delete_task(void *task);
+
 /*!
  * env_register_isr
  *
@@ -395,7 +439,7 @@ void env_map_memory(unsigned int pa, unsigned int va, unsigned int size, unsigne
 /*!
  * env_get_timestamp
  *
- * Returns a 64 bit time stamp.
+ * Returns a 64 bit time stamp, in CPU cycles.
  *
  *
  */
@@ -410,6 +454,29 @@ unsigned long long env_get_timestamp(void);
 
 void env_disable_cache(void);
 
+/*!
+ * env_cache_flush_range
+ *
+ * Writes back cached data of the given memory range.
+ *
+ * @param addr - start address of the range
+ * @param size - size of the range, in bytes
+ */
+
+void env_cache_flush_range(void *addr, unsigned long size);
+
+/*!
+ * env_cache_invalidate_range
+ *
+ * Discards cached data of the given memory range, so that
+ * the next access reads the memory.
+ *
+ * @param addr - start address of the range
+ * @param size - size of the range, in bytes
+ */
+
+void env_cache_invalidate_range(void *addr, unsigned long size);
+
 typedef void LOCK;
 
 /*!
@@ -475,6 +542,40 @@ int env_get_queue(void *queue, void *msg, int timeout_ms);
 
 int env_get_current_queue_size(void *queue);
 
+/*!
+ * env_get_current_task
+ *
+ * Returns the handle of the calling task.
+ *
+ * @return - task handle
+ */
+
+void *env_get_current_task(void);
+
+/*!
+ * env_notify_task
+ *
+ * Sends a direct notification to a task waiting in env_wait_task_notify().
+ * Can be called from interrupt context.
+ *
+ * @param task - task to notify
+ */
+
+void env_notify_task(void *task);
+
+/*!
+ * env_wait_task_notify
+ *
+ * Waits at most timeout_ms for a notification sent to the calling task.
+ * Updates timeout_ms with the time left.
+ *
+ * @param timeout_ms - in: timeout in ms, out: remaining time in ms
+ *
+ * @return - 1 when notified, 0 on timeout
+ */
+
+int env_wait_task_notify(unsigned long *timeout_ms);
+
 /*!
  * env_isr
  *
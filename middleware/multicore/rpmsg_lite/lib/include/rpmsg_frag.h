@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2014, Mentor Graphics Corporation
+ * Copyright (c) 2015 Xilinx, Inc.
+ * Copyright (c) 2016 Freescale Semiconductor, Inc.
+ * Copyright 2016 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RPMSG_FRAG_H
+#define _RPMSG_FRAG_H
+
+#include "rpmsg_lite.h"
+
+//! @addtogroup rpmsg_frag
+//! @{
+
+/* RL_API_HAS_ZEROCOPY has to be enabled for RPMsg Fragmentation layer to work */
+#if defined(RL_API_HAS_ZEROCOPY) && (RL_API_HAS_ZEROCOPY == 1)
+
+/*! \typedef rpmsg_frag_rx_cb
+    \brief Reassembled message callback function type.
+    The data is valid only for the duration of the callback.
+*/
+typedef void (*rpmsg_frag_rx_cb)(void *data, unsigned long size, unsigned long src, void *priv);
+
+/*!
+ * Partially received message, being reassembled in the arena.
+ */
+struct rpmsg_frag_slot
+{
+    unsigned long src;      /*!< Sender address */
+    unsigned short msg_id;  /*!< Message identifier assigned by the sender */
+    unsigned short in_use;  /*!< Slot is in use */
+    unsigned long offset;   /*!< Offset of the message in the arena */
+    unsigned long size;     /*!< Total message size */
+    unsigned long received; /*!< Number of bytes received so far */
+    unsigned long stamp;    /*!< Fragment counter value of the last fragment received */
+};
+
+struct rpmsg_frag_context
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev;
+    struct rpmsg_lite_endpoint *ept;
+    rpmsg_frag_rx_cb cb;
+    void *cb_data;
+    char *arena;
+    unsigned long arena_size;
+    unsigned long frag_count;
+    volatile unsigned short next_msg_id;
+    struct rpmsg_frag_slot slots[RL_FRAG_MAX_MSGS];
+};
+
+typedef struct rpmsg_frag_context *rpmsg_frag_handle;
+
+struct rpmsg_frag_static_context_container
+{
+    struct rpmsg_lite_ept_static_context ept_ctxt;
+    struct rpmsg_frag_context frag_ctxt;
+};
+
+typedef struct rpmsg_frag_static_context_container rpmsg_frag_static_context;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/* Exported API functions */
+
+/*!
+ * @brief Creates an endpoint which sends and receives messages
+ * larger than RL_BUFFER_PAYLOAD_SIZE.
+ *
+ * Messages are split into fragments, each sent in one rpmsg buffer.
+ * Received fragments are copied into the arena and their rpmsg buffers
+ * released right away, so a large message never holds the ring; the arena
+ * bounds the memory used for reassembly; at most RL_FRAG_MAX_MSGS messages
+ * are reassembled at the same time. Messages which do not fit in the
+ * arena are dropped. A partially received message makes room for a new
+ * one once no fragment of it arrived for 2 * RL_BUFFER_COUNT fragments.
+ * Single-fragment messages are passed to the callback
+ * directly from the rpmsg buffer.
+ *
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ * @param addr              Desired address, RL_ADDR_ANY for automatic selection
+ * @param rx_cb             Reassembled message callback, called in the context of the rx callback
+ * @param rx_cb_data        Reassembled message callback data
+ * @param arena             Reassembly memory
+ * @param arena_size        Size of the reassembly memory, in bytes
+ *
+ * @return Fragmentation handle, RL_NULL on failure.
+ *
+ */
+#if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
+rpmsg_frag_handle rpmsg_frag_create(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                                    unsigned long addr,
+                                    rpmsg_frag_rx_cb rx_cb,
+                                    void *rx_cb_data,
+                                    void *arena,
+                                    unsigned long arena_size,
+                                    rpmsg_frag_static_context *frag_ctxt);
+#else
+rpmsg_frag_handle rpmsg_frag_create(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                                    unsigned long addr,
+                                    rpmsg_frag_rx_cb rx_cb,
+                                    void *rx_cb_data,
+                                    void *arena,
+                                    unsigned long arena_size);
+#endif /* RL_USE_STATIC_API */
+
+/*!
+ * @brief Destroys the fragmentation endpoint, partially received
+ * messages are dropped.
+ *
+ * @param handle            Fragmentation handle
+ *
+ * @return Status of function execution, RL_SUCCESS on success.
+ *
+ */
+int rpmsg_frag_destroy(rpmsg_frag_handle handle);
+
+/*!
+ * @brief Returns the address of the fragmentation endpoint.
+ *
+ * @param handle            Fragmentation handle
+ *
+ * @return Endpoint address.
+ *
+ */
+unsigned long rpmsg_frag_get_addr(rpmsg_frag_handle handle);
+
+/*!
+ * @brief Sends a message of any size to the fragmentation endpoint
+ * with address dst. The data is copied once, straight into the
+ * zero-copy tx buffers.
+ *
+ * @param handle            Fragmentation handle
+ * @param dst               Remote endpoint address
+ * @param data              Payload buffer
+ * @param size              Size of payload, in bytes
+ * @param timeout           Timeout in ms to wait for each tx buffer, 0 if nonblocking
+ *
+ * @return Status of function execution, RL_SUCCESS on success.
+ * On failure the message may have been sent partially and the
+ * receiver never delivers it; its fragments hold a reassembly slot
+ * and arena space at the receiver until 2 * RL_BUFFER_COUNT other
+ * fragments arrived. Sending again uses a new message identifier,
+ * so a retry is never merged with the orphaned fragments.
+ *
+ */
+int rpmsg_frag_send(
+    rpmsg_frag_handle handle, unsigned long dst, char *data, unsigned long size, unsigned long timeout);
+
+//! @}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RL_API_HAS_ZEROCOPY */
+
+#endif /* _RPMSG_FRAG_H */
@@ -103,8 +103,40 @@ struct rpmsg_lite_endpoint
     void *rx_cb_data;     /*!< ISR callback data */
     void *rfu;            /*!< reserved for future usage */
     /* 16 bytes aligned on 32bit architecture */
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    unsigned long rx_msgs;  /*!< number of messages passed to rx_cb */
+    unsigned long rx_bytes; /*!< number of payload bytes passed to rx_cb */
+#endif
 };
 
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+/*!
+ * RPMsg Lite instance statistics.
+ * All fields are 32bit words in the byte order of the local processor,
+ * this is also the layout of the RL_STATS_EPT_ADDR replies.
+ * Times are in env_get_timestamp() units.
+ */
+struct rpmsg_lite_stats
+{
+    uint32_t tx_msgs;                                /*!< messages sent */
+    uint32_t tx_bytes;                               /*!< payload bytes sent */
+    uint32_t rx_msgs;                                /*!< messages received */
+    uint32_t rx_bytes;                               /*!< payload bytes received */
+    uint32_t rx_no_ept;                              /*!< messages dropped, no endpoint bound to destination */
+    uint32_t kicks;                                  /*!< notifications sent to the other side */
+    uint32_t kicks_suppressed;                       /*!< notifications skipped, masked by the other side */
+    uint32_t tx_alloc_waits;                         /*!< sends that had to wait for a tx buffer */
+    uint32_t tx_alloc_timeouts;                      /*!< sends that timed out waiting for a tx buffer */
+    uint32_t tx_alloc_wait_max;                      /*!< longest wait for a tx buffer */
+    uint32_t rx_batches;                             /*!< rvq notifications that found messages */
+    uint32_t rx_batch_max;                           /*!< most messages found on the rvq by one notification */
+    uint32_t rx_held;                                /*!< rx buffers currently held by endpoints (RL_HOLD) */
+    uint32_t rx_held_max;                            /*!< most rx buffers held at once */
+    uint32_t tx_alloc_wait_hist[RL_STATS_HIST_BINS]; /*!< log2 histogram of tx buffer waits */
+    uint32_t rx_latency_hist[RL_STATS_HIST_BINS];    /*!< log2 histogram of rvq notification to rx_cb latency */
+};
+#endif /* RL_USE_STATS */
+
 /*!
  * RPMsg Lite Endpoint static context
  */
@@ -124,13 +156,42 @@ struct rpmsg_lite_instance
 {
     struct virtqueue *rvq;              /*!< receive virtqueue */
     struct virtqueue *tvq;              /*!< transmit virtqueue */
-    struct llist *rl_endpoints;         /*!< linked list of endpoints */
+    struct llist *rl_ept_lut[RL_EPT_LUT_SIZE]; /*!< endpoint lookup table, linked list of endpoints per bucket */
     LOCK *lock;                         /*!< local RPMsg Lite mutex lock */
     unsigned int link_state;            /*!< state of the link, up/down*/
     char *sh_mem_base;                  /*!< base address of the shared memory */
     unsigned int sh_mem_remaining;      /*!< remaining free bytes of shared memory */
     unsigned int sh_mem_total;          /*!< total size of shared memory */
     struct virtqueue_ops const *vq_ops; /*!< ops functions table pointer */
+    unsigned short tx_spare;            /*!< tx buffers released unsent, index + 1 of the first, 0 if none */
+
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    void *tx_wait_lock;                 /*!< sync lock signalled when the remote side returns tx buffers */
+    volatile unsigned int tx_waiters;   /*!< number of senders blocked on tx_wait_lock */
+#endif
+
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+    void *rx_event;        /*!< sync lock signalled from the rvq notification to wake up the rx worker */
+    void *rx_exit;         /*!< sync lock signalled by the rx worker when it stops */
+    void *rx_task;         /*!< rx worker task handle */
+    volatile int rx_stop;  /*!< set by rpmsg_lite_deinit() to stop the rx worker */
+#endif
+
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    unsigned long tx_payload_max;                        /*!< largest payload that can be sent */
+    unsigned short tx_free_head[RL_BUFFER_CLASSES];      /*!< first free tx buffer of each class */
+    unsigned short tx_free_next[RL_BUFFER_COUNT];        /*!< free tx buffer lists, indexed by buffer index */
+#endif
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    struct rpmsg_lite_stats stats;   /*!< instance statistics */
+    unsigned long long rx_notify_ts; /*!< timestamp of the last rvq notification */
+#endif
+
+#if defined(RL_USE_STATS_EPT) && (RL_USE_STATS_EPT == 1)
+    volatile int stats_req;          /*!< statistics request received in interrupt context, not answered yet */
+    unsigned long stats_req_src;     /*!< address the pending statistics request came from */
+#endif
 
 #if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
     struct vq_static_context vq_ctxt[2];
@@ -263,6 +324,34 @@ int rpmsg_lite_send(struct rpmsg_lite_instance *rpmsg_lite_dev,
                     unsigned long size,
                     unsigned long timeout);
 
+/*!
+ * @brief Sends count messages to the remote endpoint with address dst,
+ * notifying the other side only once for the whole batch.
+ * Message i consists of size[i] bytes of data[i].
+ * ept->addr is used as source address in the rpmsg header
+ * of the messages being sent.
+ * Messages are sent in order. The messages that fit in the free tx
+ * buffers are copied and queued under a single lock of the instance.
+ * If no tx buffer becomes available within the timeout, the remaining
+ * messages are not sent.
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ * @param ept               Sender endpoint
+ * @param dst               Remote endpoint address
+ * @param data              Array of count payload buffers
+ * @param size              Array of count payload sizes, in bytes
+ * @param count             Number of messages
+ * @param timeout           Timeout in ms to wait for each tx buffer, 0 if nonblocking
+ * @return Number of messages sent on success (the first ones of the batch),
+ * error code when no message could be sent.
+ */
+int rpmsg_lite_send_batch(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                          struct rpmsg_lite_endpoint *ept,
+                          unsigned long dst,
+                          char **data,
+                          unsigned long *size,
+                          unsigned long count,
+                          unsigned long timeout);
+
 /*!
  * @brief Function to get the link state
  *
@@ -273,6 +362,45 @@ int rpmsg_lite_send(struct rpmsg_lite_instance *rpmsg_lite_dev,
  */
 int rpmsg_lite_is_link_up(struct rpmsg_lite_instance *rpmsg_lite_dev);
 
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+/*!
+ * @brief Copies the instance statistics.
+ * The copy is made under the instance lock with interrupts masked,
+ * so no counter is updated in the middle of it.
+ *
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ * @param stats             Destination of the statistics
+ *
+ * @return Status of function execution, RL_SUCCESS on success.
+ */
+int rpmsg_lite_get_stats(struct rpmsg_lite_instance *rpmsg_lite_dev, struct rpmsg_lite_stats *stats);
+
+/*!
+ * @brief Clears the instance statistics.
+ * The number of currently held rx buffers is kept.
+ *
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ *
+ * @return Status of function execution, RL_SUCCESS on success.
+ */
+int rpmsg_lite_reset_stats(struct rpmsg_lite_instance *rpmsg_lite_dev);
+
+#if defined(RL_USE_STATS_EPT) && (RL_USE_STATS_EPT == 1)
+/*!
+ * @brief Answers a pending request of the statistics endpoint.
+ * Without RL_USE_RX_WORKER the requests are received in interrupt
+ * context, where no reply can be sent; they are answered by this
+ * function, to be called from a task from time to time.
+ * With the rx worker the requests are answered by the worker.
+ *
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ *
+ * @return 1 if a request was answered, 0 if none was pending, or an error code.
+ */
+int rpmsg_lite_stats_ept_poll(struct rpmsg_lite_instance *rpmsg_lite_dev);
+#endif /* RL_USE_STATS_EPT */
+#endif /* RL_USE_STATS */
+
 #if defined(RL_API_HAS_ZEROCOPY) && (RL_API_HAS_ZEROCOPY == 1)
 
 /*!
@@ -295,6 +423,10 @@ int rpmsg_lite_release_rx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, voi
  * It is the application responsibility to correctly fill the allocated tx buffer by data and passing correct
  * parameters to the rpmsg_lite_send_nocopy() function to perform data no-copy-send mechanism.
  *
+ * With RL_USE_BUFFER_CLASSES the buffer always comes from the smallest class of at least
+ * RL_BUFFER_PAYLOAD_SIZE bytes of payload that has a free buffer, whatever the message size,
+ * so it may be larger than RL_BUFFER_PAYLOAD_SIZE; size tells the payload available.
+ *
  * @param     rpmsg_lite_dev    RPMsg-Lite instance
  * @param[in] size              Pointer to store maximum payload size available
  * @param[in] timeout           Integer, wait upto timeout ms or not for buffer to become available
@@ -315,12 +447,14 @@ void *rpmsg_lite_alloc_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev,
  * The application has to take the responsibility for:
  *  1. tx buffer allocation (rpmsg_lite_alloc_tx_buffer())
  *  2. filling the data to be sent into the pre-allocated tx buffer
- *  3. not exceeding the buffer size when filling the data
+ *  3. not exceeding the buffer size when filling the data, the payload size returned
+ *     by rpmsg_lite_alloc_tx_buffer() for this buffer
  *  4. data cache coherency
  *
  * After the rpmsg_lite_send_nocopy() function is issued the tx buffer is no more owned
  * by the sending task and must not be touched anymore unless the rpmsg_lite_send_nocopy()
- * function fails and returns an error.
+ * function fails and returns an error. A buffer that is not sent after all is returned
+ * with rpmsg_lite_release_tx_buffer().
  *
  * @param rpmsg_lite_dev    RPMsg-Lite instance
  * @param[in] ept           Sender endpoint pointer
@@ -337,6 +471,21 @@ int rpmsg_lite_send_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
                            unsigned long dst,
                            void *data,
                            unsigned long size);
+
+/*!
+ * @brief Releases a tx buffer allocated by rpmsg_lite_alloc_tx_buffer() without sending it.
+ *
+ * Use it when the message is not going to be sent, e.g. after rpmsg_lite_send_nocopy()
+ * failed, so that the buffer can be allocated again. The buffer must not be touched afterwards.
+ *
+ * @param rpmsg_lite_dev    RPMsg-Lite instance
+ * @param txbuf             Tx buffer returned by rpmsg_lite_alloc_tx_buffer()
+ *
+ * @return Status of function execution, RL_SUCCESS on success.
+ *
+ * @see rpmsg_lite_alloc_tx_buffer
+ */
+int rpmsg_lite_release_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, void *txbuf);
 #endif /* RL_API_HAS_ZEROCOPY */
 
 //! @}
@@ -43,6 +43,16 @@
 */
 typedef void *rpmsg_queue_handle;
 
+/*!
+ * Message received by rpmsg_queue_recv_many()
+ */
+typedef struct
+{
+    unsigned long src; /*!< address of the endpoint the message is received from */
+    void *data;        /*!< RPMsg buffer holding the message, to be freed by rpmsg_queue_nocopy_free() */
+    int len;           /*!< number of valid bytes in the buffer */
+} rpmsg_queue_msg_t;
+
 /* RL_API_HAS_ZEROCOPY has to be enabled for RPMsg Queue to work */
 #if defined(RL_API_HAS_ZEROCOPY) && (RL_API_HAS_ZEROCOPY == 1)
 
@@ -74,6 +84,9 @@ int rpmsg_queue_rx_cb(void *payload, int payload_len, unsigned long src, void *p
 * Create a RPMsg queue which can be used
 * for blocking reception.
 *
+* With RL_USE_QUEUE_RING the queue is a single consumer ring,
+* only one task at a time may receive from it.
+*
 * @param rpmsg_lite_dev    RPMsg Lite instance
 *
 * @return RPMsg queue handle or RL_NULL
@@ -158,6 +171,33 @@ int rpmsg_queue_recv_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
                             int *len,
                             unsigned long timeout);
 
+/*!
+ * @brief
+ * blocking receive function - waits for at least one message and returns all messages
+ * received so far, up to max_count. The data is NOT copied into the user-app. buffer.
+ *
+ * This is the batched version of rpmsg_queue_recv_nocopy(), each returned buffer
+ * has to be freed by rpmsg_queue_nocopy_free().
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param[in] q             RPMsg queue handle to listen on
+ * @param[out] msgs         Array of max_count messages to fill
+ * @param[in] max_count     Maximum number of messages to return
+ * @param[in] timeout       Timeout, in milliseconds, to wait for the first message. A value of 0 means don't wait
+ * (non-blocking call).
+ *                          A value of 0xffffffff means wait forever (blocking call).
+ *
+ * @return Number of messages returned, or error code (RL_ERR_NO_BUFF on timeout).
+ *
+ * @see rpmsg_queue_nocopy_free
+ * @see rpmsg_queue_recv_nocopy
+ */
+int rpmsg_queue_recv_many(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                          rpmsg_queue_handle q,
+                          rpmsg_queue_msg_t *msgs,
+                          int max_count,
+                          unsigned long timeout);
+
 /*!
  * @brief This function frees a buffer previously returned by rpmsg_queue_recv_nocopy().
  *
@@ -227,7 +227,11 @@ void virtqueue_disable_cb(struct virtqueue *vq);
 
 int virtqueue_enable_cb(struct virtqueue *vq);
 
-void virtqueue_kick(struct virtqueue *vq);
+void virtqueue_disable_kick(struct virtqueue *vq);
+
+int virtqueue_enable_kick(struct virtqueue *vq);
+
+int virtqueue_kick(struct virtqueue *vq);
 
 void virtqueue_free(struct virtqueue *vq);
 
@@ -241,6 +245,8 @@ uint32_t virtqueue_get_desc_size(struct virtqueue *vq);
 
 uint32_t virtqueue_get_buffer_length(struct virtqueue *vq, uint16_t idx);
 
+void *virtqueue_get_buffer_addr(struct virtqueue *vq, uint16_t idx);
+
 void vq_ring_init(struct virtqueue *vq);
 
 #endif /* VIRTQUEUE_H_ */
@@ -297,6 +297,113 @@ void env_unlock_mutex(void *lock)
      * since the API is not shared with ISR context. */
 }
 
+/*!
+ * env_try_take_sync_lock
+ *
+ * Decrements the counter if it is positive. The ISR may release the lock
+ * at any time, so the read-modify-write is done with interrupts masked.
+ */
+static int env_try_take_sync_lock(volatile int *count)
+{
+    unsigned int state;
+    int taken = 0;
+
+    state = platform_global_isr_disable();
+    if (*count > 0)
+    {
+        (*count)--;
+        taken = 1;
+    }
+    platform_global_isr_restore(state);
+
+    return taken;
+}
+
+/*!
+ * env_create_sync_lock
+ *
+ * Creates a synchronization lock primitive. It is used
+ * when signal has to be sent from the interrupt context to main
+ * thread context. In BM environment it is a plain counter,
+ * incremented by the ISR and polled by the main loop.
+ */
+int env_create_sync_lock(void **lock, int state)
+{
+    volatile int *count = env_allocate_memory(sizeof(int));
+
+    if (!count)
+    {
+        return -1;
+    }
+    *count = state;
+    *lock = (void *)count;
+    return 0;
+}
+
+/*!
+ * env_delete_sync_lock
+ *
+ * Deletes the given lock
+ *
+ */
+void env_delete_sync_lock(void *lock)
+{
+    env_free_memory(lock);
+}
+
+/*!
+ * env_acquire_sync_lock
+ *
+ * Tries to acquire the lock, if lock is not available then call to
+ * this function waits for lock to become available.
+ */
+void env_acquire_sync_lock(void *lock)
+{
+    while (!env_try_take_sync_lock((volatile int *)lock))
+    {
+    }
+}
+
+/*!
+ * env_release_sync_lock
+ *
+ * Releases the given lock.
+ */
+void env_release_sync_lock(void *lock)
+{
+    volatile int *count = (volatile int *)lock;
+    unsigned int state;
+
+    state = platform_global_isr_disable();
+    (*count)++;
+    platform_global_isr_restore(state);
+}
+
+/*!
+ * env_acquire_sync_lock_timeout
+ *
+ * Tries to acquire the lock, waits at most timeout_ms for it
+ * to become available. Updates timeout_ms with the time left.
+ */
+int env_acquire_sync_lock_timeout(void *lock, unsigned long *timeout_ms)
+{
+    volatile int *count = (volatile int *)lock;
+
+    while (!env_try_take_sync_lock(count))
+    {
+        if (!*timeout_ms)
+        {
+            return 0;
+        }
+        platform_time_delay(1);
+        if (*timeout_ms != 0xFFFFFFFF)
+        {
+            (*timeout_ms)--;
+        }
+    }
+    return 1;
+}
+
 /*!
  * env_sleep_msec
  *
@@ -307,6 +414,28 @@ void env_sleep_msec(int num_msec)
     platform_time_delay(num_msec);
 }
 
+/*!
+ * env_create_task
+ *
+ * Tasks are not supported in BM environment.
+ *
+ */
+int env_create_task(
+    void **task, void (*entry)(void *arg), const char *name, unsigned int stack_size, unsigned int priority, void *arg)
+{
+    return -1;
+}
+
+/*!
+ * env_delete_task
+ *
+ * Tasks are not supported in BM environment.
+ *
+ */
+void env_delete_task(void *task)
+{
+}
+
 /*!
  * env_register_isr
  *
@@ -382,6 +511,18 @@ void env_map_memory(unsigned int pa, unsigned int va, unsigned int size, unsigne
     platform_map_mem_region(va, pa, size, flags);
 }
 
+/*!
+ * env_get_timestamp
+ *
+ * Returns a 64 bit time stamp, in CPU cycles.
+ *
+ */
+
+unsigned long long env_get_timestamp(void)
+{
+    return platform_get_timestamp();
+}
+
 /*!
  * env_disable_cache
  *
@@ -395,6 +536,30 @@ void env_disable_cache(void)
     platform_cache_disable();
 }
 
+/*!
+ * env_cache_flush_range
+ *
+ * Writes back cached data of the given memory range.
+ *
+ */
+
+void env_cache_flush_range(void *addr, unsigned long size)
+{
+    platform_cache_range_flush(addr, size);
+}
+
+/*!
+ * env_cache_invalidate_range
+ *
+ * Discards cached data of the given memory range.
+ *
+ */
+
+void env_cache_invalidate_range(void *addr, unsigned long size)
+{
+    platform_cache_range_invalidate(addr, size);
+}
+
 /*========================================================= */
 /* Util data / functions for BM */
 
@@ -424,6 +424,48 @@ void env_release_sync_lock(void *lock)
     }
 }
 
+/*!
+ * env_acquire_sync_lock_timeout
+ *
+ * Tries to acquire the lock, waits at most timeout_ms for it
+ * to become available. Updates timeout_ms with the time left.
+ */
+int env_acquire_sync_lock_timeout(void *lock, unsigned long *timeout_ms)
+{
+    SemaphoreHandle_t xSemaphore = (SemaphoreHandle_t)lock;
+    TickType_t xTicksToWait;
+    TimeOut_t xTimeOut;
+
+    if (env_in_isr())
+    {
+        return 0;
+    }
+
+    if (portMAX_DELAY == *timeout_ms)
+    {
+        return (xSemaphoreTake(xSemaphore, portMAX_DELAY) == pdPASS);
+    }
+
+    /* Round up, so that a short timeout does not turn into a nonblocking take */
+    xTicksToWait = (*timeout_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    vTaskSetTimeOutState(&xTimeOut);
+    if (xSemaphoreTake(xSemaphore, xTicksToWait) == pdPASS)
+    {
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) == pdFALSE)
+        {
+            *timeout_ms = xTicksToWait * portTICK_PERIOD_MS;
+        }
+        else
+        {
+            *timeout_ms = 0;
+        }
+        return 1;
+    }
+
+    *timeout_ms = 0;
+    return 0;
+}
+
 /*!
  * env_sleep_msec
  *
@@ -434,6 +476,39 @@ void env_sleep_msec(int num_msec)
     vTaskDelay(num_msec / portTICK_PERIOD_MS);
 }
 
+/*!
+ * env_create_task
+ *
+ * Creates a task running the given function.
+ *
+ */
+int env_create_task(
+    void **task, void (*entry)(void *arg), const char *name, unsigned int stack_size, unsigned int priority, void *arg)
+{
+    TaskHandle_t xHandle = NULL;
+
+    if (xTaskCreate(entry, name, (unsigned short)stack_size, arg, (UBaseType_t)priority, &xHandle) == pdPASS)
+    {
+        *task = xHandle;
+        return 0;
+    }
+    else
+    {
+        return -1;
+    }
+}
+
+/*!
+ * env_delete_task
+ *
+ * Deletes the given task, or the calling task if task is NULL.
+ *
+ */
+void env_delete_task(void *task)
+{
+    vTaskDelete((TaskHandle_t)task);
+}
+
 /*!
  * env_register_isr
  *
@@ -522,24 +597,41 @@ void env_disable_cache(void)
     platform_cache_disable();
 }
 
+/*!
+ * env_cache_flush_range
+ *
+ * Writes back cached data of the given memory range.
+ *
+ */
+
+void env_cache_flush_range(void *addr, unsigned long size)
+{
+    platform_cache_range_flush(addr, size);
+}
+
+/*!
+ * env_cache_invalidate_range
+ *
+ * Discards cached data of the given memory range.
+ *
+ */
+
+void env_cache_invalidate_range(void *addr, unsigned long size)
+{
+    platform_cache_range_invalidate(addr, size);
+}
+
 /*!
  *
  * env_get_timestamp
  *
- * Returns a 64 bit time stamp.
+ * Returns a 64 bit time stamp, in CPU cycles.
  *
  *
  */
 unsigned long long env_get_timestamp(void)
 {
-    if (env_in_isr())
-    {
-        return (unsigned long long)xTaskGetTickCountFromISR();
-    }
-    else
-    {
-        return (unsigned long long)xTaskGetTickCount();
-    }
+    return platform_get_timestamp();
 }
 
 /*========================================================= */
@@ -682,3 +774,84 @@ int env_get_current_queue_size(void *queue)
         return(uxQueueMessagesWaiting(queue));
     }
 }
+
+/*!
+ * env_get_current_task
+ *
+ * Returns the handle of the calling task.
+ *
+ * @return - task handle
+ */
+
+void *env_get_current_task(void)
+{
+    return (void *)xTaskGetCurrentTaskHandle();
+}
+
+/*!
+ * env_notify_task
+ *
+ * Sends a direct notification to a task waiting in env_wait_task_notify().
+ *
+ * @param task - task to notify
+ */
+
+void env_notify_task(void *task)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    if (env_in_isr())
+    {
+        vTaskNotifyGiveFromISR((TaskHandle_t)task, &xHigherPriorityTaskWoken);
+        portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
+    }
+    else
+    {
+        xTaskNotifyGive((TaskHandle_t)task);
+    }
+}
+
+/*!
+ * env_wait_task_notify
+ *
+ * Waits at most timeout_ms for a notification sent to the calling task.
+ * Updates timeout_ms with the time left.
+ *
+ * @param timeout_ms - in: timeout in ms, out: remaining time in ms
+ *
+ * @return - 1 when notified, 0 on timeout
+ */
+
+int env_wait_task_notify(unsigned long *timeout_ms)
+{
+    TickType_t xTicksToWait;
+    TimeOut_t xTimeOut;
+
+    if (env_in_isr())
+    {
+        return 0;
+    }
+
+    if (portMAX_DELAY == *timeout_ms)
+    {
+        return (ulTaskNotifyTake(pdTRUE, portMAX_DELAY) != 0);
+    }
+
+    /* Round up, so that a short timeout does not turn into a nonblocking take */
+    xTicksToWait = (*timeout_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+    vTaskSetTimeOutState(&xTimeOut);
+    if (ulTaskNotifyTake(pdTRUE, xTicksToWait) != 0)
+    {
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) == pdFALSE)
+        {
+            *timeout_ms = xTicksToWait * portTICK_PERIOD_MS;
+        }
+        else
+        {
+            *timeout_ms = 0;
+        }
+        return 1;
+    }
+
+    *timeout_ms = 0;
+    return 0;
+}
@@ -0,0 +1,404 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "rpmsg_platform.h"
+#include "rpmsg_env.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#define RPMSG_MAILBOX_STACK_SIZE (configMINIMAL_STACK_SIZE * 2)
+
+/* Peer vq raised by a notification of the given vq */
+#define RPMSG_PEER_VQ_ID(vq_id) RL_GET_VQ_ID(RL_PLATFORM_PEER_LINK_ID(RL_GET_LINK_ID(vq_id)), RL_GET_Q_ID(vq_id))
+
+static volatile uint32_t vq_pending = 0;    /* raised vqs, like the MU rx flags */
+static volatile uint32_t vq_registered = 0; /* vqs with a registered ISR */
+static SemaphoreHandle_t irq_lock;          /* held while the "interrupt" is masked or running */
+static TaskHandle_t mailbox_task;
+static void *lock;
+
+/* Cache maintenance calls, the last RL_PLATFORM_CACHE_LOG_SIZE are kept in order */
+static unsigned long cache_op_count[2];
+static struct platform_cache_op cache_log[RL_PLATFORM_CACHE_LOG_SIZE];
+
+/*
+ * Mailbox task, plays the role of the MU interrupt handler
+ */
+static void platform_mailbox_task(void *param)
+{
+    uint32_t pending;
+    int vq_id;
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        xSemaphoreTakeRecursive(irq_lock, portMAX_DELAY);
+        do
+        {
+            taskENTER_CRITICAL();
+            pending = vq_pending & vq_registered;
+            vq_pending &= ~pending;
+            taskEXIT_CRITICAL();
+
+            for (vq_id = 0; pending; vq_id++, pending >>= 1)
+            {
+                if (pending & 1U)
+                {
+                    env_isr(vq_id);
+                }
+            }
+        } while (vq_pending & vq_registered);
+        xSemaphoreGiveRecursive(irq_lock);
+    }
+}
+
+int platform_init_interrupt(int vq_id, void *isr_data)
+{
+    assert(RL_GET_LINK_ID(vq_id) < RL_PLATFORM_LINK_COUNT);
+
+    /* Register ISR to environment layer */
+    env_register_isr(vq_id, isr_data);
+
+    env_lock_mutex(lock);
+    taskENTER_CRITICAL();
+    vq_registered |= (1U << vq_id);
+    taskEXIT_CRITICAL();
+    env_unlock_mutex(lock);
+
+    /* Deliver a notification raised before the ISR was registered */
+    if (vq_pending & (1U << vq_id))
+    {
+        xTaskNotifyGive(mailbox_task);
+    }
+
+    return 0;
+}
+
+int platform_deinit_interrupt(int vq_id)
+{
+    assert(RL_GET_LINK_ID(vq_id) < RL_PLATFORM_LINK_COUNT);
+
+    env_lock_mutex(lock);
+    taskENTER_CRITICAL();
+    vq_registered &= ~(1U << vq_id);
+    vq_pending &= ~(1U << vq_id);
+    taskEXIT_CRITICAL();
+
+    /* Unregister ISR from environment layer */
+    env_unregister_isr(vq_id);
+
+    env_unlock_mutex(lock);
+
+    return 0;
+}
+
+void platform_notify(int vq_id)
+{
+    /* Raise the vq of the peer link, never blocks, repeated notifications coalesce */
+    taskENTER_CRITICAL();
+    vq_pending |= (1U << RPMSG_PEER_VQ_ID(vq_id));
+    taskEXIT_CRITICAL();
+
+    xTaskNotifyGive(mailbox_task);
+}
+
+/**
+ * platform_time_delay
+ *
+ * @param num_msec Delay time in ms.
+ *
+ * This is not an accurate delay, it ensures at least num_msec passed when return.
+ */
+void platform_time_delay(int num_msec)
+{
+    unsigned long long end = platform_get_timestamp() + (unsigned long long)num_msec * 1000000ULL;
+
+    while (platform_get_timestamp() < end)
+    {
+    }
+}
+
+/**
+ * platform_get_timestamp
+ *
+ * Returns the monotonic host time in nanoseconds.
+ */
+unsigned long long platform_get_timestamp(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+/**
+ * platform_in_isr
+ *
+ * Return whether CPU is processing IRQ
+ *
+ * The mailbox task runs the ISRs in task context, so this is always false.
+ *
+ * @return True for IRQ, false otherwise.
+ *
+ */
+int platform_in_isr(void)
+{
+    return 0;
+}
+
+/**
+ * platform_global_isr_disable
+ *
+ * Mask all interrupts, for short read-modify-write sequences
+ * on data shared with interrupt handlers.
+ *
+ * The ISRs run in the mailbox task, which is held off by the irq lock.
+ *
+ * @return Previous state, to be passed to platform_global_isr_restore().
+ *
+ */
+unsigned int platform_global_isr_disable(void)
+{
+    xSemaphoreTakeRecursive(irq_lock, portMAX_DELAY);
+    return 0;
+}
+
+/**
+ * platform_global_isr_restore
+ *
+ * Restore the interrupt mask returned by platform_global_isr_disable().
+ *
+ * @param state Previous state
+ *
+ */
+void platform_global_isr_restore(unsigned int state)
+{
+    xSemaphoreGiveRecursive(irq_lock);
+}
+
+/**
+ * platform_interrupt_enable
+ *
+ * Enable peripheral-related interrupt with passed priority and type.
+ *
+ * @param vq_id Vector ID that need to be converted to IRQ number
+ *
+ * @return vq_id. Return value is never checked..
+ *
+ */
+int platform_interrupt_enable(unsigned int vq_id)
+{
+    xSemaphoreGiveRecursive(irq_lock);
+    return (vq_id);
+}
+
+/**
+ * platform_interrupt_disable
+ *
+ * Disable peripheral-related interrupt.
+ *
+ * @param vq_id Vector ID that need to be converted to IRQ number
+ *
+ * @return vq_id. Return value is never checked.
+ *
+ */
+int platform_interrupt_disable(unsigned int vq_id)
+{
+    // virtqueues share the mailbox task, nested calls are counted by the recursive lock
+    xSemaphoreTakeRecursive(irq_lock, portMAX_DELAY);
+    return (vq_id);
+}
+
+/**
+ * platform_map_mem_region
+ *
+ * Dummy implementation
+ *
+ */
+void platform_map_mem_region(unsigned int vrt_addr, unsigned int phy_addr, unsigned int size, unsigned int flags)
+{
+}
+
+/**
+ * platform_cache_all_flush_invalidate
+ *
+ * Dummy implementation
+ *
+ */
+void platform_cache_all_flush_invalidate()
+{
+}
+
+/**
+ * platform_cache_disable
+ *
+ * Dummy implementation
+ *
+ */
+void platform_cache_disable()
+{
+}
+
+static void platform_cache_record(void *addr, unsigned int size, int op)
+{
+    struct platform_cache_op *cache_op;
+
+    taskENTER_CRITICAL();
+    cache_op = &cache_log[(cache_op_count[0] + cache_op_count[1]) % RL_PLATFORM_CACHE_LOG_SIZE];
+    cache_op->addr = addr;
+    cache_op->size = size;
+    cache_op->op = op;
+    cache_op_count[op]++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * platform_cache_range_flush
+ *
+ * The shared memory is coherent, the call is only recorded
+ *
+ */
+void platform_cache_range_flush(void *addr, unsigned int size)
+{
+    platform_cache_record(addr, size, RL_PLATFORM_CACHE_FLUSH);
+}
+
+/**
+ * platform_cache_range_invalidate
+ *
+ * The shared memory is coherent, the call is only recorded
+ *
+ */
+void platform_cache_range_invalidate(void *addr, unsigned int size)
+{
+    platform_cache_record(addr, size, RL_PLATFORM_CACHE_INVALIDATE);
+}
+
+/**
+ * platform_cache_op_count
+ *
+ * Number of cache range flush or invalidate calls so far
+ *
+ * @param op RL_PLATFORM_CACHE_FLUSH or RL_PLATFORM_CACHE_INVALIDATE
+ *
+ * @return Number of calls
+ */
+unsigned long platform_cache_op_count(int op)
+{
+    return cache_op_count[op];
+}
+
+/**
+ * platform_cache_get_op
+ *
+ * Returns a recorded cache range call, by its sequence number:
+ * the flushes and invalidates made before it
+ *
+ * @param seq      Sequence number
+ * @param cache_op Recorded call
+ *
+ * @return 0 on success, -1 if the call is not recorded (yet)
+ */
+int platform_cache_get_op(unsigned long seq, struct platform_cache_op *cache_op)
+{
+    int status = -1;
+
+    taskENTER_CRITICAL();
+    if ((seq < cache_op_count[0] + cache_op_count[1]) &&
+        (cache_op_count[0] + cache_op_count[1] - seq <= RL_PLATFORM_CACHE_LOG_SIZE))
+    {
+        *cache_op = cache_log[seq % RL_PLATFORM_CACHE_LOG_SIZE];
+        status = 0;
+    }
+    taskEXIT_CRITICAL();
+
+    return status;
+}
+
+/**
+ * platform_vatopa
+ *
+ * Dummy implementation
+ *
+ */
+unsigned long platform_vatopa(void *addr)
+{
+    return ((unsigned long)addr);
+}
+
+/**
+ * platform_patova
+ *
+ * Dummy implementation
+ *
+ */
+void *platform_patova(unsigned long addr)
+{
+    return ((void *)addr);
+}
+
+/**
+ * platform_init
+ *
+ * platform/environment init
+ */
+int platform_init(void)
+{
+    vq_pending = 0;
+    vq_registered = 0;
+
+    irq_lock = xSemaphoreCreateRecursiveMutex();
+    if (!irq_lock)
+    {
+        return -1;
+    }
+
+    if (xTaskCreate(platform_mailbox_task, "rpmsg_mailbox", RPMSG_MAILBOX_STACK_SIZE, NULL,
+                    RL_PLATFORM_MAILBOX_PRIORITY, &mailbox_task) != pdPASS)
+    {
+        vSemaphoreDelete(irq_lock);
+        return -1;
+    }
+
+    /* Create lock used in multi-instanced RPMsg */
+    env_create_mutex(&lock, 1);
+
+    return 0;
+}
+
+/**
+ * platform_deinit
+ *
+ * platform/environment deinit process
+ */
+int platform_deinit(void)
+{
+    BaseType_t taken;
+
+    /* env_deinit() calls this with the scheduler suspended, so there is no waiting for the irq lock.
+     * The mailbox task has the highest priority, it only holds the lock now if an ISR blocked. */
+    taken = xSemaphoreTakeRecursive(irq_lock, 0);
+    assert(taken == pdTRUE);
+    (void)taken;
+    vTaskDelete(mailbox_task);
+    mailbox_task = NULL;
+    xSemaphoreGiveRecursive(irq_lock);
+    vSemaphoreDelete(irq_lock);
+    irq_lock = NULL;
+
+    /* Delete lock used in multi-instanced RPMsg */
+    env_delete_mutex(lock);
+    lock = NULL;
+    return 0;
+}
@@ -17,22 +17,34 @@
 
 #define APP_MU_IRQ_PRIORITY (3U)
 
-static int isr_counter = 0;
+/* MU rx interrupt of a channel */
+#define RPMSG_MU_RX_INT(channel) ((1U << 27U) >> (channel))
+
+static int isr_counter[RPMSG_MU_CHANNEL_COUNT] = {0};
+static volatile uint32_t isr_channels = 0; /* channels with rx interrupt enabled */
 static int disable_counter = 0;
 static void *lock;
+static void *send_lock[RPMSG_MU_CHANNEL_COUNT];
 
 int platform_init_interrupt(int vq_id, void *isr_data)
 {
+    uint32_t channel = RL_PLATFORM_LINK_MU_CHANNEL(RL_GET_LINK_ID(vq_id));
+
+    assert(channel < RPMSG_MU_CHANNEL_COUNT);
+
     /* Register ISR to environment layer */
     env_register_isr(vq_id, isr_data);
 
-    /* Prepare the MU Hardware, enable channel 1 interrupt */
+    /* Prepare the MU Hardware, enable the rx interrupt of the link channel */
     env_lock_mutex(lock);
 
-    assert(0 <= isr_counter);
-    if (!isr_counter)
-        MU_EnableInterrupts(MUB, (1U << 27U) >> RPMSG_MU_CHANNEL);
-    isr_counter++;
+    assert(0 <= isr_counter[channel]);
+    if (!isr_counter[channel])
+    {
+        isr_channels |= (1U << channel);
+        MU_EnableInterrupts(MUB, RPMSG_MU_RX_INT(channel));
+    }
+    isr_counter[channel]++;
 
     env_unlock_mutex(lock);
 
@@ -41,13 +53,20 @@ int platform_init_interrupt(int vq_id, void *isr_data)
 
 int platform_deinit_interrupt(int vq_id)
 {
+    uint32_t channel = RL_PLATFORM_LINK_MU_CHANNEL(RL_GET_LINK_ID(vq_id));
+
+    assert(channel < RPMSG_MU_CHANNEL_COUNT);
+
     /* Prepare the MU Hardware */
     env_lock_mutex(lock);
 
-    assert(0 < isr_counter);
-    isr_counter--;
-    if (!isr_counter)
-        MU_DisableInterrupts(MUB, (1U << 27U) >> RPMSG_MU_CHANNEL);
+    assert(0 < isr_counter[channel]);
+    isr_counter[channel]--;
+    if (!isr_counter[channel])
+    {
+        MU_DisableInterrupts(MUB, RPMSG_MU_RX_INT(channel));
+        isr_channels &= ~(1U << channel);
+    }
 
     /* Unregister ISR from environment layer */
     env_unregister_isr(vq_id);
@@ -59,12 +78,13 @@ int platform_deinit_interrupt(int vq_id)
 
 void platform_notify(int vq_id)
 {
-    /* As Linux suggests, use MU->Data Channel 1 as communication channel */
+    /* As Linux suggests, link 0 uses MU->Data Channel 1 as communication channel */
+    uint32_t channel = RL_PLATFORM_LINK_MU_CHANNEL(RL_GET_LINK_ID(vq_id));
     uint32_t msg = (uint32_t)(vq_id << 16);
 
-    env_lock_mutex(lock);
-    MU_SendMsg(MUB, RPMSG_MU_CHANNEL, msg);
-    env_unlock_mutex(lock);
+    env_lock_mutex(send_lock[channel]);
+    MU_SendMsg(MUB, channel, msg);
+    env_unlock_mutex(send_lock[channel]);
 }
 
 /*
@@ -72,12 +92,17 @@ void platform_notify(int vq_id)
  */
 int MU_M4_IRQHandler()
 {
+    uint32_t flags = MU_GetStatusFlags(MUB);
     uint32_t channel;
+    uint32_t msg;
 
-    if (((1U << 27U) >> RPMSG_MU_CHANNEL) & MU_GetStatusFlags(MUB))
+    for (channel = 0; channel < RPMSG_MU_CHANNEL_COUNT; channel++)
     {
-        channel = MU_ReceiveMsgNonBlocking(MUB, RPMSG_MU_CHANNEL); // Read message from RX register.
-        env_isr(channel >> 16);
+        if ((isr_channels & (1U << channel)) && (RPMSG_MU_RX_INT(channel) & flags))
+        {
+            msg = MU_ReceiveMsgNonBlocking(MUB, channel); // Read message from RX register.
+            env_isr(msg >> 16);
+        }
     }
 
     return 0;
@@ -108,6 +133,33 @@ void platform_time_delay(int num_msec)
     }
 }
 
+/**
+ * platform_get_timestamp
+ *
+ * Returns the DWT cycle counter, extended to 64 bits.
+ * Wrap-arounds are only detected when the counter is read
+ * at least once per 2^32 CPU cycles. platform_init() only
+ * starts the counter with RL_USE_STATS.
+ */
+unsigned long long platform_get_timestamp(void)
+{
+    static uint32_t timestamp_high = 0;
+    static uint32_t timestamp_last = 0;
+    uint32_t primask;
+    uint32_t cycles;
+
+    primask = DisableGlobalIRQ();
+    cycles = DWT->CYCCNT;
+    if (cycles < timestamp_last)
+    {
+        timestamp_high++;
+    }
+    timestamp_last = cycles;
+    EnableGlobalIRQ(primask);
+
+    return ((unsigned long long)timestamp_high << 32) | cycles;
+}
+
 /**
  * platform_in_isr
  *
@@ -121,6 +173,33 @@ int platform_in_isr(void)
     return ((SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0);
 }
 
+/**
+ * platform_global_isr_disable
+ *
+ * Mask all interrupts, for short read-modify-write sequences
+ * on data shared with interrupt handlers.
+ *
+ * @return Previous PRIMASK, to be passed to platform_global_isr_restore().
+ *
+ */
+unsigned int platform_global_isr_disable(void)
+{
+    return DisableGlobalIRQ();
+}
+
+/**
+ * platform_global_isr_restore
+ *
+ * Restore the interrupt mask returned by platform_global_isr_disable().
+ *
+ * @param state Previous PRIMASK
+ *
+ */
+void platform_global_isr_restore(unsigned int state)
+{
+    EnableGlobalIRQ(state);
+}
+
 /**
  * platform_interrupt_enable
  *
@@ -201,6 +280,63 @@ void platform_cache_disable()
 {
 }
 
+/* LMEM cache line commands */
+#define PLATFORM_CACHE_LCMD_INVALIDATE (1U)
+#define PLATFORM_CACHE_LCMD_PUSH (2U)
+
+/**
+ * platform_cache_range_cmd
+ *
+ * Runs the cache line command on all system cache lines
+ * covering the given range
+ *
+ */
+static void platform_cache_range_cmd(void *addr, unsigned int size, uint32_t cmd)
+{
+    uint32_t start = (uint32_t)addr & ~(FSL_FEATURE_L1DCACHE_LINESIZE_BYTE - 1U);
+    uint32_t end = (uint32_t)addr + size;
+
+    if ((!size) || (!(LMEM->PSCCR & LMEM_PSCCR_ENCACHE_MASK)))
+    {
+        return;
+    }
+
+    /* Make sure outstanding writes are in the cache */
+    __DSB();
+
+    LMEM->PSCLCR = (LMEM->PSCLCR & ~LMEM_PSCLCR_LCMD_MASK) | LMEM_PSCLCR_LCMD(cmd) | LMEM_PSCLCR_LADSEL_MASK;
+    while (start < end)
+    {
+        LMEM->PSCSAR = (start & LMEM_PSCSAR_PHYADDR_MASK) | LMEM_PSCSAR_LGO_MASK;
+        while (LMEM->PSCSAR & LMEM_PSCSAR_LGO_MASK)
+        {
+        }
+        start += FSL_FEATURE_L1DCACHE_LINESIZE_BYTE;
+    }
+}
+
+/**
+ * platform_cache_range_flush
+ *
+ * Writes back the system cache lines covering the given range
+ *
+ */
+void platform_cache_range_flush(void *addr, unsigned int size)
+{
+    platform_cache_range_cmd(addr, size, PLATFORM_CACHE_LCMD_PUSH);
+}
+
+/**
+ * platform_cache_range_invalidate
+ *
+ * Invalidates the system cache lines covering the given range
+ *
+ */
+void platform_cache_range_invalidate(void *addr, unsigned int size)
+{
+    platform_cache_range_cmd(addr, size, PLATFORM_CACHE_LCMD_INVALIDATE);
+}
+
 /**
  * platform_vatopa
  *
@@ -230,6 +366,8 @@ void *platform_patova(unsigned long addr)
  */
 int platform_init(void)
 {
+    int channel;
+
     /*
      * Prepare for the MU Interrupt
      *  MU must be initialized before rpmsg init is called
@@ -238,8 +376,18 @@ int platform_init(void)
     NVIC_SetPriority(MU_M4_IRQn, APP_MU_IRQ_PRIORITY);
     NVIC_EnableIRQ(MU_M4_IRQn);
 
-    /* Create lock used in multi-instanced RPMsg */
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    /* Start the cycle counter used for the time stamps of the statistics */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    /* Create locks used in multi-instanced RPMsg */
     env_create_mutex(&lock, 1);
+    for (channel = 0; channel < RPMSG_MU_CHANNEL_COUNT; channel++)
+    {
+        env_create_mutex(&send_lock[channel], 1);
+    }
 
     return 0;
 }
@@ -251,7 +399,14 @@ int platform_init(void)
  */
 int platform_deinit(void)
 {
-    /* Delete lock used in multi-instanced RPMsg */
+    int channel;
+
+    /* Delete locks used in multi-instanced RPMsg */
+    for (channel = 0; channel < RPMSG_MU_CHANNEL_COUNT; channel++)
+    {
+        env_delete_mutex(send_lock[channel]);
+        send_lock[channel] = NULL;
+    }
     env_delete_mutex(lock);
     lock = NULL;
     return 0;
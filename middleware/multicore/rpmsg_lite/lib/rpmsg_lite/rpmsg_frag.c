@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2014, Mentor Graphics Corporation
+ * Copyright (c) 2015 Xilinx, Inc.
+ * Copyright (c) 2016 Freescale Semiconductor, Inc.
+ * Copyright 2016 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "rpmsg_lite.h"
+#include "rpmsg_frag.h"
+
+#if defined(RL_API_HAS_ZEROCOPY) && (RL_API_HAS_ZEROCOPY == 1)
+
+#define RL_FRAG_NO_SPACE (0xFFFFFFFF)
+
+/* Partially received message no longer progressing, its slot may be reused */
+#define RL_FRAG_STALE_COUNT (2 * RL_BUFFER_COUNT)
+
+/*!
+ * struct rpmsg_frag_hdr - fragment header
+ * @msg_id: message identifier, unique per sender endpoint
+ * @reserved: reserved, must be 0
+ * @size: total size of the message
+ * @offset: offset of the fragment payload within the message
+ *
+ * Every fragment is sent in its own rpmsg buffer, fragment payload
+ * follows the header. Fragments of one message are sent in order.
+ */
+RL_PACKED_BEGIN
+struct rpmsg_frag_hdr
+{
+    unsigned short msg_id;
+    unsigned short reserved;
+    unsigned long size;
+    unsigned long offset;
+} RL_PACKED_END;
+
+/*!
+ * @brief
+ * Finds the arena offset where a message of given size fits
+ * without overlapping any message being reassembled.
+ *
+ * @param ctxt  Fragmentation context
+ * @param size  Message size, in bytes
+ *
+ * @return Arena offset, RL_FRAG_NO_SPACE if the message does not fit.
+ */
+static unsigned long rpmsg_frag_find_space(struct rpmsg_frag_context *ctxt, unsigned long size)
+{
+    struct rpmsg_frag_slot *slot;
+    unsigned long start;
+    int i, j;
+
+    /* Candidates are the arena start and the end of each used region */
+    for (i = -1; i < RL_FRAG_MAX_MSGS; i++)
+    {
+        if (i < 0)
+        {
+            start = 0;
+        }
+        else if (ctxt->slots[i].in_use)
+        {
+            start = ctxt->slots[i].offset + ctxt->slots[i].size;
+        }
+        else
+        {
+            continue;
+        }
+
+        if ((start > ctxt->arena_size) || (size > ctxt->arena_size - start))
+        {
+            continue;
+        }
+
+        for (j = 0; j < RL_FRAG_MAX_MSGS; j++)
+        {
+            slot = &ctxt->slots[j];
+            if (slot->in_use && (start < slot->offset + slot->size) && (slot->offset < start + size))
+            {
+                break;
+            }
+        }
+
+        if (j == RL_FRAG_MAX_MSGS)
+        {
+            return start;
+        }
+    }
+
+    return RL_FRAG_NO_SPACE;
+}
+
+/*!
+ * @brief
+ * Reserves a slot and arena space for a new message, reclaiming
+ * stale partially received messages when needed.
+ *
+ * @param ctxt  Fragmentation context
+ * @param src   Sender address
+ * @param hdr   Header of the first fragment
+ *
+ * @return Slot, RL_NULL if the message can not be reassembled.
+ */
+static struct rpmsg_frag_slot *rpmsg_frag_alloc_slot(struct rpmsg_frag_context *ctxt,
+                                                     unsigned long src,
+                                                     struct rpmsg_frag_hdr *hdr)
+{
+    struct rpmsg_frag_slot *free_slot;
+    struct rpmsg_frag_slot *stale_slot;
+    unsigned long offset;
+    int i;
+
+    for (;;)
+    {
+        free_slot = RL_NULL;
+        stale_slot = RL_NULL;
+        for (i = 0; i < RL_FRAG_MAX_MSGS; i++)
+        {
+            if (!ctxt->slots[i].in_use)
+            {
+                if (!free_slot)
+                {
+                    free_slot = &ctxt->slots[i];
+                }
+            }
+            else if ((ctxt->frag_count - ctxt->slots[i].stamp) > RL_FRAG_STALE_COUNT)
+            {
+                /* Pick the least recently updated one */
+                if (!stale_slot || ((ctxt->frag_count - ctxt->slots[i].stamp) >
+                                    (ctxt->frag_count - stale_slot->stamp)))
+                {
+                    stale_slot = &ctxt->slots[i];
+                }
+            }
+        }
+
+        if (free_slot)
+        {
+            offset = rpmsg_frag_find_space(ctxt, hdr->size);
+            if (offset != RL_FRAG_NO_SPACE)
+            {
+                free_slot->src = src;
+                free_slot->msg_id = hdr->msg_id;
+                free_slot->offset = offset;
+                free_slot->size = hdr->size;
+                free_slot->received = 0;
+                free_slot->in_use = 1;
+                return free_slot;
+            }
+        }
+
+        if (!stale_slot)
+        {
+            return RL_NULL;
+        }
+        stale_slot->in_use = 0;
+    }
+}
+
+/*!
+ * @brief
+ * Fragmentation endpoint callback, called in the context of the rx callback
+ *
+ * @param payload     Pointer to the buffer containing received data
+ * @param payload_len Size of data received, in bytes
+ * @param src         Pointer to address of the endpoint from which data is received
+ * @param priv        Private data provided during endpoint creation
+ *
+ * @return  RL_RELEASE, message is always freed
+ *
+ */
+static int rpmsg_frag_ept_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    struct rpmsg_frag_context *ctxt = priv;
+    struct rpmsg_frag_hdr *hdr = payload;
+    struct rpmsg_frag_slot *slot = RL_NULL;
+    char *data = (char *)payload + sizeof(struct rpmsg_frag_hdr);
+    unsigned long len;
+    int i;
+
+    RL_ASSERT(priv);
+
+    ctxt->frag_count++;
+
+    /* Drop likely bad messages */
+    if (payload_len < (int)sizeof(struct rpmsg_frag_hdr))
+    {
+        return RL_RELEASE;
+    }
+    len = (unsigned long)payload_len - sizeof(struct rpmsg_frag_hdr);
+    if ((hdr->offset > hdr->size) || (len > hdr->size - hdr->offset))
+    {
+        return RL_RELEASE;
+    }
+
+    /* Message fits in one fragment, pass it on without copying */
+    if ((hdr->offset == 0) && (len == hdr->size))
+    {
+        ctxt->cb(data, len, src, ctxt->cb_data);
+        return RL_RELEASE;
+    }
+
+    for (i = 0; i < RL_FRAG_MAX_MSGS; i++)
+    {
+        if (ctxt->slots[i].in_use && (ctxt->slots[i].src == src) && (ctxt->slots[i].msg_id == hdr->msg_id))
+        {
+            slot = &ctxt->slots[i];
+            break;
+        }
+    }
+
+    if (hdr->offset == 0)
+    {
+        /* The sender restarted the message */
+        if (slot)
+        {
+            slot->in_use = 0;
+        }
+        slot = rpmsg_frag_alloc_slot(ctxt, src, hdr);
+    }
+
+    if (!slot)
+    {
+        return RL_RELEASE;
+    }
+
+    /* Fragment lost or inconsistent, drop the whole message */
+    if ((slot->size != hdr->size) || (slot->received != hdr->offset))
+    {
+        slot->in_use = 0;
+        return RL_RELEASE;
+    }
+
+    env_memcpy(ctxt->arena + slot->offset + hdr->offset, data, len);
+    slot->received += len;
+    slot->stamp = ctxt->frag_count;
+
+    if (slot->received == slot->size)
+    {
+        ctxt->cb(ctxt->arena + slot->offset, slot->size, src, ctxt->cb_data);
+        slot->in_use = 0;
+    }
+
+    return RL_RELEASE;
+}
+
+#if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
+rpmsg_frag_handle rpmsg_frag_create(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                                    unsigned long addr,
+                                    rpmsg_frag_rx_cb rx_cb,
+                                    void *rx_cb_data,
+                                    void *arena,
+                                    unsigned long arena_size,
+                                    rpmsg_frag_static_context *frag_ctxt)
+#else
+rpmsg_frag_handle rpmsg_frag_create(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                                    unsigned long addr,
+                                    rpmsg_frag_rx_cb rx_cb,
+                                    void *rx_cb_data,
+                                    void *arena,
+                                    unsigned long arena_size)
+#endif /* RL_USE_STATIC_API */
+{
+    struct rpmsg_frag_context *ctxt;
+
+    if ((rpmsg_lite_dev == RL_NULL) || (rx_cb == RL_NULL) || ((arena == RL_NULL) && (arena_size != 0)))
+    {
+        return RL_NULL;
+    }
+
+#if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
+    if (frag_ctxt == RL_NULL)
+    {
+        return RL_NULL;
+    }
+    ctxt = &frag_ctxt->frag_ctxt;
+#else
+    ctxt = env_allocate_memory(sizeof(struct rpmsg_frag_context));
+    if (ctxt == RL_NULL)
+    {
+        return RL_NULL;
+    }
+#endif /* RL_USE_STATIC_API */
+
+    env_memset(ctxt, 0, sizeof(struct rpmsg_frag_context));
+    ctxt->rpmsg_lite_dev = rpmsg_lite_dev;
+    ctxt->cb = rx_cb;
+    ctxt->cb_data = rx_cb_data;
+    ctxt->arena = arena;
+    ctxt->arena_size = arena_size;
+
+#if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
+    ctxt->ept = rpmsg_lite_create_ept(rpmsg_lite_dev, addr, rpmsg_frag_ept_rx_cb, ctxt, &frag_ctxt->ept_ctxt);
+    if (ctxt->ept == RL_NULL)
+    {
+        return RL_NULL;
+    }
+#else
+    ctxt->ept = rpmsg_lite_create_ept(rpmsg_lite_dev, addr, rpmsg_frag_ept_rx_cb, ctxt);
+    if (ctxt->ept == RL_NULL)
+    {
+        env_free_memory(ctxt);
+        return RL_NULL;
+    }
+#endif /* RL_USE_STATIC_API */
+
+    return (rpmsg_frag_handle)ctxt;
+}
+
+int rpmsg_frag_destroy(rpmsg_frag_handle handle)
+{
+    struct rpmsg_frag_context *ctxt = (struct rpmsg_frag_context *)handle;
+    int retval;
+
+    if (ctxt == RL_NULL)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    retval = rpmsg_lite_destroy_ept(ctxt->rpmsg_lite_dev, ctxt->ept);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+    env_free_memory(ctxt);
+#endif
+    return retval;
+}
+
+unsigned long rpmsg_frag_get_addr(rpmsg_frag_handle handle)
+{
+    return handle->ept->addr;
+}
+
+int rpmsg_frag_send(
+    rpmsg_frag_handle handle, unsigned long dst, char *data, unsigned long size, unsigned long timeout)
+{
+    struct rpmsg_frag_context *ctxt = (struct rpmsg_frag_context *)handle;
+    struct rpmsg_frag_hdr *hdr;
+    unsigned long buff_len;
+    unsigned long offset = 0;
+    unsigned long chunk;
+    unsigned short msg_id;
+    void *buffer;
+    int status;
+
+    if ((ctxt == RL_NULL) || ((data == RL_NULL) && (size != 0)))
+    {
+        return RL_ERR_PARAM;
+    }
+
+    env_lock_mutex(ctxt->rpmsg_lite_dev->lock);
+    msg_id = ctxt->next_msg_id++;
+    env_unlock_mutex(ctxt->rpmsg_lite_dev->lock);
+
+    do
+    {
+        buffer = rpmsg_lite_alloc_tx_buffer(ctxt->rpmsg_lite_dev, &buff_len, timeout);
+        if (buffer == RL_NULL)
+        {
+            return RL_ERR_NO_MEM;
+        }
+        RL_ASSERT(buff_len > sizeof(struct rpmsg_frag_hdr));
+
+        chunk = buff_len - sizeof(struct rpmsg_frag_hdr);
+        if (chunk > size - offset)
+        {
+            chunk = size - offset;
+        }
+
+        hdr = (struct rpmsg_frag_hdr *)buffer;
+        hdr->msg_id = msg_id;
+        hdr->reserved = 0;
+        hdr->size = size;
+        hdr->offset = offset;
+
+        /* Copy data straight into the rpmsg buffer. */
+        env_memcpy((char *)buffer + sizeof(struct rpmsg_frag_hdr), data + offset, chunk);
+
+        status = rpmsg_lite_send_nocopy(ctxt->rpmsg_lite_dev, ctxt->ept, dst, buffer,
+                                        sizeof(struct rpmsg_frag_hdr) + chunk);
+        if (status != RL_SUCCESS)
+        {
+            /* The buffer is still ours, give it back */
+            (void)rpmsg_lite_release_tx_buffer(ctxt->rpmsg_lite_dev, buffer);
+            return status;
+        }
+
+        offset += chunk;
+    } while (offset < size);
+
+    return RL_SUCCESS;
+}
+
+#endif /* RL_API_HAS_ZEROCOPY */
@@ -78,9 +78,12 @@ struct rpmsg_hdr_reserved
 struct virtqueue_ops
 {
     void (*vq_tx)(struct virtqueue *vq, void *buffer, unsigned long len, unsigned short idx);
-    void *(*vq_tx_alloc)(struct virtqueue *vq, unsigned long *len, unsigned short *idx);
+    void *(*vq_tx_alloc)(struct virtqueue *vq, unsigned long size, unsigned long *len, unsigned short *idx);
     void *(*vq_rx)(struct virtqueue *vq, unsigned long *len, unsigned short *idx);
     void (*vq_rx_free)(struct virtqueue *vq, void *buffer, unsigned long len, unsigned short idx);
+    void (*vq_rx_disable_cb)(struct virtqueue *vq);
+    int (*vq_rx_enable_cb)(struct virtqueue *vq);
+    void (*vq_tx_free)(struct virtqueue *vq, void *buffer, unsigned short idx);
 };
 
 /* Zero-Copy extension macros */
@@ -90,6 +93,13 @@ struct virtqueue_ops
 #error "RL_BUFFER_COUNT must be power of two (2, 4, ...)"
 #endif
 
+#if (!RL_EPT_LUT_SIZE) || (RL_EPT_LUT_SIZE & (RL_EPT_LUT_SIZE - 1))
+#error "RL_EPT_LUT_SIZE must be power of two (1, 2, 4, ...)"
+#endif
+
+/* Endpoint lookup table bucket of the given address */
+#define RL_EPT_LUT_HEAD(rpmsg_lite_dev, addr) (&(rpmsg_lite_dev)->rl_ept_lut[(addr) & (RL_EPT_LUT_SIZE - 1)])
+
 /* Buffer is formed by payload and struct rpmsg_std_hdr */
 #define RL_BUFFER_SIZE (RL_BUFFER_PAYLOAD_SIZE + 16)
 
@@ -98,6 +108,63 @@ struct virtqueue_ops
        "RL_BUFFER_PAYLOAD_SIZE must be equal to (240, 496, 1008, ...) [2^n - 16]."
 #endif
 
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+#define RL_CACHE_FLUSH(addr, size) env_cache_flush_range((void *)(addr), (size))
+#define RL_CACHE_INVALIDATE(addr, size) env_cache_invalidate_range((void *)(addr), (size))
+#else
+#define RL_CACHE_FLUSH(addr, size)
+#define RL_CACHE_INVALIDATE(addr, size)
+#endif /* RL_USE_CACHED_SHMEM */
+
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+/* End of a tx buffer free list */
+#define RL_BUFFER_CLASS_NONE (0xFFFF)
+
+/* Largest payload the instance can send */
+#define RL_TX_PAYLOAD_MAX(rpmsg_lite_dev) ((rpmsg_lite_dev)->tx_payload_max)
+
+/* Number of virtqueues the master fills with RL_BUFFER_SIZE buffers,
+ * tx buffers are carved from the size classes. */
+#define RL_MASTER_UNIFORM_VQS (1)
+
+static const unsigned long rl_buffer_class_size[RL_BUFFER_CLASSES] = RL_BUFFER_CLASS_SIZES;
+static const unsigned short rl_buffer_class_count[RL_BUFFER_CLASSES] = RL_BUFFER_CLASS_COUNTS;
+#else
+#define RL_TX_PAYLOAD_MAX(rpmsg_lite_dev) (RL_BUFFER_PAYLOAD_SIZE)
+#define RL_MASTER_UNIFORM_VQS (2)
+#endif /* RL_USE_BUFFER_CLASSES */
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+#define RL_STATS_INC(rpmsg_lite_dev, field) ((rpmsg_lite_dev)->stats.field++)
+#define RL_STATS_ADD(rpmsg_lite_dev, field, n) ((rpmsg_lite_dev)->stats.field += (n))
+#define RL_STATS_MAX(rpmsg_lite_dev, field, n)     \
+    do                                             \
+    {                                              \
+        if ((n) > (rpmsg_lite_dev)->stats.field)   \
+        {                                          \
+            (rpmsg_lite_dev)->stats.field = (n);   \
+        }                                          \
+    } while (0)
+#else
+#define RL_STATS_INC(rpmsg_lite_dev, field)
+#define RL_STATS_ADD(rpmsg_lite_dev, field, n)
+#define RL_STATS_MAX(rpmsg_lite_dev, field, n)
+#endif /* RL_USE_STATS */
+
+#if defined(RL_USE_STATS_EPT) && (RL_USE_STATS_EPT == 1)
+/* The statistics have to fit in one reply */
+typedef char rl_stats_ept_reply_fits[(sizeof(struct rpmsg_lite_stats) <= RL_BUFFER_PAYLOAD_SIZE) ? 1 : -1];
+
+int rpmsg_lite_format_message(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                              unsigned long src,
+                              unsigned long dst,
+                              char *data,
+                              unsigned long size,
+                              int flags,
+                              unsigned long timeout);
+static void rpmsg_lite_stats_ept_reply(struct rpmsg_lite_instance *rpmsg_lite_dev, unsigned long dst);
+#endif /* RL_USE_STATS_EPT */
+
 
 /*!
  * @brief
@@ -114,7 +181,7 @@ static struct llist *rpmsg_lite_get_endpoint_from_addr(struct rpmsg_lite_instanc
 {
     struct llist *rl_ept_lut_head;
 
-    rl_ept_lut_head = rpmsg_lite_dev->rl_endpoints;
+    rl_ept_lut_head = *RL_EPT_LUT_HEAD(rpmsg_lite_dev, addr);
     while (rl_ept_lut_head)
     {
         struct rpmsg_lite_endpoint *rl_ept = (struct rpmsg_lite_endpoint *)rl_ept_lut_head->data;
@@ -127,6 +194,89 @@ static struct llist *rpmsg_lite_get_endpoint_from_addr(struct rpmsg_lite_instanc
     return RL_NULL;
 }
 
+/*!
+ * @brief
+ * Notifies the other side about new buffers in the virtqueue,
+ * unless it masked notifications.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param vq                Virtqueue to kick
+ *
+ */
+static void rpmsg_lite_kick(struct rpmsg_lite_instance *rpmsg_lite_dev, struct virtqueue *vq)
+{
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    if (virtqueue_kick(vq))
+    {
+        RL_STATS_INC(rpmsg_lite_dev, kicks);
+    }
+    else
+    {
+        RL_STATS_INC(rpmsg_lite_dev, kicks_suppressed);
+    }
+#else
+    (void)virtqueue_kick(vq);
+#endif
+}
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+/*!
+ * @brief
+ * Adds a latency to a log2 histogram of RL_STATS_HIST_BINS buckets.
+ *
+ * @param hist     Histogram
+ * @param latency  Latency in timestamp units
+ *
+ */
+static void rpmsg_lite_stats_hist(uint32_t *hist, unsigned long latency)
+{
+    int bin = 0;
+
+    while (latency && (bin < RL_STATS_HIST_BINS - 1))
+    {
+        latency >>= 1;
+        bin++;
+    }
+    hist[bin]++;
+}
+
+/*!
+ * @brief
+ * Accounts the messages found on the rvq by one notification.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param count             Number of messages
+ *
+ */
+static void rpmsg_lite_stats_rx_batch(struct rpmsg_lite_instance *rpmsg_lite_dev, unsigned int count)
+{
+    if (count)
+    {
+        RL_STATS_INC(rpmsg_lite_dev, rx_batches);
+        RL_STATS_MAX(rpmsg_lite_dev, rx_batch_max, count);
+    }
+}
+#endif /* RL_USE_STATS */
+
+#if defined(RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION) && (RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION == 1)
+/*!
+ * @brief
+ * Notifies the other side that received buffers were returned to the rvq,
+ * its tx buffers. The notification is not subject to the kick suppression
+ * of the rvq, which only applies to new messages.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ *
+ */
+static void rpmsg_lite_notify_consumed(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    /* The used buffers must be visible before the notification */
+    env_mb();
+    platform_notify(rpmsg_lite_dev->rvq->vq_queue_index);
+    RL_STATS_INC(rpmsg_lite_dev, kicks);
+}
+#endif /* RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION */
+
 /***************************************************************
    mmm    mm   m      m      mmmmm    mm     mmm  m    m  mmmm
  m"   "   ##   #      #      #    #   ##   m"   " #  m"  #"   "
@@ -137,15 +287,16 @@ static struct llist *rpmsg_lite_get_endpoint_from_addr(struct rpmsg_lite_instanc
 
 /*!
  * @brief
- * Called when remote side calls virtqueue_kick()
- * at its transmit virtqueue.
- * In this callback, the buffer is read-out
- * of the rvq and user callback is called.
+ * Reads out up to max_count buffers from the rvq
+ * and calls the user callback for each of them.
  *
- * @param vq  Virtqueue affected by the kick
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param max_count         Maximum number of buffers to process
+ *
+ * @return  Number of processed buffers
  *
  */
-static void rpmsg_lite_rx_callback(struct virtqueue *vq)
+static unsigned int rpmsg_lite_rx_drain(struct rpmsg_lite_instance *rpmsg_lite_dev, unsigned int max_count)
 {
     struct rpmsg_std_msg *rpmsg_msg;
     unsigned long len;
@@ -154,37 +305,268 @@ static void rpmsg_lite_rx_callback(struct virtqueue *vq)
     int cb_ret;
     struct llist *node;
     struct rpmsg_hdr_reserved *rsvd;
-    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)vq->priv;
+    unsigned int count = 0;
+#if defined(RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION) && (RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION == 1)
+    unsigned int released = 0;
+#endif
 
-    RL_ASSERT(rpmsg_lite_dev != NULL);
+    while (count < max_count)
+    {
+        /* Process the received data from remote node */
+        env_lock_mutex(rpmsg_lite_dev->lock);
+        rpmsg_msg = (struct rpmsg_std_msg *)rpmsg_lite_dev->vq_ops->vq_rx(rpmsg_lite_dev->rvq, &len, &idx);
+        node = RL_NULL;
+        if (rpmsg_msg)
+        {
+            node = rpmsg_lite_get_endpoint_from_addr(rpmsg_lite_dev, rpmsg_msg->hdr.dst);
+        }
+        env_unlock_mutex(rpmsg_lite_dev->lock);
 
-    /* Process the received data from remote node */
-    rpmsg_msg = (struct rpmsg_std_msg *)rpmsg_lite_dev->vq_ops->vq_rx(rpmsg_lite_dev->rvq, &len, &idx);
+        if (!rpmsg_msg)
+        {
+            break;
+        }
 
-    while (rpmsg_msg)
-    {
-        node = rpmsg_lite_get_endpoint_from_addr(rpmsg_lite_dev, rpmsg_msg->hdr.dst);
+        RL_STATS_INC(rpmsg_lite_dev, rx_msgs);
+        RL_STATS_ADD(rpmsg_lite_dev, rx_bytes, rpmsg_msg->hdr.len);
 
         cb_ret = RL_RELEASE;
         if (node != RL_NULL)
         {
             ept = (struct rpmsg_lite_endpoint *)node->data;
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+            ept->rx_msgs++;
+            ept->rx_bytes += rpmsg_msg->hdr.len;
+            rpmsg_lite_stats_hist(rpmsg_lite_dev->stats.rx_latency_hist,
+                                  (unsigned long)(env_get_timestamp() - rpmsg_lite_dev->rx_notify_ts));
+#endif
             cb_ret = ept->rx_cb(rpmsg_msg->data, rpmsg_msg->hdr.len, rpmsg_msg->hdr.src, ept->rx_cb_data);
         }
+#if defined(RL_USE_STATS_EPT) && (RL_USE_STATS_EPT == 1)
+        else if (rpmsg_msg->hdr.dst == RL_STATS_EPT_ADDR)
+        {
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+            /* Statistics request, the worker runs in task context and answers it right away */
+            rpmsg_lite_stats_ept_reply(rpmsg_lite_dev, rpmsg_msg->hdr.src);
+#else
+            /* Statistics request, answered from task context by rpmsg_lite_stats_ept_poll() */
+            rpmsg_lite_dev->stats_req_src = rpmsg_msg->hdr.src;
+            rpmsg_lite_dev->stats_req = 1;
+#endif
+        }
+#endif /* RL_USE_STATS_EPT */
+        else
+        {
+            RL_STATS_INC(rpmsg_lite_dev, rx_no_ept);
+        }
 
         if (cb_ret == RL_HOLD)
         {
             rsvd = (struct rpmsg_hdr_reserved *)&rpmsg_msg->hdr.reserved;
             rsvd->idx = idx;
+            /* Do not leave a dirty line in the buffer, its eviction would overwrite
+             * what the other side writes once the buffer is released */
+            RL_CACHE_FLUSH(rpmsg_msg, sizeof(struct rpmsg_std_hdr));
+            RL_CACHE_INVALIDATE(rpmsg_msg, sizeof(struct rpmsg_std_hdr));
+            RL_STATS_INC(rpmsg_lite_dev, rx_held);
+            RL_STATS_MAX(rpmsg_lite_dev, rx_held_max, rpmsg_lite_dev->stats.rx_held);
         }
         else
         {
+            env_lock_mutex(rpmsg_lite_dev->lock);
             rpmsg_lite_dev->vq_ops->vq_rx_free(rpmsg_lite_dev->rvq, rpmsg_msg, len, idx);
+            env_unlock_mutex(rpmsg_lite_dev->lock);
+#if defined(RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION) && (RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION == 1)
+            released++;
+#endif
         }
-        rpmsg_msg = (struct rpmsg_std_msg *)rpmsg_lite_dev->vq_ops->vq_rx(rpmsg_lite_dev->rvq, &len, &idx);
+        count++;
     }
+
+#if defined(RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION) && (RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION == 1)
+    if (released)
+    {
+        rpmsg_lite_notify_consumed(rpmsg_lite_dev);
+    }
+#endif
+
+    return count;
 }
 
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+/*!
+ * @brief
+ * Called when remote side calls virtqueue_kick()
+ * at its transmit virtqueue.
+ * In this callback, further rvq notifications are masked
+ * and the rx worker task is woken up to read out the buffers.
+ *
+ * @param vq  Virtqueue affected by the kick
+ *
+ */
+static void rpmsg_lite_rx_callback(struct virtqueue *vq)
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)vq->priv;
+
+    RL_ASSERT(rpmsg_lite_dev != NULL);
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    rpmsg_lite_dev->rx_notify_ts = env_get_timestamp();
+#endif
+    rpmsg_lite_dev->vq_ops->vq_rx_disable_cb(rpmsg_lite_dev->rvq);
+    env_release_sync_lock(rpmsg_lite_dev->rx_event);
+}
+
+/*!
+ * @brief
+ * RX worker task, processes the rvq in batches of RL_RX_WORKER_BATCH_SIZE
+ * buffers. Once the rvq is empty, notifications are enabled again and the
+ * rvq is re-checked, for buffers queued by the remote side while
+ * notifications were masked.
+ *
+ * When rx_stop is set, the worker signals rx_exit and deletes itself
+ * without touching the instance again.
+ *
+ * @param arg  RPMsg Lite instance
+ *
+ */
+static void rpmsg_lite_rx_worker(void *arg)
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)arg;
+    unsigned int count;
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    unsigned int total;
+#endif
+
+    for (;;)
+    {
+        env_acquire_sync_lock(rpmsg_lite_dev->rx_event);
+        if (rpmsg_lite_dev->rx_stop)
+        {
+            break;
+        }
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+        total = 0;
+#endif
+
+        while (!rpmsg_lite_dev->rx_stop)
+        {
+            do
+            {
+                count = rpmsg_lite_rx_drain(rpmsg_lite_dev, RL_RX_WORKER_BATCH_SIZE);
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+                total += count;
+#endif
+                if (count == RL_RX_WORKER_BATCH_SIZE)
+                {
+                    /* give other tasks of the same priority a chance to run between batches */
+                    env_sleep_msec(0);
+                }
+            } while ((count == RL_RX_WORKER_BATCH_SIZE) && !rpmsg_lite_dev->rx_stop);
+
+            /* unmask notifications, then re-check for buffers queued in the meantime */
+            if (!rpmsg_lite_dev->vq_ops->vq_rx_enable_cb(rpmsg_lite_dev->rvq))
+            {
+                break;
+            }
+            rpmsg_lite_dev->vq_ops->vq_rx_disable_cb(rpmsg_lite_dev->rvq);
+        }
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+        rpmsg_lite_stats_rx_batch(rpmsg_lite_dev, total);
+#endif
+    }
+
+    env_release_sync_lock(rpmsg_lite_dev->rx_exit);
+    env_delete_task(RL_NULL);
+}
+
+/*!
+ * @brief
+ * Creates the rx worker task and the sync lock it waits on.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param link_id           Link ID of the instance
+ *
+ * @return  Status of function execution, RL_SUCCESS on success
+ *
+ */
+static int rpmsg_lite_rx_worker_init(struct rpmsg_lite_instance *rpmsg_lite_dev, int link_id)
+{
+    int status;
+
+    rpmsg_lite_dev->rx_stop = 0;
+    status = env_create_sync_lock(&rpmsg_lite_dev->rx_event, LOCKED);
+    if (status != RL_SUCCESS)
+    {
+        return status;
+    }
+
+    status = env_create_sync_lock(&rpmsg_lite_dev->rx_exit, LOCKED);
+    if (status != RL_SUCCESS)
+    {
+        env_delete_sync_lock(rpmsg_lite_dev->rx_event);
+        return status;
+    }
+
+    status = env_create_task(&rpmsg_lite_dev->rx_task, rpmsg_lite_rx_worker, "rpmsg rx", RL_RX_WORKER_STACK_SIZE,
+                             RL_RX_WORKER_LINK_PRIORITY(link_id), rpmsg_lite_dev);
+    if (status != RL_SUCCESS)
+    {
+        env_delete_sync_lock(rpmsg_lite_dev->rx_exit);
+        env_delete_sync_lock(rpmsg_lite_dev->rx_event);
+        return status;
+    }
+
+    return RL_SUCCESS;
+}
+
+/*!
+ * @brief
+ * Stops the rx worker task and deletes its sync locks.
+ * Interrupts have to be deinitialized before.
+ *
+ * The worker is not deleted from here, since it may be in the middle of
+ * a drain, holding the instance lock or running an endpoint callback.
+ * It is asked to stop and waited for, then it deletes itself.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ *
+ */
+static void rpmsg_lite_rx_worker_deinit(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    rpmsg_lite_dev->rx_stop = 1;
+    env_release_sync_lock(rpmsg_lite_dev->rx_event);
+    env_acquire_sync_lock(rpmsg_lite_dev->rx_exit);
+
+    env_delete_sync_lock(rpmsg_lite_dev->rx_exit);
+    env_delete_sync_lock(rpmsg_lite_dev->rx_event);
+}
+#else
+/*!
+ * @brief
+ * Called when remote side calls virtqueue_kick()
+ * at its transmit virtqueue.
+ * In this callback, the buffer is read-out
+ * of the rvq and user callback is called.
+ *
+ * @param vq  Virtqueue affected by the kick
+ *
+ */
+static void rpmsg_lite_rx_callback(struct virtqueue *vq)
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)vq->priv;
+
+    RL_ASSERT(rpmsg_lite_dev != NULL);
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    rpmsg_lite_dev->rx_notify_ts = env_get_timestamp();
+    rpmsg_lite_stats_rx_batch(rpmsg_lite_dev, rpmsg_lite_rx_drain(rpmsg_lite_dev, 0xFFFFFFFFU));
+#else
+    (void)rpmsg_lite_rx_drain(rpmsg_lite_dev, 0xFFFFFFFFU);
+#endif
+}
+#endif /* RL_USE_RX_WORKER */
+
 /*!
  * @brief
  * Called when remote side calls virtqueue_kick()
@@ -199,6 +581,108 @@ static void rpmsg_lite_tx_callback(struct virtqueue *vq)
 
     RL_ASSERT(rpmsg_lite_dev != NULL);
     rpmsg_lite_dev->link_state = 1;
+
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    /* Remote side returned tx buffers, wake up one blocked sender */
+    if (rpmsg_lite_dev->tx_waiters)
+    {
+        env_release_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+    }
+#endif
+}
+
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+/*!
+ * @brief
+ * Writes back the rpmsg header and payload of a message
+ * before it is passed to the other side.
+ *
+ * @param buffer  Buffer holding the message
+ *
+ */
+static void rpmsg_lite_cache_flush_msg(void *buffer)
+{
+    struct rpmsg_std_msg *rpmsg_msg = (struct rpmsg_std_msg *)buffer;
+
+    RL_CACHE_FLUSH(rpmsg_msg, sizeof(struct rpmsg_std_hdr) + rpmsg_msg->hdr.len);
+}
+
+/*!
+ * @brief
+ * Discards stale cache lines of a message received from the other side,
+ * the header first, then as much payload as the header announces.
+ *
+ * @param buffer  Buffer holding the message
+ * @param len     Size of the buffer
+ *
+ */
+static void rpmsg_lite_cache_invalidate_msg(void *buffer, unsigned long len)
+{
+    struct rpmsg_std_msg *rpmsg_msg = (struct rpmsg_std_msg *)buffer;
+    unsigned long payload_len;
+
+    RL_CACHE_INVALIDATE(rpmsg_msg, sizeof(struct rpmsg_std_hdr));
+    payload_len = rpmsg_msg->hdr.len;
+    if (payload_len > len - sizeof(struct rpmsg_std_hdr))
+    {
+        payload_len = len - sizeof(struct rpmsg_std_hdr);
+    }
+    RL_CACHE_INVALIDATE(rpmsg_msg->data, payload_len);
+}
+#endif /* RL_USE_CACHED_SHMEM */
+
+/*!
+ * @brief
+ * Keeps a tx buffer allocated but not sent for the next allocation.
+ * The buffers are chained through the reserved field of their header.
+ *
+ * @param tvq     Tx virtqueue of the instance
+ * @param buffer  Buffer pointer
+ * @param idx     Buffer index
+ *
+ */
+static void rpmsg_lite_tx_spare_put(struct virtqueue *tvq, void *buffer, unsigned short idx)
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)tvq->priv;
+    struct rpmsg_std_msg *rpmsg_msg = (struct rpmsg_std_msg *)buffer;
+    struct rpmsg_hdr_reserved reserved;
+
+    /* The header is packed, go through a local copy to avoid unaligned accesses */
+    env_memcpy(&reserved, &rpmsg_msg->hdr.reserved, sizeof(reserved));
+    reserved.rfu = rpmsg_lite_dev->tx_spare;
+    env_memcpy(&rpmsg_msg->hdr.reserved, &reserved, sizeof(reserved));
+    rpmsg_lite_dev->tx_spare = idx + 1;
+}
+
+/*!
+ * @brief
+ * Takes back a tx buffer kept by rpmsg_lite_tx_spare_put(), if any.
+ *
+ * @param tvq     Tx virtqueue of the instance
+ * @param len     Length of returned buffer
+ * @param idx     Buffer index
+ *
+ * @return Buffer pointer or RL_NULL
+ *
+ */
+static void *rpmsg_lite_tx_spare_get(struct virtqueue *tvq, unsigned long *len, unsigned short *idx)
+{
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)tvq->priv;
+    struct rpmsg_std_msg *rpmsg_msg;
+    struct rpmsg_hdr_reserved reserved;
+
+    if (!rpmsg_lite_dev->tx_spare)
+    {
+        return RL_NULL;
+    }
+
+    *idx = rpmsg_lite_dev->tx_spare - 1;
+    *len = virtqueue_get_buffer_length(tvq, *idx);
+    rpmsg_msg = (struct rpmsg_std_msg *)virtqueue_get_buffer_addr(tvq, *idx);
+    env_memcpy(&reserved, &rpmsg_msg->hdr.reserved, sizeof(reserved));
+    rpmsg_lite_dev->tx_spare = reserved.rfu;
+
+    return rpmsg_msg;
 }
 
 /****************************************************************************
@@ -226,6 +710,9 @@ static void rpmsg_lite_tx_callback(struct virtqueue *vq)
 static void vq_tx_remote(struct virtqueue *tvq, void *buffer, unsigned long len, unsigned short idx)
 {
     int status;
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    rpmsg_lite_cache_flush_msg(buffer);
+#endif
     status = virtqueue_add_consumed_buffer(tvq, idx, len);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
 
@@ -234,19 +721,43 @@ static void vq_tx_remote(struct virtqueue *tvq, void *buffer, unsigned long len,
      * This condition is always met, so we don't need to return anything here */
 }
 
+/*!
+ * @brief
+ * Keeps a tx buffer that is not going to be sent for the next allocation.
+ *
+ * @param vq      Virtqueue to use
+ * @param buffer  Buffer pointer
+ * @param idx     Buffer index
+ *
+ */
+static void vq_tx_free_remote(struct virtqueue *tvq, void *buffer, unsigned short idx)
+{
+    rpmsg_lite_tx_spare_put(tvq, buffer, idx);
+}
+
 /*!
  * @brief
  * Provides buffer to transmit messages.
  *
  * @param vq      Virtqueue to use
+ * @param size    Required buffer length, unused, remote buffers have fixed size
  * @param len     Length of returned buffer
  * @param idx     Buffer index
  *
  * return Pointer to buffer.
  */
-static void *vq_tx_alloc_remote(struct virtqueue *tvq, unsigned long *len, unsigned short *idx)
+static void *vq_tx_alloc_remote(struct virtqueue *tvq, unsigned long size, unsigned long *len, unsigned short *idx)
 {
-    return virtqueue_get_available_buffer(tvq, idx, (uint32_t *)len);
+    void *buffer = rpmsg_lite_tx_spare_get(tvq, len, idx);
+    uint32_t buff_len;
+
+    if (buffer)
+    {
+        return buffer;
+    }
+    buffer = virtqueue_get_available_buffer(tvq, idx, &buff_len);
+    *len = buff_len;
+    return buffer;
 }
 
 /*!
@@ -262,7 +773,17 @@ static void *vq_tx_alloc_remote(struct virtqueue *tvq, unsigned long *len, unsig
  */
 static void *vq_rx_remote(struct virtqueue *rvq, unsigned long *len, unsigned short *idx)
 {
-    return virtqueue_get_available_buffer(rvq, idx, (uint32_t *)len);
+    uint32_t buff_len;
+    void *buffer = virtqueue_get_available_buffer(rvq, idx, &buff_len);
+
+    *len = buff_len;
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    if (buffer)
+    {
+        rpmsg_lite_cache_invalidate_msg(buffer, *len);
+    }
+#endif
+    return buffer;
 }
 
 /*!
@@ -279,6 +800,7 @@ static void vq_rx_free_remote(struct virtqueue *rvq, void *buffer, unsigned long
     int status;
 #if defined(RL_CLEAR_USED_BUFFERS) && (RL_CLEAR_USED_BUFFERS == 1)
     env_memset(buffer, 0x00, len);
+    RL_CACHE_FLUSH(buffer, len);
 #endif
     status = virtqueue_add_consumed_buffer(rvq, idx, len);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
@@ -313,6 +835,9 @@ static void vq_rx_free_remote(struct virtqueue *rvq, void *buffer, unsigned long
 static void vq_tx_master(struct virtqueue *tvq, void *buffer, unsigned long len, unsigned short idx)
 {
     int status;
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    rpmsg_lite_cache_flush_msg(buffer);
+#endif
     status = virtqueue_add_buffer(tvq, idx);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
 
@@ -321,19 +846,88 @@ static void vq_tx_master(struct virtqueue *tvq, void *buffer, unsigned long len,
      * This condition is always met, so we don't need to return anything here */
 }
 
+/*!
+ * @brief
+ * Returns a tx buffer that is not going to be sent to the free buffers.
+ *
+ * With RL_USE_BUFFER_CLASSES, the buffer goes to the free list of its class.
+ *
+ * @param vq      Virtqueue to use
+ * @param buffer  Buffer pointer
+ * @param idx     Buffer index
+ *
+ */
+static void vq_tx_free_master(struct virtqueue *tvq, void *buffer, unsigned short idx)
+{
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)tvq->priv;
+    unsigned long len = virtqueue_get_buffer_length(tvq, idx);
+    int c;
+
+    for (c = 0; (c < RL_BUFFER_CLASSES - 1) && (rl_buffer_class_size[c] < len); c++)
+    {
+    }
+    rpmsg_lite_dev->tx_free_next[idx] = rpmsg_lite_dev->tx_free_head[c];
+    rpmsg_lite_dev->tx_free_head[c] = idx;
+#else
+    rpmsg_lite_tx_spare_put(tvq, buffer, idx);
+#endif /* RL_USE_BUFFER_CLASSES */
+}
+
 /*!
  * @brief
  * Provides buffer to transmit messages.
  *
+ * With RL_USE_BUFFER_CLASSES, buffers returned by the remote side
+ * are sorted into per-class free lists first and the smallest free
+ * buffer of at least size bytes is returned.
+ *
  * @param vq      Virtqueue to use
+ * @param size    Required buffer length, including the rpmsg header
  * @param len     Length of returned buffer
  * @param idx     Buffer index
  *
  * return Pointer to buffer.
  */
-static void *vq_tx_alloc_master(struct virtqueue *tvq, unsigned long *len, unsigned short *idx)
+static void *vq_tx_alloc_master(struct virtqueue *tvq, unsigned long size, unsigned long *len, unsigned short *idx)
 {
-    return virtqueue_get_buffer(tvq, (uint32_t *)len, idx);
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    struct rpmsg_lite_instance *rpmsg_lite_dev = (struct rpmsg_lite_instance *)tvq->priv;
+    uint32_t used_len;
+    unsigned short i;
+    int c;
+
+    /* Sort the buffers returned by the other side into their classes */
+    while (virtqueue_get_buffer(tvq, &used_len, &i))
+    {
+        vq_tx_free_master(tvq, RL_NULL, i);
+    }
+
+    for (c = 0; c < RL_BUFFER_CLASSES; c++)
+    {
+        if ((rl_buffer_class_size[c] >= size) && (rpmsg_lite_dev->tx_free_head[c] != RL_BUFFER_CLASS_NONE))
+        {
+            i = rpmsg_lite_dev->tx_free_head[c];
+            rpmsg_lite_dev->tx_free_head[c] = rpmsg_lite_dev->tx_free_next[i];
+            *idx = i;
+            *len = virtqueue_get_buffer_length(tvq, i);
+            return virtqueue_get_buffer_addr(tvq, i);
+        }
+    }
+
+    return RL_NULL;
+#else
+    void *buffer = rpmsg_lite_tx_spare_get(tvq, len, idx);
+    uint32_t buff_len;
+
+    if (buffer)
+    {
+        return buffer;
+    }
+    buffer = virtqueue_get_buffer(tvq, &buff_len, idx);
+    *len = buff_len;
+    return buffer;
+#endif /* RL_USE_BUFFER_CLASSES */
 }
 
 /*!
@@ -349,7 +943,17 @@ static void *vq_tx_alloc_master(struct virtqueue *tvq, unsigned long *len, unsig
  */
 static void *vq_rx_master(struct virtqueue *rvq, unsigned long *len, unsigned short *idx)
 {
-    return virtqueue_get_buffer(rvq, (uint32_t *)len, idx);
+    uint32_t buff_len;
+    void *buffer = virtqueue_get_buffer(rvq, &buff_len, idx);
+
+    *len = buff_len;
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    if (buffer)
+    {
+        rpmsg_lite_cache_invalidate_msg(buffer, virtqueue_get_buffer_length(rvq, *idx));
+    }
+#endif
+    return buffer;
 }
 
 /*!
@@ -366,6 +970,7 @@ static void vq_rx_free_master(struct virtqueue *rvq, void *buffer, unsigned long
     int status;
 #if defined(RL_CLEAR_USED_BUFFERS) && (RL_CLEAR_USED_BUFFERS == 1)
     env_memset(buffer, 0x00, len);
+    RL_CACHE_FLUSH(buffer, len);
 #endif
     status = virtqueue_add_buffer(rvq, idx);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
@@ -377,12 +982,14 @@ static void vq_rx_free_master(struct virtqueue *rvq, void *buffer, unsigned long
 
 /* Interface used in case this processor is MASTER */
 static const struct virtqueue_ops master_vq_ops = {
-    vq_tx_master, vq_tx_alloc_master, vq_rx_master, vq_rx_free_master,
+    vq_tx_master, vq_tx_alloc_master, vq_rx_master, vq_rx_free_master, virtqueue_disable_cb, virtqueue_enable_cb,
+    vq_tx_free_master,
 };
 
 /* Interface used in case this processor is REMOTE */
 static const struct virtqueue_ops remote_vq_ops = {
-    vq_tx_remote, vq_tx_alloc_remote, vq_rx_remote, vq_rx_free_remote,
+    vq_tx_remote, vq_tx_alloc_remote, vq_rx_remote, vq_rx_free_remote, virtqueue_disable_kick, virtqueue_enable_kick,
+    vq_tx_free_remote,
 };
 
 /* helper function for virtqueue notification */
@@ -485,7 +1092,7 @@ struct rpmsg_lite_endpoint *rpmsg_lite_create_ept(struct rpmsg_lite_instance *rp
 
         node->data = rl_ept;
 
-        add_to_list((struct llist **)&rpmsg_lite_dev->rl_endpoints, node);
+        add_to_list(RL_EPT_LUT_HEAD(rpmsg_lite_dev, addr), node);
     }
     env_unlock_mutex(rpmsg_lite_dev->lock);
 
@@ -519,7 +1126,7 @@ int rpmsg_lite_destroy_ept(struct rpmsg_lite_instance *rpmsg_lite_dev, struct rp
     node = rpmsg_lite_get_endpoint_from_addr(rpmsg_lite_dev, rl_ept->addr);
     if (node)
     {
-        remove_from_list((struct llist **)&rpmsg_lite_dev->rl_endpoints, node);
+        remove_from_list(RL_EPT_LUT_HEAD(rpmsg_lite_dev, rl_ept->addr), node);
         env_unlock_mutex(rpmsg_lite_dev->lock);
 #if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
         env_free_memory(node);
@@ -534,24 +1141,238 @@ int rpmsg_lite_destroy_ept(struct rpmsg_lite_instance *rpmsg_lite_dev, struct rp
     }
 }
 
-/******************************************
+/******************************************
+
+mmmmmmm m    m          mm   mmmmm  mmmmm
+   #     #  #           ##   #   "#   #
+   #      ##           #  #  #mmm#"   #
+   #     m""m          #mm#  #        #
+   #    m"  "m        #    # #      mm#mm
+
+*******************************************/
+
+int rpmsg_lite_is_link_up(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    if (!rpmsg_lite_dev)
+    {
+        return 0;
+    }
+
+    return rpmsg_lite_dev->link_state;
+}
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+/*!
+ * @brief
+ * Copies the statistics, under the instance lock and with interrupts
+ * masked, so that neither a task nor the rvq interrupt updates them
+ * in the middle of the copy.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param stats             Destination of the statistics
+ *
+ */
+static void rpmsg_lite_stats_snapshot(struct rpmsg_lite_instance *rpmsg_lite_dev, struct rpmsg_lite_stats *stats)
+{
+    unsigned int state;
+
+    env_lock_mutex(rpmsg_lite_dev->lock);
+    state = platform_global_isr_disable();
+    env_memcpy(stats, &rpmsg_lite_dev->stats, sizeof(struct rpmsg_lite_stats));
+    platform_global_isr_restore(state);
+    env_unlock_mutex(rpmsg_lite_dev->lock);
+}
+
+int rpmsg_lite_get_stats(struct rpmsg_lite_instance *rpmsg_lite_dev, struct rpmsg_lite_stats *stats)
+{
+    if (!rpmsg_lite_dev || !stats)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    rpmsg_lite_stats_snapshot(rpmsg_lite_dev, stats);
+
+    return RL_SUCCESS;
+}
+
+int rpmsg_lite_reset_stats(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    uint32_t rx_held;
+
+    if (!rpmsg_lite_dev)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    env_lock_mutex(rpmsg_lite_dev->lock);
+    rx_held = rpmsg_lite_dev->stats.rx_held;
+    env_memset(&rpmsg_lite_dev->stats, 0, sizeof(struct rpmsg_lite_stats));
+    rpmsg_lite_dev->stats.rx_held = rx_held;
+    rpmsg_lite_dev->stats.rx_held_max = rx_held;
+    env_unlock_mutex(rpmsg_lite_dev->lock);
+
+    return RL_SUCCESS;
+}
+
+#if defined(RL_USE_STATS_EPT) && (RL_USE_STATS_EPT == 1)
+/*!
+ * @brief
+ * Answers a statistics request with a snapshot of the statistics,
+ * if a tx buffer is at hand. Must be called from task context.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param dst               Address the request came from
+ *
+ */
+static void rpmsg_lite_stats_ept_reply(struct rpmsg_lite_instance *rpmsg_lite_dev, unsigned long dst)
+{
+    struct rpmsg_lite_stats stats;
+
+    rpmsg_lite_stats_snapshot(rpmsg_lite_dev, &stats);
+    (void)rpmsg_lite_format_message(rpmsg_lite_dev, RL_STATS_EPT_ADDR, dst, (char *)&stats,
+                                    sizeof(struct rpmsg_lite_stats), RL_NO_FLAGS, RL_DONT_BLOCK);
+}
+
+int rpmsg_lite_stats_ept_poll(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    unsigned long dst;
+    unsigned int state;
+    int pending;
+
+    if (!rpmsg_lite_dev)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    state = platform_global_isr_disable();
+    pending = rpmsg_lite_dev->stats_req;
+    dst = rpmsg_lite_dev->stats_req_src;
+    rpmsg_lite_dev->stats_req = 0;
+    platform_global_isr_restore(state);
+
+    if (!pending)
+    {
+        return 0;
+    }
+
+    rpmsg_lite_stats_ept_reply(rpmsg_lite_dev, dst);
+
+    return 1;
+}
+#endif /* RL_USE_STATS_EPT */
+#endif /* RL_USE_STATS */
+
+/*!
+ * @brief
+ * Internal function to get a free tx buffer from the tx virtqueue,
+ * waiting up to timeout ms for the remote side to return one.
+ *
+ * With RL_USE_TX_WAIT_EVENT the caller sleeps on the instance tx_wait_lock,
+ * which is released by rpmsg_lite_tx_callback(). Blocked senders are woken
+ * one at a time in the order of the underlying sync lock (highest priority
+ * first, FIFO among equal priorities on FreeRTOS); a sender that got
+ * a buffer after a wakeup passes the wakeup on to the next waiter, since
+ * a single kick may have returned more than one buffer.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ * @param size              Required buffer length, including the rpmsg header
+ * @param len               Length of returned buffer
+ * @param idx               Buffer index
+ * @param timeout           Timeout in ms, 0 if nonblocking
+ *
+ * @return  Buffer pointer or RL_NULL on timeout
+ *
+ */
+static void *rpmsg_lite_get_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                                      unsigned long size,
+                                      unsigned long *len,
+                                      unsigned short *idx,
+                                      unsigned long timeout)
+{
+    void *buffer;
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    int woken;
+    int pass_on;
+#else
+    unsigned long tick_count = 0;
+#endif
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    unsigned long long wait_start;
+    unsigned long wait_time;
+#endif
+
+    /* Lock the device to enable exclusive access to virtqueues */
+    env_lock_mutex(rpmsg_lite_dev->lock);
+    /* Get rpmsg buffer for sending message. */
+    buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, len, idx);
+    env_unlock_mutex(rpmsg_lite_dev->lock);
+
+    if (buffer || !timeout)
+    {
+        return buffer;
+    }
+
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    RL_STATS_INC(rpmsg_lite_dev, tx_alloc_waits);
+    wait_start = env_get_timestamp();
+#endif
+
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    do
+    {
+        /* Register as waiter before checking the vring again, so that
+         * a buffer returned in between is not missed by the tx callback. */
+        env_lock_mutex(rpmsg_lite_dev->lock);
+        rpmsg_lite_dev->tx_waiters++;
+        buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, len, idx);
+        env_unlock_mutex(rpmsg_lite_dev->lock);
+
+        woken = 0;
+        if (!buffer)
+        {
+            woken = env_acquire_sync_lock_timeout(rpmsg_lite_dev->tx_wait_lock, &timeout);
+        }
 
-mmmmmmm m    m          mm   mmmmm  mmmmm
-   #     #  #           ##   #   "#   #
-   #      ##           #  #  #mmm#"   #
-   #     m""m          #mm#  #        #
-   #    m"  "m        #    # #      mm#mm
+        env_lock_mutex(rpmsg_lite_dev->lock);
+        rpmsg_lite_dev->tx_waiters--;
+        if (woken && !buffer)
+        {
+            buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, len, idx);
+        }
+        pass_on = (woken && buffer && rpmsg_lite_dev->tx_waiters);
+        env_unlock_mutex(rpmsg_lite_dev->lock);
 
-*******************************************/
+        if (pass_on)
+        {
+            env_release_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+        }
+    } while (!buffer && woken);
+#else
+    while (!buffer)
+    {
+        env_sleep_msec(RL_MS_PER_INTERVAL);
+        env_lock_mutex(rpmsg_lite_dev->lock);
+        buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, len, idx);
+        env_unlock_mutex(rpmsg_lite_dev->lock);
+        tick_count += RL_MS_PER_INTERVAL;
+        if ((tick_count >= timeout) && (!buffer))
+        {
+            break;
+        }
+    }
+#endif /* RL_USE_TX_WAIT_EVENT */
 
-int rpmsg_lite_is_link_up(struct rpmsg_lite_instance *rpmsg_lite_dev)
-{
-    if (!rpmsg_lite_dev)
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    wait_time = (unsigned long)(env_get_timestamp() - wait_start);
+    rpmsg_lite_stats_hist(rpmsg_lite_dev->stats.tx_alloc_wait_hist, wait_time);
+    RL_STATS_MAX(rpmsg_lite_dev, tx_alloc_wait_max, wait_time);
+    if (!buffer)
     {
-        return 0;
+        RL_STATS_INC(rpmsg_lite_dev, tx_alloc_timeouts);
     }
+#endif
 
-    return rpmsg_lite_dev->link_state;
+    return buffer;
 }
 
 /*!
@@ -581,7 +1402,6 @@ int rpmsg_lite_format_message(struct rpmsg_lite_instance *rpmsg_lite_dev,
     struct rpmsg_std_msg *rpmsg_msg;
     void *buffer;
     unsigned short idx;
-    unsigned long tick_count = 0;
     unsigned long buff_len;
 
     if (!rpmsg_lite_dev)
@@ -599,30 +1419,12 @@ int rpmsg_lite_format_message(struct rpmsg_lite_instance *rpmsg_lite_dev,
         return RL_NOT_READY;
     }
 
-    /* Lock the device to enable exclusive access to virtqueues */
-    env_lock_mutex(rpmsg_lite_dev->lock);
-    /* Get rpmsg buffer for sending message. */
-    buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, &buff_len, &idx);
-    env_unlock_mutex(rpmsg_lite_dev->lock);
-
-    if (!buffer && !timeout)
+    buffer = rpmsg_lite_get_tx_buffer(rpmsg_lite_dev, sizeof(struct rpmsg_std_hdr) + size, &buff_len, &idx, timeout);
+    if (!buffer)
     {
         return RL_ERR_NO_MEM;
     }
 
-    while (!buffer)
-    {
-        env_sleep_msec(RL_MS_PER_INTERVAL);
-        env_lock_mutex(rpmsg_lite_dev->lock);
-        buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, &buff_len, &idx);
-        env_unlock_mutex(rpmsg_lite_dev->lock);
-        tick_count += RL_MS_PER_INTERVAL;
-        if ((tick_count >= timeout) && (!buffer))
-        {
-            return RL_ERR_NO_MEM;
-        }
-    }
-
     rpmsg_msg = (struct rpmsg_std_msg *)buffer;
 
     /* Initialize RPMSG header. */
@@ -637,8 +1439,10 @@ int rpmsg_lite_format_message(struct rpmsg_lite_instance *rpmsg_lite_dev,
     env_lock_mutex(rpmsg_lite_dev->lock);
     /* Enqueue buffer on virtqueue. */
     rpmsg_lite_dev->vq_ops->vq_tx(rpmsg_lite_dev->tvq, buffer, buff_len, idx);
+    RL_STATS_INC(rpmsg_lite_dev, tx_msgs);
+    RL_STATS_ADD(rpmsg_lite_dev, tx_bytes, size);
     /* Let the other side know that there is a job to process. */
-    virtqueue_kick(rpmsg_lite_dev->tvq);
+    rpmsg_lite_kick(rpmsg_lite_dev, rpmsg_lite_dev->tvq);
     env_unlock_mutex(rpmsg_lite_dev->lock);
 
     return RL_SUCCESS;
@@ -651,13 +1455,13 @@ int rpmsg_lite_send(struct rpmsg_lite_instance *rpmsg_lite_dev,
                     unsigned long size,
                     unsigned long timeout)
 {
-    if (!ept)
+    if (!rpmsg_lite_dev || !ept)
     {
         return RL_ERR_PARAM;
     }
 
     // FIXME : may be just copy the data size equal to buffer length and Tx it.
-    if (size > RL_BUFFER_PAYLOAD_SIZE)
+    if (size > RL_TX_PAYLOAD_MAX(rpmsg_lite_dev))
     {
         return RL_ERR_BUFF_SIZE;
     }
@@ -665,6 +1469,111 @@ int rpmsg_lite_send(struct rpmsg_lite_instance *rpmsg_lite_dev,
     return rpmsg_lite_format_message(rpmsg_lite_dev, ept->addr, dst, data, size, RL_NO_FLAGS, timeout);
 }
 
+int rpmsg_lite_send_batch(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                          struct rpmsg_lite_endpoint *ept,
+                          unsigned long dst,
+                          char **data,
+                          unsigned long *size,
+                          unsigned long count,
+                          unsigned long timeout)
+{
+    struct rpmsg_std_msg *rpmsg_msg;
+    void *buffer;
+    unsigned short idx;
+    unsigned long buff_len;
+    unsigned long i;
+    unsigned long pending = 0;
+
+    if (!rpmsg_lite_dev || !ept || !data || !size)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (!data[i])
+        {
+            return RL_ERR_PARAM;
+        }
+        if (size[i] > RL_TX_PAYLOAD_MAX(rpmsg_lite_dev))
+        {
+            return RL_ERR_BUFF_SIZE;
+        }
+    }
+
+    if (!rpmsg_lite_dev->link_state)
+    {
+        return RL_NOT_READY;
+    }
+
+    i = 0;
+    buffer = RL_NULL;
+    while (i < count)
+    {
+        /* Queue as many messages as there are free tx buffers under a single lock,
+         * starting with the one a previous round waited for, then notify once. */
+        env_lock_mutex(rpmsg_lite_dev->lock);
+        for (; i < count; i++)
+        {
+            if (!buffer)
+            {
+                buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq,
+                                                             sizeof(struct rpmsg_std_hdr) + size[i], &buff_len, &idx);
+                if (!buffer)
+                {
+                    break;
+                }
+            }
+
+            rpmsg_msg = (struct rpmsg_std_msg *)buffer;
+
+            /* Initialize RPMSG header. */
+            rpmsg_msg->hdr.dst = dst;
+            rpmsg_msg->hdr.src = ept->addr;
+            rpmsg_msg->hdr.len = size[i];
+            rpmsg_msg->hdr.flags = RL_NO_FLAGS;
+
+            /* Copy data to rpmsg buffer. */
+            env_memcpy(rpmsg_msg->data, data[i], size[i]);
+
+            /* Enqueue buffer on virtqueue, the other side is notified once for the whole batch. */
+            rpmsg_lite_dev->vq_ops->vq_tx(rpmsg_lite_dev->tvq, buffer, buff_len, idx);
+            RL_STATS_INC(rpmsg_lite_dev, tx_msgs);
+            RL_STATS_ADD(rpmsg_lite_dev, tx_bytes, size[i]);
+            buffer = RL_NULL;
+            pending++;
+        }
+
+        if (pending)
+        {
+            /* Let the other side know that there is a job to process, also before waiting below,
+             * otherwise it may never return the buffers we wait for. */
+            rpmsg_lite_kick(rpmsg_lite_dev, rpmsg_lite_dev->tvq);
+            pending = 0;
+        }
+        env_unlock_mutex(rpmsg_lite_dev->lock);
+
+        if ((i == count) || !timeout)
+        {
+            break;
+        }
+
+        buffer = rpmsg_lite_get_tx_buffer(rpmsg_lite_dev, sizeof(struct rpmsg_std_hdr) + size[i], &buff_len, &idx,
+                                          timeout);
+        if (!buffer)
+        {
+            break;
+        }
+    }
+
+    if (!i && count)
+    {
+        return RL_ERR_NO_MEM;
+    }
+
+    return (int)i;
+}
+
 #if defined(RL_API_HAS_ZEROCOPY) && (RL_API_HAS_ZEROCOPY == 1)
 
 void *rpmsg_lite_alloc_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, unsigned long *size, unsigned long timeout)
@@ -673,7 +1582,6 @@ void *rpmsg_lite_alloc_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, uns
     struct rpmsg_hdr_reserved *reserved = RL_NULL;
     void *buffer;
     unsigned short idx;
-    unsigned int tick_count = 0;
 
     if (!size)
         return NULL;
@@ -684,32 +1592,13 @@ void *rpmsg_lite_alloc_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, uns
         return NULL;
     }
 
-    /* Lock the device to enable exclusive access to virtqueues */
-    env_lock_mutex(rpmsg_lite_dev->lock);
-    /* Get rpmsg buffer for sending message. */
-    buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, &idx);
-    env_unlock_mutex(rpmsg_lite_dev->lock);
-
-    if (!buffer && !timeout)
+    buffer = rpmsg_lite_get_tx_buffer(rpmsg_lite_dev, RL_BUFFER_SIZE, size, &idx, timeout);
+    if (!buffer)
     {
         *size = 0;
         return NULL;
     }
 
-    while (!buffer)
-    {
-        env_sleep_msec(RL_MS_PER_INTERVAL);
-        env_lock_mutex(rpmsg_lite_dev->lock);
-        buffer = rpmsg_lite_dev->vq_ops->vq_tx_alloc(rpmsg_lite_dev->tvq, size, &idx);
-        env_unlock_mutex(rpmsg_lite_dev->lock);
-        tick_count += RL_MS_PER_INTERVAL;
-        if ((tick_count >= timeout) && (!buffer))
-        {
-            *size = 0;
-            return NULL;
-        }
-    }
-
     rpmsg_msg = (struct rpmsg_std_msg *)buffer;
 
     /* keep idx and totlen information for nocopy tx function */
@@ -737,7 +1626,12 @@ int rpmsg_lite_send_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
         return RL_ERR_PARAM;
     }
 
-    if (size > RL_BUFFER_PAYLOAD_SIZE)
+    rpmsg_msg = RPMSG_STD_MSG_FROM_BUF(data);
+    reserved = (struct rpmsg_hdr_reserved *)&rpmsg_msg->hdr.reserved;
+
+    /* The buffer may be smaller than the largest one, with buffer classes */
+    if (size > (unsigned long)virtqueue_get_buffer_length(rpmsg_lite_dev->tvq, reserved->idx) -
+                   sizeof(struct rpmsg_std_hdr))
     {
         return RL_ERR_BUFF_SIZE;
     }
@@ -749,23 +1643,48 @@ int rpmsg_lite_send_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
 
     src = ept->addr;
 
-    rpmsg_msg = RPMSG_STD_MSG_FROM_BUF(data);
-
     /* Initialize RPMSG header. */
     rpmsg_msg->hdr.dst = dst;
     rpmsg_msg->hdr.src = src;
     rpmsg_msg->hdr.len = size;
     rpmsg_msg->hdr.flags = RL_NO_FLAGS;
 
-    reserved = (struct rpmsg_hdr_reserved *)&rpmsg_msg->hdr.reserved;
-
     env_lock_mutex(rpmsg_lite_dev->lock);
     /* Enqueue buffer on virtqueue. */
     rpmsg_lite_dev->vq_ops->vq_tx(rpmsg_lite_dev->tvq, (void *)rpmsg_msg,
                                   (unsigned long)virtqueue_get_buffer_length(rpmsg_lite_dev->tvq, reserved->idx),
                                   reserved->idx);
+    RL_STATS_INC(rpmsg_lite_dev, tx_msgs);
+    RL_STATS_ADD(rpmsg_lite_dev, tx_bytes, size);
     /* Let the other side know that there is a job to process. */
-    virtqueue_kick(rpmsg_lite_dev->tvq);
+    rpmsg_lite_kick(rpmsg_lite_dev, rpmsg_lite_dev->tvq);
+    env_unlock_mutex(rpmsg_lite_dev->lock);
+
+    return RL_SUCCESS;
+}
+
+int rpmsg_lite_release_tx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, void *txbuf)
+{
+    struct rpmsg_std_msg *rpmsg_msg;
+    struct rpmsg_hdr_reserved *reserved = RL_NULL;
+
+    if (!rpmsg_lite_dev || !txbuf)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    rpmsg_msg = RPMSG_STD_MSG_FROM_BUF(txbuf);
+    reserved = (struct rpmsg_hdr_reserved *)&rpmsg_msg->hdr.reserved;
+
+    env_lock_mutex(rpmsg_lite_dev->lock);
+    rpmsg_lite_dev->vq_ops->vq_tx_free(rpmsg_lite_dev->tvq, rpmsg_msg, reserved->idx);
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    /* The buffer is free again, wake up one blocked sender */
+    if (rpmsg_lite_dev->tx_waiters)
+    {
+        env_release_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+    }
+#endif
     env_unlock_mutex(rpmsg_lite_dev->lock);
 
     return RL_SUCCESS;
@@ -800,15 +1719,29 @@ int rpmsg_lite_release_rx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, voi
     /* Get the pointer to the reserved field that contains buffer size and the index */
     reserved = (struct rpmsg_hdr_reserved *)&rpmsg_msg->hdr.reserved;
 
+    /* The header line may have been written to while the buffer was held */
+    RL_CACHE_FLUSH(rpmsg_msg, sizeof(struct rpmsg_std_hdr));
+    RL_CACHE_INVALIDATE(rpmsg_msg, sizeof(struct rpmsg_std_hdr));
+
     env_lock_mutex(rpmsg_lite_dev->lock);
 
     /* Return used buffer, with total length (header length + buffer size). */
     rpmsg_lite_dev->vq_ops->vq_rx_free(rpmsg_lite_dev->rvq, rpmsg_msg,
                                        (unsigned long)virtqueue_get_buffer_length(rpmsg_lite_dev->rvq, reserved->idx),
                                        reserved->idx);
+#if defined(RL_USE_STATS) && (RL_USE_STATS == 1)
+    if (rpmsg_lite_dev->stats.rx_held)
+    {
+        rpmsg_lite_dev->stats.rx_held--;
+    }
+#endif
 
     env_unlock_mutex(rpmsg_lite_dev->lock);
 
+#if defined(RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION) && (RL_ALLOW_CONSUMED_BUFFERS_NOTIFICATION == 1)
+    rpmsg_lite_notify_consumed(rpmsg_lite_dev);
+#endif
+
     return RL_SUCCESS;
 }
 
@@ -823,6 +1756,93 @@ int rpmsg_lite_release_rx_buffer(struct rpmsg_lite_instance *rpmsg_lite_dev, voi
  mm#mm  #   ## mm#mm    #
 
  *****************************/
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+/*!
+ * @brief
+ * Returns the shared memory needed for the tx buffer classes, in bytes,
+ * or 0 if the class configuration is invalid.
+ *
+ * @return  Size of the tx buffers of all classes
+ *
+ */
+static unsigned long rpmsg_lite_buffer_classes_size(void)
+{
+    unsigned long total_size = 0;
+    unsigned long total_count = 0;
+    int std_buffers = 0;
+    int c;
+
+    for (c = 0; c < RL_BUFFER_CLASSES; c++)
+    {
+        if ((rl_buffer_class_size[c] <= sizeof(struct rpmsg_std_hdr)) || (rl_buffer_class_size[c] & 3) ||
+            ((c > 0) && (rl_buffer_class_size[c] <= rl_buffer_class_size[c - 1])))
+        {
+            return 0;
+        }
+        if ((rl_buffer_class_size[c] >= RL_BUFFER_SIZE) && rl_buffer_class_count[c])
+        {
+            std_buffers = 1;
+        }
+        total_size += rl_buffer_class_size[c] * rl_buffer_class_count[c];
+        total_count += rl_buffer_class_count[c];
+    }
+
+    /* One descriptor per buffer, and rpmsg_lite_alloc_tx_buffer() needs RL_BUFFER_SIZE */
+    if ((total_count > RL_BUFFER_COUNT) || (!std_buffers))
+    {
+        return 0;
+    }
+
+    return total_size;
+}
+
+/*!
+ * @brief
+ * Carves the tx buffers of all classes from the shared memory following
+ * the rx buffers and places them on the tx virtqueue as used, so that
+ * the first allocation sorts them into the class free lists.
+ *
+ * @param rpmsg_lite_dev    RPMsg Lite instance
+ *
+ * @return  Status of function execution, RL_SUCCESS on success
+ *
+ */
+static int rpmsg_lite_init_buffer_classes(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    char *buffer;
+    int status;
+    int c, n;
+
+    buffer = rpmsg_lite_dev->sh_mem_base +
+             RL_BUFFER_SIZE * (rpmsg_lite_dev->sh_mem_total - rpmsg_lite_dev->sh_mem_remaining);
+
+    for (c = 0; c < RL_BUFFER_CLASSES; c++)
+    {
+        rpmsg_lite_dev->tx_free_head[c] = RL_BUFFER_CLASS_NONE;
+    }
+
+    for (c = 0; c < RL_BUFFER_CLASSES; c++)
+    {
+        for (n = 0; n < rl_buffer_class_count[c]; n++)
+        {
+            env_memset(buffer, 0x00, rl_buffer_class_size[c]);
+            RL_CACHE_FLUSH(buffer, rl_buffer_class_size[c]);
+            status = virtqueue_fill_used_buffers(rpmsg_lite_dev->tvq, buffer, rl_buffer_class_size[c]);
+            if (status != RL_SUCCESS)
+            {
+                return status;
+            }
+            buffer += rl_buffer_class_size[c];
+            rpmsg_lite_dev->tx_payload_max = rl_buffer_class_size[c] - sizeof(struct rpmsg_std_hdr);
+        }
+    }
+
+    rpmsg_lite_dev->sh_mem_remaining = 0;
+
+    return RL_SUCCESS;
+}
+#endif /* RL_USE_BUFFER_CLASSES */
+
 #if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
 struct rpmsg_lite_instance *rpmsg_lite_master_init(
     void *shmem_addr, size_t shmem_length, int link_id, uint32_t init_flags, struct rpmsg_lite_instance *static_context)
@@ -841,11 +1861,21 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
     void *buffer;
     int idx, j;
     struct rpmsg_lite_instance *rpmsg_lite_dev = NULL;
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    unsigned long classes_size = rpmsg_lite_buffer_classes_size();
+
+    if ((!classes_size) ||
+        ((RL_BUFFER_COUNT * RL_BUFFER_SIZE + classes_size) > RL_WORD_ALIGN_DOWN(shmem_length - RL_VRING_OVERHEAD)))
+    {
+        return NULL;
+    }
+#else
 
     if ((2 * RL_BUFFER_COUNT) > ((RL_WORD_ALIGN_DOWN(shmem_length - RL_VRING_OVERHEAD)) / RL_BUFFER_SIZE))
     {
         return NULL;
     }
+#endif /* RL_USE_BUFFER_CLASSES */
 
     if (link_id > RL_PLATFORM_HIGHEST_LINK_ID)
     {
@@ -905,6 +1935,7 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
         ring_info.num_descs = RL_BUFFER_COUNT;
 
         env_memset((void *)ring_info.phy_addr, 0x00, vring_size(ring_info.num_descs, ring_info.align));
+        RL_CACHE_FLUSH(ring_info.phy_addr, vring_size(ring_info.num_descs, ring_info.align));
 
 #if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
         status = virtqueue_create_static(RL_GET_VQ_ID(link_id, idx), (char *)vq_names[idx], &ring_info, callback[idx],
@@ -946,11 +1977,23 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
         return NULL;
     }
 
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    status = env_create_sync_lock(&rpmsg_lite_dev->tx_wait_lock, LOCKED);
+    if (status != RL_SUCCESS)
+    {
+        env_delete_mutex(rpmsg_lite_dev->lock);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+        env_free_memory(rpmsg_lite_dev);
+#endif
+        return NULL;
+    }
+#endif
+
     // FIXME - a better way to handle this , tx for master is rx for remote and vice versa.
     rpmsg_lite_dev->tvq = vqs[1];
     rpmsg_lite_dev->rvq = vqs[0];
 
-    for (j = 0; j < 2; j++)
+    for (j = 0; j < RL_MASTER_UNIFORM_VQS; j++)
     {
         for (idx = 0; ((idx < vqs[j]->vq_nentries) && (idx < rpmsg_lite_dev->sh_mem_total)); idx++)
         {
@@ -963,6 +2006,7 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
             RL_ASSERT(buffer);
 
             env_memset(buffer, 0x00, RL_BUFFER_SIZE);
+            RL_CACHE_FLUSH(buffer, RL_BUFFER_SIZE);
             if (vqs[j] == rpmsg_lite_dev->rvq)
             {
                 status = virtqueue_fill_avail_buffers(vqs[j], buffer, RL_BUFFER_SIZE);
@@ -979,15 +2023,48 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
             if (status != RL_SUCCESS)
             {
 /* Clean up! */
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+                env_delete_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+#endif
+                env_delete_mutex(rpmsg_lite_dev->lock);
 #if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
                 env_free_memory(rpmsg_lite_dev);
 #endif
-                env_delete_mutex(rpmsg_lite_dev->lock);
                 return NULL;
             }
         }
     }
 
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    status = rpmsg_lite_init_buffer_classes(rpmsg_lite_dev);
+    if (status != RL_SUCCESS)
+    {
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+        env_delete_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+#endif
+        env_delete_mutex(rpmsg_lite_dev->lock);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+        env_free_memory(rpmsg_lite_dev);
+#endif
+        return NULL;
+    }
+#endif /* RL_USE_BUFFER_CLASSES */
+
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+    status = rpmsg_lite_rx_worker_init(rpmsg_lite_dev, link_id);
+    if (status != RL_SUCCESS)
+    {
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+        env_delete_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+#endif
+        env_delete_mutex(rpmsg_lite_dev->lock);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+        env_free_memory(rpmsg_lite_dev);
+#endif
+        return NULL;
+    }
+#endif /* RL_USE_RX_WORKER */
+
     /* Install ISRs */
     platform_init_interrupt(rpmsg_lite_dev->rvq->vq_queue_index, rpmsg_lite_dev->rvq);
     platform_init_interrupt(rpmsg_lite_dev->tvq->vq_queue_index, rpmsg_lite_dev->tvq);
@@ -1001,7 +2078,7 @@ struct rpmsg_lite_instance *rpmsg_lite_master_init(void *shmem_addr,
      * Let the remote device know that Master is ready for
      * communication.
      */
-    virtqueue_kick(rpmsg_lite_dev->rvq);
+    rpmsg_lite_kick(rpmsg_lite_dev, rpmsg_lite_dev->rvq);
 
     return rpmsg_lite_dev;
 }
@@ -1063,6 +2140,10 @@ struct rpmsg_lite_instance *rpmsg_lite_remote_init(void *shmem_addr, int link_id
     callback[0] = rpmsg_lite_tx_callback;
     callback[1] = rpmsg_lite_rx_callback;
     rpmsg_lite_dev->vq_ops = &remote_vq_ops;
+#if defined(RL_USE_BUFFER_CLASSES) && (RL_USE_BUFFER_CLASSES == 1)
+    /* tx buffers are provided by the master */
+    rpmsg_lite_dev->tx_payload_max = RL_BUFFER_PAYLOAD_SIZE;
+#endif
 
     /* Create virtqueue for each vring. */
     for (idx = 0; idx < 2; idx++)
@@ -1101,10 +2182,37 @@ struct rpmsg_lite_instance *rpmsg_lite_remote_init(void *shmem_addr, int link_id
         return NULL;
     }
 
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    status = env_create_sync_lock(&rpmsg_lite_dev->tx_wait_lock, LOCKED);
+    if (status != RL_SUCCESS)
+    {
+        env_delete_mutex(rpmsg_lite_dev->lock);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+        env_free_memory(rpmsg_lite_dev);
+#endif
+        return NULL;
+    }
+#endif
+
     // FIXME - a better way to handle this , tx for master is rx for remote and vice versa.
     rpmsg_lite_dev->tvq = vqs[0];
     rpmsg_lite_dev->rvq = vqs[1];
 
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+    status = rpmsg_lite_rx_worker_init(rpmsg_lite_dev, link_id);
+    if (status != RL_SUCCESS)
+    {
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+        env_delete_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+#endif
+        env_delete_mutex(rpmsg_lite_dev->lock);
+#if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
+        env_free_memory(rpmsg_lite_dev);
+#endif
+        return NULL;
+    }
+#endif /* RL_USE_RX_WORKER */
+
     /* Install ISRs */
     platform_init_interrupt(rpmsg_lite_dev->rvq->vq_queue_index, rpmsg_lite_dev->rvq);
     platform_init_interrupt(rpmsg_lite_dev->tvq->vq_queue_index, rpmsg_lite_dev->tvq);
@@ -1150,6 +2258,10 @@ int rpmsg_lite_deinit(struct rpmsg_lite_instance *rpmsg_lite_dev)
     platform_deinit_interrupt(rpmsg_lite_dev->rvq->vq_queue_index);
     platform_deinit_interrupt(rpmsg_lite_dev->tvq->vq_queue_index);
 
+#if defined(RL_USE_RX_WORKER) && (RL_USE_RX_WORKER == 1)
+    rpmsg_lite_rx_worker_deinit(rpmsg_lite_dev);
+#endif
+
 #if defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1)
     virtqueue_free_static(rpmsg_lite_dev->rvq);
     virtqueue_free_static(rpmsg_lite_dev->tvq);
@@ -1159,6 +2271,9 @@ int rpmsg_lite_deinit(struct rpmsg_lite_instance *rpmsg_lite_dev)
 #endif /* RL_USE_STATIC_API */
 
     env_delete_mutex(rpmsg_lite_dev->lock);
+#if defined(RL_USE_TX_WAIT_EVENT) && (RL_USE_TX_WAIT_EVENT == 1)
+    env_delete_sync_lock(rpmsg_lite_dev->tx_wait_lock);
+#endif
 
 #if !(defined(RL_USE_STATIC_API) && (RL_USE_STATIC_API == 1))
     env_free_memory(rpmsg_lite_dev);
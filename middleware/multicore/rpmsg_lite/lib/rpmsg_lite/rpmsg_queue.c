@@ -32,18 +32,208 @@
 #include "rpmsg_lite.h"
 #include "rpmsg_queue.h"
 
-typedef struct
+extern volatile struct rpmsg_lite_instance rpmsg_lite_dev;
+
+#if defined(RL_USE_QUEUE_RING) && (RL_USE_QUEUE_RING == 1)
+/* Single producer (rx callback) / single consumer (receiving task) ring
+ * of received buffers. head is written by the producer only, tail
+ * by the consumer only. */
+struct rpmsg_queue_ring
 {
-    unsigned long src;
-    void *data;
-    short int len;
-} rpmsg_queue_rx_cb_data_t;
+    volatile unsigned long head;
+    volatile unsigned long tail;
+    void *volatile waiter; /* task sleeping until the ring is not empty, notified by the producer */
+    unsigned long mask;
+    rpmsg_queue_msg_t msgs[1];
+};
 
-extern volatile struct rpmsg_lite_instance rpmsg_lite_dev;
+/*!
+ * @brief
+ * Waits for the ring to become non-empty.
+ *
+ * @param ring      Ring to wait on
+ * @param timeout   Timeout in ms, 0 if nonblocking
+ *
+ * @return 1 if there is a message in the ring, 0 on timeout
+ */
+static int rpmsg_queue_ring_wait(struct rpmsg_queue_ring *ring, unsigned long timeout)
+{
+    int woken;
+
+    /* A notification sent after the last wait found the ring not empty may
+     * still be pending, it only ends one sleep early, the ring is checked again. */
+    while (ring->head == ring->tail)
+    {
+        if (!timeout)
+        {
+            return 0;
+        }
+
+        /* Register as waiter before checking the ring again, the rx callback
+         * checks for a waiter after updating head. */
+        ring->waiter = env_get_current_task();
+        env_mb();
+        woken = 1;
+        if (ring->head == ring->tail)
+        {
+            woken = env_wait_task_notify(&timeout);
+        }
+        ring->waiter = RL_NULL;
+
+        if (!woken)
+        {
+            return (ring->head != ring->tail);
+        }
+    }
+
+    env_rmb();
+    return 1;
+}
+
+/*!
+ * @brief
+ * Takes the oldest message out of a non-empty ring.
+ *
+ * @param ring      Ring to take the message from
+ * @param msg       Message
+ */
+static void rpmsg_queue_ring_get(struct rpmsg_queue_ring *ring, rpmsg_queue_msg_t *msg)
+{
+    *msg = ring->msgs[ring->tail & ring->mask];
+    env_mb();
+    ring->tail++;
+}
 
 int rpmsg_queue_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
 {
-    rpmsg_queue_rx_cb_data_t msg;
+    struct rpmsg_queue_ring *ring = (struct rpmsg_queue_ring *)priv;
+    rpmsg_queue_msg_t *msg;
+    void *waiter;
+
+    RL_ASSERT(priv);
+
+    /* ring full, drop the message */
+    if ((ring->head - ring->tail) > ring->mask)
+    {
+        return RL_RELEASE;
+    }
+
+    msg = &ring->msgs[ring->head & ring->mask];
+    msg->data = payload;
+    msg->len = payload_len;
+    msg->src = src;
+
+    env_wmb();
+    ring->head++;
+    env_mb();
+
+    waiter = ring->waiter;
+    if (waiter)
+    {
+        env_notify_task(waiter);
+    }
+
+    /* hold the rx buffer */
+    return RL_HOLD;
+}
+
+rpmsg_queue_handle rpmsg_queue_create(struct rpmsg_lite_instance *rpmsg_lite_dev)
+{
+    struct rpmsg_queue_ring *ring;
+    unsigned long count;
+
+    if (rpmsg_lite_dev == RL_NULL)
+    {
+        return RL_NULL;
+    }
+
+    /* one entry for each rx buffer, vq_nentries is power of two */
+    count = rpmsg_lite_dev->rvq->vq_nentries;
+    ring = env_allocate_memory(sizeof(struct rpmsg_queue_ring) + (count - 1) * sizeof(rpmsg_queue_msg_t));
+    if (ring == RL_NULL)
+    {
+        return RL_NULL;
+    }
+
+    ring->head = 0;
+    ring->tail = 0;
+    ring->waiter = RL_NULL;
+    ring->mask = count - 1;
+
+    return ((rpmsg_queue_handle)ring);
+}
+
+int rpmsg_queue_destroy(struct rpmsg_lite_instance *rpmsg_lite_dev, rpmsg_queue_handle q)
+{
+    if (rpmsg_lite_dev == RL_NULL)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    if (q == RL_NULL)
+    {
+        return RL_ERR_PARAM;
+    }
+    env_free_memory(q);
+    return RL_SUCCESS;
+}
+
+static int rpmsg_queue_get(rpmsg_queue_handle q, rpmsg_queue_msg_t *msg, unsigned long timeout)
+{
+    struct rpmsg_queue_ring *ring = (struct rpmsg_queue_ring *)q;
+
+    if (!rpmsg_queue_ring_wait(ring, timeout))
+    {
+        return 0;
+    }
+    rpmsg_queue_ring_get(ring, msg);
+    return 1;
+}
+
+int rpmsg_queue_recv_many(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                          rpmsg_queue_handle q,
+                          rpmsg_queue_msg_t *msgs,
+                          int max_count,
+                          unsigned long timeout)
+{
+    struct rpmsg_queue_ring *ring = (struct rpmsg_queue_ring *)q;
+    int count = 0;
+
+    if (!rpmsg_lite_dev || !q || !msgs || (max_count <= 0))
+    {
+        return RL_ERR_PARAM;
+    }
+
+    if (!rpmsg_queue_ring_wait(ring, timeout))
+    {
+        return RL_ERR_NO_BUFF;
+    }
+
+    /* take everything received so far, up to max_count */
+    do
+    {
+        rpmsg_queue_ring_get(ring, &msgs[count++]);
+    } while ((count < max_count) && (ring->head != ring->tail));
+
+    return count;
+}
+
+int rpmsg_queue_get_current_size(rpmsg_queue_handle q)
+{
+    struct rpmsg_queue_ring *ring = (struct rpmsg_queue_ring *)q;
+
+    if (!q)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    /* Return actual queue size. */
+    return (int)(ring->head - ring->tail);
+}
+#else
+int rpmsg_queue_rx_cb(void *payload, int payload_len, unsigned long src, void *priv)
+{
+    rpmsg_queue_msg_t msg;
 
     RL_ASSERT(priv);
 
@@ -72,7 +262,7 @@ rpmsg_queue_handle rpmsg_queue_create(struct rpmsg_lite_instance *rpmsg_lite_dev
     }
 
     /* create message queue for channel default endpoint */
-    status = env_create_queue(&q, rpmsg_lite_dev->rvq->vq_nentries, sizeof(rpmsg_queue_rx_cb_data_t));
+    status = env_create_queue(&q, rpmsg_lite_dev->rvq->vq_nentries, sizeof(rpmsg_queue_msg_t));
     if ((status) || (q == NULL))
     {
         return RL_NULL;
@@ -96,6 +286,53 @@ int rpmsg_queue_destroy(struct rpmsg_lite_instance *rpmsg_lite_dev, rpmsg_queue_
     return RL_SUCCESS;
 }
 
+static int rpmsg_queue_get(rpmsg_queue_handle q, rpmsg_queue_msg_t *msg, unsigned long timeout)
+{
+    return env_get_queue((void *)q, msg, timeout);
+}
+
+int rpmsg_queue_recv_many(struct rpmsg_lite_instance *rpmsg_lite_dev,
+                          rpmsg_queue_handle q,
+                          rpmsg_queue_msg_t *msgs,
+                          int max_count,
+                          unsigned long timeout)
+{
+    int count = 0;
+
+    if (!rpmsg_lite_dev || !q || !msgs || (max_count <= 0))
+    {
+        return RL_ERR_PARAM;
+    }
+
+    if (!env_get_queue((void *)q, &msgs[count], timeout))
+    {
+        return RL_ERR_NO_BUFF;
+    }
+
+    /* take everything received so far, up to max_count */
+    for (count = 1; count < max_count; count++)
+    {
+        if (!env_get_queue((void *)q, &msgs[count], 0))
+        {
+            break;
+        }
+    }
+
+    return count;
+}
+
+int rpmsg_queue_get_current_size(rpmsg_queue_handle q)
+{
+    if (!q)
+    {
+        return RL_ERR_PARAM;
+    }
+
+    /* Return actual queue size. */
+    return env_get_current_queue_size((void *)q);
+}
+#endif /* RL_USE_QUEUE_RING */
+
 int rpmsg_queue_recv(struct rpmsg_lite_instance *rpmsg_lite_dev,
                      rpmsg_queue_handle q,
                      unsigned long *src,
@@ -104,7 +341,7 @@ int rpmsg_queue_recv(struct rpmsg_lite_instance *rpmsg_lite_dev,
                      int *len,
                      unsigned long timeout)
 {
-    rpmsg_queue_rx_cb_data_t msg = {0};
+    rpmsg_queue_msg_t msg = {0};
     int retval = RL_SUCCESS;
 
     if (!rpmsg_lite_dev)
@@ -121,7 +358,7 @@ int rpmsg_queue_recv(struct rpmsg_lite_instance *rpmsg_lite_dev,
     }
 
     /* Get an element out of the message queue for the selected endpoint */
-    if (env_get_queue((void *)q, &msg, timeout))
+    if (rpmsg_queue_get(q, &msg, timeout))
     {
         if (src != NULL)
         {
@@ -159,7 +396,7 @@ int rpmsg_queue_recv_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
                             int *len,
                             unsigned long timeout)
 {
-    rpmsg_queue_rx_cb_data_t msg = {0};
+    rpmsg_queue_msg_t msg = {0};
 
     if (!rpmsg_lite_dev)
     {
@@ -175,7 +412,7 @@ int rpmsg_queue_recv_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
     }
 
     /* Get an element out of the message queue for the selected endpoint */
-    if (env_get_queue((void *)q, &msg, timeout))
+    if (rpmsg_queue_get(q, &msg, timeout))
     {
         if (src != NULL)
         {
@@ -210,14 +447,3 @@ int rpmsg_queue_nocopy_free(struct rpmsg_lite_instance *rpmsg_lite_dev, void *da
 
     return RL_SUCCESS;
 }
-
-int rpmsg_queue_get_current_size(rpmsg_queue_handle q)
-{
-    if (!q)
-    {
-        return RL_ERR_PARAM;
-    }
-
-    /* Return actual queue size. */
-    return env_get_current_queue_size((void *)q);
-}
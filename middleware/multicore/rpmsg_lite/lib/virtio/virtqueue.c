@@ -27,6 +27,18 @@
 #include "rpmsg_env.h"
 #include "virtqueue.h"
 
+/* Cache maintenance of the vring, in case it is mapped cacheable.
+ * Every vring field written by this side is written back right away,
+ * so invalidating before reading a field of the other side never
+ * drops data of this side. */
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+#define VQ_CACHE_FLUSH(field) env_cache_flush_range((void *)&(field), sizeof(field))
+#define VQ_CACHE_INVALIDATE(field) env_cache_invalidate_range((void *)&(field), sizeof(field))
+#else
+#define VQ_CACHE_FLUSH(field)
+#define VQ_CACHE_INVALIDATE(field)
+#endif
+
 /* Prototype for internal functions. */
 static void vq_ring_update_avail(struct virtqueue *, uint16_t);
 static void vq_ring_update_used(struct virtqueue *vq, uint16_t head_idx, uint32_t len);
@@ -215,6 +227,7 @@ int virtqueue_fill_avail_buffers(struct virtqueue *vq, void *buffer, uint32_t le
         dp->addr = env_map_vatopa(buffer);
         dp->len = len;
         dp->flags = VRING_DESC_F_WRITE;
+        VQ_CACHE_FLUSH(*dp);
 
         vq->vq_desc_head_idx++;
 
@@ -240,7 +253,11 @@ void *virtqueue_get_buffer(struct virtqueue *vq, uint32_t *len, uint16_t *idx)
     struct vring_used_elem *uep;
     uint16_t used_idx, desc_idx;
 
-    if ((vq == VQ_NULL) || (vq->vq_used_cons_idx == vq->vq_ring.used->idx))
+    if (vq == VQ_NULL)
+        return (VQ_NULL);
+
+    VQ_CACHE_INVALIDATE(vq->vq_ring.used->idx);
+    if (vq->vq_used_cons_idx == vq->vq_ring.used->idx)
         return (VQ_NULL);
 
     VQUEUE_BUSY(vq, used_read);
@@ -250,6 +267,8 @@ void *virtqueue_get_buffer(struct virtqueue *vq, uint32_t *len, uint16_t *idx)
 
     env_rmb();
 
+    VQ_CACHE_INVALIDATE(*uep);
+
     desc_idx = (uint16_t)uep->id;
     if (len != VQ_NULL)
         *len = uep->len;
@@ -277,6 +296,19 @@ uint32_t virtqueue_get_buffer_length(struct virtqueue *vq, uint16_t idx)
     return vq->vq_ring.desc[idx].len;
 }
 
+/*!
+ * virtqueue_get_buffer_addr - Returns address of a buffer
+ *
+ * @param vq            - Pointer to VirtIO queue control block
+ * @param idx           - Index to buffer descriptor pool
+ *
+ * @return              - Buffer address
+ */
+void *virtqueue_get_buffer_addr(struct virtqueue *vq, uint16_t idx)
+{
+    return env_map_patova(vq->vq_ring.desc[idx].addr);
+}
+
 /*!
  * virtqueue_free   - Frees VirtIO queue resources
  *
@@ -330,6 +362,7 @@ void *virtqueue_get_available_buffer(struct virtqueue *vq, uint16_t *avail_idx,
     uint16_t head_idx = 0;
     void *buffer;
 
+    VQ_CACHE_INVALIDATE(vq->vq_ring.avail->idx);
     if (vq->vq_available_idx == vq->vq_ring.avail->idx)
     {
         return (VQ_NULL);
@@ -338,10 +371,13 @@ void *virtqueue_get_available_buffer(struct virtqueue *vq, uint16_t *avail_idx,
     VQUEUE_BUSY(vq, avail_read);
 
     head_idx = vq->vq_available_idx++ & (vq->vq_nentries - 1);
-    *avail_idx = vq->vq_ring.avail->ring[head_idx];
 
     env_rmb();
 
+    VQ_CACHE_INVALIDATE(vq->vq_ring.avail->ring[head_idx]);
+    *avail_idx = vq->vq_ring.avail->ring[head_idx];
+    VQ_CACHE_INVALIDATE(vq->vq_ring.desc[*avail_idx]);
+
     buffer = env_map_patova(vq->vq_ring.desc[*avail_idx].addr);
     *len = vq->vq_ring.desc[*avail_idx].len;
 
@@ -429,33 +465,85 @@ void virtqueue_disable_cb(struct virtqueue *vq)
     if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX)
     {
         vring_used_event(&vq->vq_ring) = vq->vq_used_cons_idx - vq->vq_nentries - 1;
+        VQ_CACHE_FLUSH(vring_used_event(&vq->vq_ring));
     }
     else
     {
         vq->vq_ring.avail->flags |= VRING_AVAIL_F_NO_INTERRUPT;
+        VQ_CACHE_FLUSH(vq->vq_ring.avail->flags);
     }
 
     VQUEUE_IDLE(vq, avail_write);
 }
 
+/*!
+ * virtqueue_disable_kick - Asks the other side not to notify when it makes
+ *                          new buffers available (avail ring consumer side)
+ *
+ * @param vq           - Pointer to VirtIO queue control block
+ *
+ */
+void virtqueue_disable_kick(struct virtqueue *vq)
+{
+    VQUEUE_BUSY(vq, used_write);
+
+    vq->vq_ring.used->flags |= VRING_USED_F_NO_NOTIFY;
+    VQ_CACHE_FLUSH(vq->vq_ring.used->flags);
+
+    VQUEUE_IDLE(vq, used_write);
+}
+
+/*!
+ * virtqueue_enable_kick - Asks the other side to notify again when it makes
+ *                         new buffers available (avail ring consumer side)
+ *
+ * @param vq           - Pointer to VirtIO queue control block
+ *
+ * @return             - 1 if buffers became available before
+ *                       notifications were enabled, 0 otherwise
+ */
+int virtqueue_enable_kick(struct virtqueue *vq)
+{
+    VQUEUE_BUSY(vq, used_write);
+
+    vq->vq_ring.used->flags &= ~VRING_USED_F_NO_NOTIFY;
+    VQ_CACHE_FLUSH(vq->vq_ring.used->flags);
+
+    VQUEUE_IDLE(vq, used_write);
+
+    env_mb();
+
+    VQ_CACHE_INVALIDATE(vq->vq_ring.avail->idx);
+    return (vq->vq_available_idx != vq->vq_ring.avail->idx);
+}
+
 /*!
  * virtqueue_kick - Notifies other side that there is buffer available for it.
  *
  * @param vq      - Pointer to VirtIO queue control block
+ *
+ * @return        - 1 if the other side was notified, 0 if it masked notifications
  */
-void virtqueue_kick(struct virtqueue *vq)
+int virtqueue_kick(struct virtqueue *vq)
 {
+    int notified = 0;
+
     VQUEUE_BUSY(vq, avail_write);
 
     /* Ensure updated avail->idx is visible to host. */
     env_mb();
 
     if (vq_ring_must_notify_host(vq))
+    {
         vq_ring_notify_host(vq);
+        notified = 1;
+    }
 
     vq->vq_queued_cnt = 0;
 
     VQUEUE_IDLE(vq, avail_write);
+
+    return notified;
 }
 
 /*!
@@ -490,13 +578,16 @@ uint32_t virtqueue_get_desc_size(struct virtqueue *vq)
     uint16_t avail_idx = 0;
     uint32_t len = 0;
 
+    VQ_CACHE_INVALIDATE(vq->vq_ring.avail->idx);
     if (vq->vq_available_idx == vq->vq_ring.avail->idx)
     {
         return 0;
     }
 
     head_idx = vq->vq_available_idx & (vq->vq_nentries - 1);
+    VQ_CACHE_INVALIDATE(vq->vq_ring.avail->ring[head_idx]);
     avail_idx = vq->vq_ring.avail->ring[head_idx];
+    VQ_CACHE_INVALIDATE(vq->vq_ring.desc[avail_idx]);
     len = vq->vq_ring.desc[avail_idx].len;
 
     return (len);
@@ -527,6 +618,7 @@ static uint16_t vq_ring_add_buffer(
     dp->addr = env_map_vatopa(buffer);
     dp->len = length;
     dp->flags = VRING_DESC_F_WRITE;
+    VQ_CACHE_FLUSH(*dp);
 
     return (head_idx + 1);
 }
@@ -547,6 +639,10 @@ void vq_ring_init(struct virtqueue *vq)
     for (i = 0; i < size - 1; i++)
         vr->desc[i].next = i + 1;
     vr->desc[i].next = VQ_RING_DESC_CHAIN_END;
+
+#if defined(RL_USE_CACHED_SHMEM) && (RL_USE_CACHED_SHMEM == 1)
+    env_cache_flush_range((void *)vr->desc, size * sizeof(struct vring_desc));
+#endif
 }
 
 /*!
@@ -567,10 +663,12 @@ static void vq_ring_update_avail(struct virtqueue *vq, uint16_t desc_idx)
      */
     avail_idx = vq->vq_ring.avail->idx & (vq->vq_nentries - 1);
     vq->vq_ring.avail->ring[avail_idx] = desc_idx;
+    VQ_CACHE_FLUSH(vq->vq_ring.avail->ring[avail_idx]);
 
     env_wmb();
 
     vq->vq_ring.avail->idx++;
+    VQ_CACHE_FLUSH(vq->vq_ring.avail->idx);
 
     /* Keep pending count until virtqueue_notify(). */
     vq->vq_queued_cnt++;
@@ -597,10 +695,12 @@ static void vq_ring_update_used(struct virtqueue *vq, uint16_t head_idx, uint32_
     used_desc = &(vq->vq_ring.used->ring[used_idx]);
     used_desc->id = head_idx;
     used_desc->len = len;
+    VQ_CACHE_FLUSH(*used_desc);
 
     env_wmb();
 
     vq->vq_ring.used->idx++;
+    VQ_CACHE_FLUSH(vq->vq_ring.used->idx);
 }
 
 /*!
@@ -617,10 +717,12 @@ static int vq_ring_enable_interrupt(struct virtqueue *vq, uint16_t ndesc)
     if (vq->vq_flags & VIRTQUEUE_FLAG_EVENT_IDX)
     {
         vring_used_event(&vq->vq_ring) = vq->vq_used_cons_idx + ndesc;
+        VQ_CACHE_FLUSH(vring_used_event(&vq->vq_ring));
     }
     else
     {
         vq->vq_ring.avail->flags &= ~VRING_AVAIL_F_NO_INTERRUPT;
+        VQ_CACHE_FLUSH(vq->vq_ring.avail->flags);
     }
 
     env_mb();
@@ -667,10 +769,12 @@ static int vq_ring_must_notify_host(struct virtqueue *vq)
         new_idx = vq->vq_ring.avail->idx;
         prev_idx = new_idx - vq->vq_queued_cnt;
         event_idx = vring_avail_event(&vq->vq_ring);
+        VQ_CACHE_INVALIDATE(*event_idx);
 
         return (vring_need_event(*event_idx, new_idx, prev_idx) != 0);
     }
 
+    VQ_CACHE_INVALIDATE(vq->vq_ring.used->flags);
     return ((vq->vq_ring.used->flags & VRING_USED_F_NO_NOTIFY) == 0);
 }
 
@@ -694,6 +798,7 @@ static int virtqueue_nused(struct virtqueue *vq)
 {
     uint16_t used_idx, nused;
 
+    VQ_CACHE_INVALIDATE(vq->vq_ring.used->idx);
     used_idx = vq->vq_ring.used->idx;
 
     nused = (uint16_t)(used_idx - vq->vq_used_cons_idx);
@@ -0,0 +1,455 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "block_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Maximum number of pools that can be registered with
+xBlockPoolAddMallocClass(). */
+#ifndef configBLOCK_POOL_MALLOC_CLASSES
+	#define configBLOCK_POOL_MALLOC_CLASSES	4
+#endif
+
+/* The head of the free list holds the index of the first free block in its low
+half and a counter in its high half.  The counter is incremented by every
+update, so a head read before a pop and a push of the same block does not
+compare equal any more (the ABA problem of lock free stacks).  Each free block
+holds the index of the next free block in its first word. */
+#define blockpoolINDEX_MASK			( ( uint32_t ) 0x0000FFFFUL )
+#define blockpoolTAG_INCREMENT		( ( uint32_t ) 0x00010000UL )
+#define blockpoolEND_OF_LIST		blockpoolINDEX_MASK
+#define blockpoolMAX_BLOCK_COUNT	( ( UBaseType_t ) blockpoolEND_OF_LIST - 1U )
+
+/* Without a compare and swap primitive in the port, the compare and swap is
+done with the interrupts masked. */
+#ifndef portHAS_COMPARE_AND_SWAP_U32
+	static BaseType_t xPortCompareAndSwapU32( volatile uint32_t *pulDestination, uint32_t ulExpectedValue, uint32_t ulNewValue )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReturn = pdFALSE;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *pulDestination == ulExpectedValue )
+			{
+				*pulDestination = ulNewValue;
+				xReturn = pdTRUE;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+#endif /* portHAS_COMPARE_AND_SWAP_U32 */
+
+/* The definition of the block pool structure, see StaticBlockPool_t. */
+typedef struct xBLOCK_POOL
+{
+	uint8_t *pucStorage;					/*<< Points to the first block. */
+	size_t xBlockSize;						/*<< Size of each block after rounding. */
+	volatile uint32_t ulFreeListHead;		/*<< Counter and index of the first free block, see blockpoolINDEX_MASK. */
+	volatile uint32_t ulBlocksInUse;
+	volatile uint32_t ulHighWaterMark;
+	volatile uint32_t ulFailedAllocations;
+	uint32_t ulBlockCount;
+	uint32_t ulStaticallyAllocated;			/*<< pdTRUE if the pool structure and storage were provided by the application. */
+} BlockPool_t;
+
+/* Size of the pool structure rounded up so the storage that follows it in a
+dynamically created pool is aligned. */
+#define blockpoolSTRUCT_SIZE	( ( sizeof( BlockPool_t ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*
+ * Links all the blocks into the free list and clears the statistics.
+ */
+static void prvInitialiseNewBlockPool( BlockPool_t *pxPool, size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucStorage ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds ulValue to *pulDestination, returns the new value.
+ */
+static uint32_t prvAtomicAdd( volatile uint32_t *pulDestination, uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes the first free block of the pool, returns NULL if the pool is empty.
+ * The failed allocation is counted by the callers.
+ */
+static void *prvBlockPoolTake( BlockPool_t *pxPool ) PRIVILEGED_FUNCTION;
+
+/* The pools registered with xBlockPoolAddMallocClass(), by increasing block
+size. */
+#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+	static BlockPool_t *pxMallocClasses[ configBLOCK_POOL_MALLOC_CLASSES ];
+	static UBaseType_t uxMallocClassCount = 0;
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount )
+	{
+	BlockPool_t *pxPool = NULL;
+	size_t xRoundedSize;
+
+		if( ( uxBlockCount > 0 ) && ( uxBlockCount <= blockpoolMAX_BLOCK_COUNT ) && ( xBlockSize > 0 ) )
+		{
+			xRoundedSize = blockpoolBLOCK_SIZE( xBlockSize );
+
+			/* Check the rounding and the size of the storage do not wrap. */
+			if( ( xRoundedSize >= xBlockSize ) && ( ( ( xRoundedSize * ( size_t ) uxBlockCount ) / ( size_t ) uxBlockCount ) == xRoundedSize ) )
+			{
+				/* The storage follows the pool structure. */
+				pxPool = ( BlockPool_t * ) pvPortMalloc( blockpoolSTRUCT_SIZE + ( xRoundedSize * ( size_t ) uxBlockCount ) ); /*lint !e9087 !e9079 Cast to the structure at the start of the allocation. */
+			}
+
+			if( pxPool != NULL )
+			{
+				prvInitialiseNewBlockPool( pxPool, xBlockSize, uxBlockCount, ( ( uint8_t * ) pxPool ) + blockpoolSTRUCT_SIZE ); /*lint !e9016 Indexing past structure valid for uint8_t pointer. */
+				pxPool->ulStaticallyAllocated = pdFALSE;
+			}
+			else
+			{
+				traceBLOCK_POOL_CREATE_FAILED();
+			}
+		}
+
+		return ( BlockPoolHandle_t ) pxPool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucPoolStorageArea, StaticBlockPool_t *pxStaticBlockPool )
+	{
+	BlockPool_t *pxPool = ( BlockPool_t * ) pxStaticBlockPool; /*lint !e740 !e9087 BlockPool_t and StaticBlockPool_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		configASSERT( pucPoolStorageArea );
+		configASSERT( pxStaticBlockPool );
+		configASSERT( ( ( ( size_t ) pucPoolStorageArea ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticBlockPool_t equals the size of the real
+			block pool structure. */
+			volatile size_t xSize = sizeof( StaticBlockPool_t );
+			configASSERT( xSize == sizeof( BlockPool_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( ( pucPoolStorageArea != NULL ) && ( pxStaticBlockPool != NULL ) && ( uxBlockCount > 0 ) && ( uxBlockCount <= blockpoolMAX_BLOCK_COUNT ) && ( xBlockSize > 0 ) )
+		{
+			prvInitialiseNewBlockPool( pxPool, xBlockSize, uxBlockCount, pucPoolStorageArea );
+			pxPool->ulStaticallyAllocated = pdTRUE;
+		}
+		else
+		{
+			pxPool = NULL;
+			traceBLOCK_POOL_CREATE_STATIC_FAILED();
+		}
+
+		return ( BlockPoolHandle_t ) pxPool;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewBlockPool( BlockPool_t *pxPool, size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucStorage )
+{
+uint32_t ulIndex;
+
+	pxPool->pucStorage = pucStorage;
+	pxPool->xBlockSize = blockpoolBLOCK_SIZE( xBlockSize );
+	pxPool->ulBlockCount = ( uint32_t ) uxBlockCount;
+	pxPool->ulBlocksInUse = 0;
+	pxPool->ulHighWaterMark = 0;
+	pxPool->ulFailedAllocations = 0;
+
+	for( ulIndex = 0; ulIndex < pxPool->ulBlockCount; ulIndex++ )
+	{
+		*( ( uint32_t * ) &( pucStorage[ ulIndex * pxPool->xBlockSize ] ) ) = ( ( ulIndex + 1U ) < pxPool->ulBlockCount ) ? ( ulIndex + 1U ) : blockpoolEND_OF_LIST; /*lint !e826 !e9087 The block is aligned. */
+	}
+	pxPool->ulFreeListHead = 0;
+
+	traceBLOCK_POOL_CREATE( pxPool );
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolDelete( BlockPoolHandle_t xPool )
+{
+BlockPool_t *pxPool = ( BlockPool_t * ) xPool;
+
+	configASSERT( pxPool );
+
+	#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+	{
+	UBaseType_t uxClass;
+
+		for( uxClass = 0; uxClass < uxMallocClassCount; uxClass++ )
+		{
+			configASSERT( pxMallocClasses[ uxClass ] != pxPool );
+		}
+	}
+	#endif
+
+	traceBLOCK_POOL_DELETE( pxPool );
+
+	if( pxPool->ulStaticallyAllocated == ( uint32_t ) pdFALSE )
+	{
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			vPortFree( ( void * ) pxPool );
+		}
+		#else
+		{
+			/* Should not be possible to get here, ulStaticallyAllocated must be
+			pdTRUE if only static allocation is supported. */
+			configASSERT( 0 );
+		}
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvAtomicAdd( volatile uint32_t *pulDestination, uint32_t ulValue )
+{
+uint32_t ulOldValue;
+
+	do
+	{
+		ulOldValue = *pulDestination;
+	} while( xPortCompareAndSwapU32( pulDestination, ulOldValue, ulOldValue + ulValue ) == pdFALSE );
+
+	return ulOldValue + ulValue;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvBlockPoolTake( BlockPool_t *pxPool )
+{
+uint32_t ulHead, ulIndex, ulNext, ulInUse, ulHighWaterMark;
+void *pvReturn;
+
+	do
+	{
+		ulHead = pxPool->ulFreeListHead;
+		ulIndex = ulHead & blockpoolINDEX_MASK;
+
+		if( ulIndex == blockpoolEND_OF_LIST )
+		{
+			return NULL;
+		}
+
+		/* The block may be taken and overwritten by an interrupt before the
+		compare and swap, the link read here is then wrong but the counter of
+		the head has changed and the swap fails. */
+		ulNext = *( ( volatile uint32_t * ) &( pxPool->pucStorage[ ulIndex * pxPool->xBlockSize ] ) ); /*lint !e826 !e9087 The block is aligned. */
+	} while( xPortCompareAndSwapU32( &( pxPool->ulFreeListHead ), ulHead, ( ( ulHead + blockpoolTAG_INCREMENT ) & ~blockpoolINDEX_MASK ) | ( ulNext & blockpoolINDEX_MASK ) ) == pdFALSE );
+
+	pvReturn = ( void * ) &( pxPool->pucStorage[ ulIndex * pxPool->xBlockSize ] );
+
+	ulInUse = prvAtomicAdd( &( pxPool->ulBlocksInUse ), 1U );
+	do
+	{
+		ulHighWaterMark = pxPool->ulHighWaterMark;
+	} while( ( ulInUse > ulHighWaterMark ) && ( xPortCompareAndSwapU32( &( pxPool->ulHighWaterMark ), ulHighWaterMark, ulInUse ) == pdFALSE ) );
+
+	traceBLOCK_POOL_ALLOC( pxPool, pvReturn );
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvBlockPoolAlloc( BlockPoolHandle_t xPool )
+{
+BlockPool_t * const pxPool = ( BlockPool_t * ) xPool;
+void *pvReturn;
+
+	configASSERT( pxPool );
+
+	pvReturn = prvBlockPoolTake( pxPool );
+	if( pvReturn == NULL )
+	{
+		( void ) prvAtomicAdd( &( pxPool->ulFailedAllocations ), 1U );
+		traceBLOCK_POOL_ALLOC_FAILED( pxPool );
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolFree( BlockPoolHandle_t xPool, void *pvBlock )
+{
+BlockPool_t * const pxPool = ( BlockPool_t * ) xPool;
+uint32_t ulHead, ulIndex;
+
+	configASSERT( pxPool );
+	configASSERT( xBlockPoolOwnsBlock( xPool, pvBlock ) != pdFALSE );
+	configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBlock - pxPool->pucStorage ) % pxPool->xBlockSize ) == 0 );
+
+	ulIndex = ( uint32_t ) ( ( size_t ) ( ( uint8_t * ) pvBlock - pxPool->pucStorage ) / pxPool->xBlockSize );
+
+	traceBLOCK_POOL_FREE( pxPool, pvBlock );
+
+	( void ) prvAtomicAdd( &( pxPool->ulBlocksInUse ), ( uint32_t ) -1 );
+
+	do
+	{
+		ulHead = pxPool->ulFreeListHead;
+		*( ( volatile uint32_t * ) pvBlock ) = ulHead & blockpoolINDEX_MASK;
+	} while( xPortCompareAndSwapU32( &( pxPool->ulFreeListHead ), ulHead, ( ( ulHead + blockpoolTAG_INCREMENT ) & ~blockpoolINDEX_MASK ) | ulIndex ) == pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBlockPoolOwnsBlock( BlockPoolHandle_t xPool, const void *pvBlock )
+{
+const BlockPool_t * const pxPool = ( const BlockPool_t * ) xPool;
+const uint8_t *pucBlock = ( const uint8_t * ) pvBlock;
+
+	configASSERT( pxPool );
+
+	if( ( pucBlock >= pxPool->pucStorage ) && ( pucBlock < &( pxPool->pucStorage[ pxPool->ulBlockCount * pxPool->xBlockSize ] ) ) )
+	{
+		return pdTRUE;
+	}
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vBlockPoolGetStats( BlockPoolHandle_t xPool, BlockPoolStats_t *pxStats )
+{
+const BlockPool_t * const pxPool = ( const BlockPool_t * ) xPool;
+
+	configASSERT( pxPool );
+	configASSERT( pxStats );
+
+	pxStats->xBlockSize = pxPool->xBlockSize;
+	pxStats->uxBlockCount = ( UBaseType_t ) pxPool->ulBlockCount;
+	pxStats->uxBlocksInUse = ( UBaseType_t ) pxPool->ulBlocksInUse;
+	pxStats->uxHighWaterMark = ( UBaseType_t ) pxPool->ulHighWaterMark;
+	pxStats->uxFailedAllocations = ( UBaseType_t ) pxPool->ulFailedAllocations;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+
+	BaseType_t xBlockPoolAddMallocClass( BlockPoolHandle_t xPool )
+	{
+	BlockPool_t *pxPool = ( BlockPool_t * ) xPool;
+	BaseType_t xReturn = pdFAIL;
+	UBaseType_t uxClass;
+
+		configASSERT( pxPool );
+
+		/* pvPortMalloc() is not called from interrupts, holding off the other
+		tasks is enough. */
+		vTaskSuspendAll();
+		{
+			if( uxMallocClassCount < ( UBaseType_t ) configBLOCK_POOL_MALLOC_CLASSES )
+			{
+				/* Insert sorted by block size. */
+				for( uxClass = uxMallocClassCount; ( uxClass > 0 ) && ( pxMallocClasses[ uxClass - 1 ]->xBlockSize > pxPool->xBlockSize ); uxClass-- )
+				{
+					pxMallocClasses[ uxClass ] = pxMallocClasses[ uxClass - 1 ];
+				}
+				pxMallocClasses[ uxClass ] = pxPool;
+				uxMallocClassCount++;
+				xReturn = pdPASS;
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void *pvBlockPoolMalloc( size_t xWantedSize )
+	{
+	UBaseType_t uxClass;
+	BlockPool_t *pxFirstFit = NULL;
+	void *pvReturn = NULL;
+
+		for( uxClass = 0; ( uxClass < uxMallocClassCount ) && ( pvReturn == NULL ); uxClass++ )
+		{
+			if( pxMallocClasses[ uxClass ]->xBlockSize >= xWantedSize )
+			{
+				if( pxFirstFit == NULL )
+				{
+					pxFirstFit = pxMallocClasses[ uxClass ];
+				}
+				pvReturn = prvBlockPoolTake( pxMallocClasses[ uxClass ] );
+			}
+		}
+
+		/* An empty pool served by a larger one is not a failure, the request
+		is counted once, on the class it fits best, when no class could serve
+		it and it goes to the heap. */
+		if( ( pvReturn == NULL ) && ( pxFirstFit != NULL ) )
+		{
+			( void ) prvAtomicAdd( &( pxFirstFit->ulFailedAllocations ), 1U );
+			traceBLOCK_POOL_ALLOC_FAILED( pxFirstFit );
+		}
+
+		return pvReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	BaseType_t xBlockPoolMallocFree( void *pv )
+	{
+	UBaseType_t uxClass;
+
+		for( uxClass = 0; uxClass < uxMallocClassCount; uxClass++ )
+		{
+			if( xBlockPoolOwnsBlock( ( BlockPoolHandle_t ) pxMallocClasses[ uxClass ], pv ) != pdFALSE )
+			{
+				vBlockPoolFree( ( BlockPoolHandle_t ) pxMallocClasses[ uxClass ], pv );
+				return pdTRUE;
+			}
+		}
+
+		return pdFALSE;
+	}
+
+#endif /* configUSE_BLOCK_POOL_MALLOC */
@@ -69,6 +69,12 @@ typedef struct xEventGroupDefinition
 		UBaseType_t uxEventGroupNumber;
 	#endif
 
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		volatile UBaseType_t uxLocked;				/*< Non-zero while a task accesses xTasksWaitingForBits with the scheduler suspended. */
+		volatile EventBits_t uxBitsSetFromISR;		/*< Bits set by interrupts while the event group was locked. */
+		volatile EventBits_t uxBitsClearedFromISR;	/*< Bits cleared by interrupts while the event group was locked. */
+	#endif
+
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
 	#endif
@@ -86,6 +92,31 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Set the bits in uxBitsToSet and unblock the tasks whose wait condition is
+ * then met.  Called with the scheduler suspended and the event group locked, or
+ * with xFromISR set to pdTRUE from the direct ISR path with interrupts masked.
+ * Returns pdTRUE if a task with a priority above the running task was
+ * unblocked from the ISR path.
+ */
+static BaseType_t prvSetBitsAndUnblockTasks( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+/*
+ * With configUSE_EVENT_GROUP_DIRECT_ISR set to 1 interrupts update the event
+ * group directly, unless a task holds the event group locked while it accesses
+ * the list of waiting tasks.  The interrupts then only record the bits they set
+ * or clear, and prvUnlockEventGroup() applies them before the scheduler is
+ * resumed - the same as the lock of queues.  Locks nest, xEventGroupSync()
+ * calls xEventGroupSetBits().
+ */
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+	static void prvLockEventGroup( EventGroup_t *pxEventBits ) PRIVILEGED_FUNCTION;
+	static void prvUnlockEventGroup( EventGroup_t *pxEventBits ) PRIVILEGED_FUNCTION;
+#else
+	#define prvLockEventGroup( pxEventBits )
+	#define prvUnlockEventGroup( pxEventBits )
+#endif
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -115,6 +146,14 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			{
+				pxEventBits->uxLocked = ( UBaseType_t ) 0;
+				pxEventBits->uxBitsSetFromISR = ( EventBits_t ) 0;
+				pxEventBits->uxBitsClearedFromISR = ( EventBits_t ) 0;
+			}
+			#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+
 			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note that
@@ -151,6 +190,14 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			{
+				pxEventBits->uxLocked = ( UBaseType_t ) 0;
+				pxEventBits->uxBitsSetFromISR = ( EventBits_t ) 0;
+				pxEventBits->uxBitsClearedFromISR = ( EventBits_t ) 0;
+			}
+			#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note this
@@ -189,6 +236,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -231,6 +279,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			}
 		}
 	}
+	prvUnlockEventGroup( pxEventBits );
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -312,6 +361,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -379,6 +429,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
 		}
 	}
+	prvUnlockEventGroup( pxEventBits );
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -470,7 +521,39 @@ EventBits_t uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+
+		/* Clearing bits never unblocks a task, so only the event bits are
+		updated. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxEventBits->uxLocked == ( UBaseType_t ) 0 )
+			{
+				pxEventBits->uxEventBits &= ~uxBitsToClear;
+			}
+			else
+			{
+				/* A task is accessing the event group, the bits are cleared
+				when it unlocks the event group, after the bits set before. */
+				pxEventBits->uxBitsClearedFromISR |= uxBitsToClear;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
 	{
@@ -503,92 +586,21 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
+	prvLockEventGroup( pxEventBits );
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
-
-		/* Set the bits. */
-		pxEventBits->uxEventBits |= uxBitsToSet;
-
-		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
-		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
-
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
-			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-				{
-					xMatchFound = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
-			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
-			}
-			else
-			{
-				/* Need all bits to be set, but not all the bits were set. */
-			}
-
-			if( xMatchFound != pdFALSE )
-			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-				{
-					uxBitsToClear |= uxBitsWaitedFor;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
-			}
-
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
-		}
-
-		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-		bit was set in the control word. */
-		pxEventBits->uxEventBits &= ~uxBitsToClear;
+		( void ) prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet, pdFALSE );
 	}
+	prvUnlockEventGroup( pxEventBits );
 	( void ) xTaskResumeAll();
 
 	return pxEventBits->uxEventBits;
@@ -601,6 +613,9 @@ EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
 const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 
 	vTaskSuspendAll();
+	/* The event group is not unlocked again, interrupts must not use it once
+	it is deleted. */
+	prvLockEventGroup( pxEventBits );
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
@@ -688,7 +703,251 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+static BaseType_t prvSetBitsAndUnblockTasks( EventGroup_t *pxEventBits, const EventBits_t uxBitsToSet, const BaseType_t xFromISR )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+List_t *pxList;
+EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+BaseType_t xMatchFound = pdFALSE;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	pxList = &( pxEventBits->xTasksWaitingForBits );
+	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	pxListItem = listGET_HEAD_ENTRY( pxList );
+
+	/* Set the bits. */
+	pxEventBits->uxEventBits |= uxBitsToSet;
+
+	/* See if the new bit value should unblock any tasks. */
+	while( pxListItem != pxListEnd )
+	{
+		pxNext = listGET_NEXT( pxListItem );
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+		xMatchFound = pdFALSE;
+
+		/* Split the bits waited for from the control bits. */
+		uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+		if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		{
+			/* Just looking for single bit being set. */
+			if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+			{
+				xMatchFound = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+		{
+			/* All bits are set. */
+			xMatchFound = pdTRUE;
+		}
+		else
+		{
+			/* Need all bits to be set, but not all the bits were set. */
+		}
+
+		if( xMatchFound != pdFALSE )
+		{
+			/* The bits match.  Should the bits be cleared on exit? */
+			if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+			{
+				uxBitsToClear |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Store the actual event flag value in the task's event list
+			item before removing the task from the event list.  The
+			eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+			that is was unblocked due to its required bits matching, rather
+			than because it timed out. */
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			if( xFromISR != pdFALSE )
+			{
+				if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+				{
+					xHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+			{
+				vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+			}
+		}
+
+		/* Move onto the next list item.  Note pxListItem->pxNext is not
+		used here as the list item may have been removed from the event list
+		and inserted into the ready/pending reading list. */
+		pxListItem = pxNext;
+	}
+
+	/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+	bit was set in the control word. */
+	pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+	/* Prevent compiler warnings when the direct ISR path is not used. */
+	( void ) xFromISR;
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	static void prvLockEventGroup( EventGroup_t *pxEventBits )
+	{
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+		taskENTER_CRITICAL();
+		{
+			( pxEventBits->uxLocked )++;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	static void prvUnlockEventGroup( EventGroup_t *pxEventBits )
+	{
+	EventBits_t uxBitsToSet, uxBitsToClear;
+
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+
+		The outermost unlock applies the bits interrupts set or cleared while
+		the event group was locked, with the event group still locked, until
+		no interrupt changed the bits in the meantime. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				uxBitsToSet = pxEventBits->uxBitsSetFromISR;
+				uxBitsToClear = pxEventBits->uxBitsClearedFromISR;
+
+				if( ( pxEventBits->uxLocked == ( UBaseType_t ) 1 ) && ( ( uxBitsToSet | uxBitsToClear ) != ( EventBits_t ) 0 ) )
+				{
+					pxEventBits->uxBitsSetFromISR = ( EventBits_t ) 0;
+					pxEventBits->uxBitsClearedFromISR = ( EventBits_t ) 0;
+				}
+				else
+				{
+					( pxEventBits->uxLocked )--;
+					uxBitsToSet = ( EventBits_t ) 0;
+					uxBitsToClear = ( EventBits_t ) 0;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( ( uxBitsToSet | uxBitsToClear ) == ( EventBits_t ) 0 )
+			{
+				break;
+			}
+
+			/* The bits set by interrupts are applied first, so a set followed
+			by a clear still unblocks the tasks waiting for the bits. */
+			if( uxBitsToSet != ( EventBits_t ) 0 )
+			{
+				( void ) prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet, pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxEventBits->uxEventBits &= ~uxBitsToClear;
+		}
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReturn = pdPASS;
+	BaseType_t xDefer = pdFALSE;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxEventBits->uxLocked != ( UBaseType_t ) 0 )
+			{
+				/* A task is accessing the list of waiting tasks, it sets the
+				bits and unblocks the waiting tasks when it unlocks the event
+				group.  A clear recorded before is overridden by this set. */
+				pxEventBits->uxBitsSetFromISR |= uxBitsToSet;
+				pxEventBits->uxBitsClearedFromISR &= ~uxBitsToSet;
+			}
+			#if( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+			else if( listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits ) ) > ( UBaseType_t ) configEVENT_GROUP_ISR_MAX_WAITERS )
+			{
+				/* Too many waiting tasks to walk with interrupts masked, the
+				timer service task sets the bits as without the direct path. */
+				xDefer = pdTRUE;
+			}
+			#endif
+			else
+			{
+				if( prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet, pdTRUE ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		#if( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+		{
+			if( xDefer != pdFALSE )
+			{
+				xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
+		/* Prevent compiler warnings when the timers are not used. */
+		( void ) xDefer;
+
+		return xReturn;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
 	{
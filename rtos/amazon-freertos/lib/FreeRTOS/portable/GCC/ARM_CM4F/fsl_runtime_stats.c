@@ -0,0 +1,498 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Run time stats clocked by the DWT cycle counter, see fsl_runtime_stats.h. */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_STATS_USE_DWT ) && ( configRUN_TIME_STATS_USE_DWT == 1 )
+
+extern uint32_t SystemCoreClock; /* in Kinetis SDK, this contains the system core clock speed */
+
+/* Constants required to manipulate the core. */
+#define portDEMCR_REG						( * ( ( volatile uint32_t * ) 0xE000EDFC ) )
+#define portDWT_CTRL_REG					( * ( ( volatile uint32_t * ) 0xE0001000 ) )
+#define portDWT_CYCCNT_REG					( * ( ( volatile uint32_t * ) 0xE0001004 ) )
+#define portSCB_VTOR_REG					( * ( ( volatile uint32_t * ) 0xE000ED08 ) )
+#define portDEMCR_TRCENA_BIT				( 1UL << 24UL )
+#define portDWT_CTRL_CYCCNTENA_BIT			( 1UL << 0UL )
+
+/* SysTick and the external interrupts are wrapped.  SVCall and PendSV are not,
+their handlers depend on the exception entry state, and the time spent in
+PendSV is charged to the tasks. */
+#define portFIRST_WRAPPED_VECTOR			( 15UL )
+#define portFIRST_IRQ_VECTOR				( 16UL )
+#define portVECTOR_NUMBER_MASK				( 0x1FFUL )
+
+/* Deepest interrupt nesting, one level per implemented priority. */
+#define portMAX_ISR_NESTING					( 16UL )
+
+#if ( configRUN_TIME_STATS_VECTOR_COUNT * 4 ) > configRUN_TIME_STATS_VECTOR_TABLE_ALIGNMENT
+	#error configRUN_TIME_STATS_VECTOR_TABLE_ALIGNMENT must be at least the size of the vector table.
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* 64-bit extension of CYCCNT.  ullCyclesOffset holds the cycles the counter
+missed while the core was sleeping. */
+static uint32_t ulLastCycles = 0UL;
+static uint32_t ulCyclesHigh = 0UL;
+static uint64_t ullCyclesOffset = 0ULL;
+static uint64_t ullStartCycles = 0ULL;
+
+/* Sleep accounting. */
+static uint64_t ullSleepStart = 0ULL;
+static uint64_t ullSleepTime = 0ULL;
+static uint64_t ullLastSleepTime = 0ULL;
+static BaseType_t xSleepStepPending = pdFALSE;
+
+/* Interrupt accounting, by vector number. */
+static uint64_t ullIsrTime = 0ULL;
+static uint64_t ullVectorTime[ configRUN_TIME_STATS_VECTOR_COUNT ];
+static uint32_t ulVectorCount[ configRUN_TIME_STATS_VECTOR_COUNT ];
+
+#if( configRUN_TIME_STATS_WRAP_ISRS == 1 )
+	typedef void ( *IsrHandler_t )( void );
+
+	/* Vectors of the nested handlers, and when the innermost one was last
+	charged. */
+	static uint8_t ucIsrStack[ portMAX_ISR_NESTING ];
+	static uint32_t ulIsrNesting = 0UL;
+	static uint64_t ullIsrLast = 0ULL;
+
+	static IsrHandler_t pxIsrHandlers[ configRUN_TIME_STATS_VECTOR_COUNT ];
+	static uint32_t ulVectorTable[ configRUN_TIME_STATS_VECTOR_COUNT ] __attribute__( ( aligned( configRUN_TIME_STATS_VECTOR_TABLE_ALIGNMENT ) ) );
+#endif /* configRUN_TIME_STATS_WRAP_ISRS */
+
+/*-----------------------------------------------------------*/
+
+/* The accounting is shared with interrupts of any priority, the short sections
+updating it mask all of them. */
+portFORCE_INLINE static uint32_t prvMaskAllInterrupts( void )
+{
+uint32_t ulPrimask;
+
+	__asm volatile
+	(
+		"	mrs %0, primask	\n"
+		"	cpsid i			\n"
+		: "=r" ( ulPrimask ) :: "memory"
+	);
+	return ulPrimask;
+}
+/*-----------------------------------------------------------*/
+
+portFORCE_INLINE static void prvRestoreInterrupts( uint32_t ulPrimask )
+{
+	__asm volatile
+	(
+		"	msr primask, %0	" :: "r" ( ulPrimask ) : "memory"
+	);
+}
+/*-----------------------------------------------------------*/
+
+/* Must be called with all interrupts masked, and at least once per wrap of
+CYCCNT, which the tick takes care of. */
+static uint64_t prvReadCycles( void )
+{
+uint32_t ulNow = portDWT_CYCCNT_REG;
+
+	if( ulNow < ulLastCycles )
+	{
+		ulCyclesHigh++;
+	}
+	ulLastCycles = ulNow;
+
+	return ( ( ( ( uint64_t ) ulCyclesHigh ) << 32ULL ) | ulNow ) + ullCyclesOffset;
+}
+/*-----------------------------------------------------------*/
+
+#if( configRUN_TIME_STATS_WRAP_ISRS == 1 )
+
+	static void prvIsrEnter( uint32_t ulVector )
+	{
+	uint32_t ulPrimask = prvMaskAllInterrupts();
+	uint64_t ullNow = prvReadCycles();
+
+		configASSERT( ulIsrNesting < portMAX_ISR_NESTING );
+
+		/* Charge the preempted handler up to now. */
+		if( ulIsrNesting > 0UL )
+		{
+			ullVectorTime[ ucIsrStack[ ulIsrNesting - 1UL ] ] += ullNow - ullIsrLast;
+			ullIsrTime += ullNow - ullIsrLast;
+		}
+
+		ucIsrStack[ ulIsrNesting++ ] = ( uint8_t ) ulVector;
+		ulVectorCount[ ulVector ]++;
+		ullIsrLast = ullNow;
+
+		prvRestoreInterrupts( ulPrimask );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvIsrExit( uint32_t ulVector )
+	{
+	uint32_t ulPrimask = prvMaskAllInterrupts();
+	uint64_t ullNow = prvReadCycles();
+
+		ullVectorTime[ ulVector ] += ullNow - ullIsrLast;
+		ullIsrTime += ullNow - ullIsrLast;
+		ulIsrNesting--;
+
+		/* The preempted handler, if any, runs again from now. */
+		ullIsrLast = ullNow;
+
+		prvRestoreInterrupts( ulPrimask );
+	}
+	/*-----------------------------------------------------------*/
+
+	/* Entry of every wrapped vector, runs the original handler of the active
+	exception between the accounting calls. */
+	static void prvIsrWrapper( void )
+	{
+	uint32_t ulVector;
+
+		__asm volatile ( "mrs %0, ipsr" : "=r" ( ulVector ) );
+		ulVector &= portVECTOR_NUMBER_MASK;
+
+		prvIsrEnter( ulVector );
+		pxIsrHandlers[ ulVector ]();
+		prvIsrExit( ulVector );
+
+		/* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
+		exception return operation might vector to incorrect interrupt */
+		__asm volatile ( "dsb" ::: "memory" );
+	}
+
+#endif /* configRUN_TIME_STATS_WRAP_ISRS */
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsInstallIsrWrapper( void )
+{
+#if( configRUN_TIME_STATS_WRAP_ISRS == 1 )
+	const uint32_t *pulTable = ( const uint32_t * ) portSCB_VTOR_REG;
+	uint32_t ulVector, ulEntry, ulPrimask;
+
+	ulPrimask = prvMaskAllInterrupts();
+
+	/* The current table may already be the RAM table, when the wrapper is
+	installed again after handlers were replaced in it. */
+	for( ulVector = 0UL; ulVector < configRUN_TIME_STATS_VECTOR_COUNT; ulVector++ )
+	{
+		ulEntry = pulTable[ ulVector ];
+
+		if( ( ulVector >= portFIRST_WRAPPED_VECTOR ) && ( ulEntry != ( uint32_t ) prvIsrWrapper ) )
+		{
+			pxIsrHandlers[ ulVector ] = ( IsrHandler_t ) ulEntry;
+			ulEntry = ( uint32_t ) prvIsrWrapper;
+		}
+
+		ulVectorTable[ ulVector ] = ulEntry;
+	}
+
+	__asm volatile ( "dsb" ::: "memory" );
+	portSCB_VTOR_REG = ( uint32_t ) ulVectorTable;
+	__asm volatile ( "dsb" ::: "memory" );
+	__asm volatile ( "isb" );
+
+	prvRestoreInterrupts( ulPrimask );
+#endif /* configRUN_TIME_STATS_WRAP_ISRS */
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsInit( void )
+{
+uint32_t ulPrimask;
+
+	portDEMCR_REG |= portDEMCR_TRCENA_BIT;
+	portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+
+	ulPrimask = prvMaskAllInterrupts();
+	ulLastCycles = portDWT_CYCCNT_REG;
+	ulCyclesHigh = 0UL;
+	ullCyclesOffset = 0ULL;
+	ullStartCycles = prvReadCycles();
+	prvRestoreInterrupts( ulPrimask );
+
+	vPortRunTimeStatsInstallIsrWrapper();
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortRunTimeStatsGetCycles( void )
+{
+uint32_t ulPrimask = prvMaskAllInterrupts();
+uint64_t ullNow = prvReadCycles() - ullStartCycles;
+
+	prvRestoreInterrupts( ulPrimask );
+	return ullNow;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortRunTimeStatsGetTaskTime( void )
+{
+uint32_t ulPrimask = prvMaskAllInterrupts();
+uint64_t ullNow = prvReadCycles() - ullStartCycles - ullIsrTime;
+
+	prvRestoreInterrupts( ulPrimask );
+	return ullNow;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortRunTimeStatsGetIsrTime( uint32_t ulVector, uint32_t *pulCount )
+{
+uint32_t ulPrimask;
+uint64_t ullTime;
+
+	configASSERT( ulVector < configRUN_TIME_STATS_VECTOR_COUNT );
+
+	ulPrimask = prvMaskAllInterrupts();
+	ullTime = ullVectorTime[ ulVector ];
+	if( pulCount != NULL )
+	{
+		*pulCount = ulVectorCount[ ulVector ];
+	}
+	prvRestoreInterrupts( ulPrimask );
+
+	return ullTime;
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsGetSnapshot( RunTimeStatsSnapshot_t *pxSnapshot )
+{
+uint32_t ulPrimask;
+
+	configASSERT( pxSnapshot );
+
+	ulPrimask = prvMaskAllInterrupts();
+	pxSnapshot->ullTime = prvReadCycles() - ullStartCycles;
+	pxSnapshot->ullIsrTime = ullIsrTime;
+	pxSnapshot->ullTaskTime = pxSnapshot->ullTime - ullIsrTime;
+	pxSnapshot->ullSleepTime = ullSleepTime;
+	prvRestoreInterrupts( ulPrimask );
+
+	#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	{
+		pxSnapshot->ullIdleTime = ulTaskGetIdleRunTimeCounter();
+	}
+	#else
+	{
+		pxSnapshot->ullIdleTime = 0ULL;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsSleepEnter( void )
+{
+uint32_t ulPrimask = prvMaskAllInterrupts();
+
+	ullSleepStart = prvReadCycles();
+	prvRestoreInterrupts( ulPrimask );
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsSleepExit( void )
+{
+uint32_t ulPrimask = prvMaskAllInterrupts();
+
+	ullLastSleepTime = prvReadCycles() - ullSleepStart;
+	ullSleepTime += ullLastSleepTime;
+	xSleepStepPending = pdTRUE;
+	prvRestoreInterrupts( ulPrimask );
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunTimeStatsStepTick( TickType_t xTicksToJump )
+{
+uint32_t ulPrimask = prvMaskAllInterrupts();
+uint64_t ullStepped;
+
+	/* The ticks stepped after a sleep tell how long it lasted.  When the cycle
+	counter was stopped or slowed down by a lower core clock, it is behind by
+	the difference, which is added to the counter and to the sleep time. */
+	if( xSleepStepPending != pdFALSE )
+	{
+		xSleepStepPending = pdFALSE;
+		ullStepped = ( uint64_t ) xTicksToJump * ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+
+		if( ullStepped > ullLastSleepTime )
+		{
+			ullCyclesOffset += ullStepped - ullLastSleepTime;
+			ullSleepTime += ullStepped - ullLastSleepTime;
+		}
+	}
+
+	prvRestoreInterrupts( ulPrimask );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	/* Run time counters at the previous report. */
+	typedef struct xREPORT_TASK
+	{
+		UBaseType_t xTaskNumber;
+		uint64_t ullRunTime;
+	} ReportTask_t;
+
+	static TaskStatus_t xReportStatus[ configRUN_TIME_STATS_REPORT_MAX_TASKS ];
+	static ReportTask_t xReportTasks[ configRUN_TIME_STATS_REPORT_MAX_TASKS ];
+	static UBaseType_t uxReportTaskCount = 0;
+	static uint64_t ullReportVectorTime[ configRUN_TIME_STATS_VECTOR_COUNT ];
+	static uint32_t ulReportVectorCount[ configRUN_TIME_STATS_VECTOR_COUNT ];
+	static RunTimeStatsSnapshot_t xReportLast;
+
+	/* Share of ullTotal in 1/10 %. */
+	static uint32_t prvPermille( uint64_t ullPart, uint64_t ullTotal )
+	{
+		return ( uint32_t ) ( ( ullPart * 1000ULL + ( ullTotal / 2ULL ) ) / ullTotal );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortRunTimeStatsReport( RunTimeStatsOutput_t pxOutput )
+	{
+	RunTimeStatsSnapshot_t xNow;
+	UBaseType_t uxCount, x, y;
+	uint64_t ullPeriod, ullTime, ullLast;
+	uint32_t ulVector, ulCount, ulPermille, ulPrimask;
+	char cLine[ 80 ];
+
+		configASSERT( pxOutput );
+
+		/* Returns 0 when there are more tasks than
+		configRUN_TIME_STATS_REPORT_MAX_TASKS, only the totals and the
+		interrupts are reported then. */
+		uxCount = uxTaskGetSystemState( xReportStatus, configRUN_TIME_STATS_REPORT_MAX_TASKS, NULL );
+		vPortRunTimeStatsGetSnapshot( &xNow );
+
+		ullPeriod = xNow.ullTime - xReportLast.ullTime;
+		if( ullPeriod == 0ULL )
+		{
+			return;
+		}
+
+		snprintf( cLine, sizeof( cLine ), "load: %u ms, tasks %u.%u%%, isr %u.%u%%, sleep %u.%u%%",
+				  ( unsigned int ) ( ullPeriod / ( configCPU_CLOCK_HZ / 1000UL ) ),
+				  ( unsigned int ) ( prvPermille( xNow.ullTaskTime - xReportLast.ullTaskTime, ullPeriod ) / 10UL ),
+				  ( unsigned int ) ( prvPermille( xNow.ullTaskTime - xReportLast.ullTaskTime, ullPeriod ) % 10UL ),
+				  ( unsigned int ) ( prvPermille( xNow.ullIsrTime - xReportLast.ullIsrTime, ullPeriod ) / 10UL ),
+				  ( unsigned int ) ( prvPermille( xNow.ullIsrTime - xReportLast.ullIsrTime, ullPeriod ) % 10UL ),
+				  ( unsigned int ) ( prvPermille( xNow.ullSleepTime - xReportLast.ullSleepTime, ullPeriod ) / 10UL ),
+				  ( unsigned int ) ( prvPermille( xNow.ullSleepTime - xReportLast.ullSleepTime, ullPeriod ) % 10UL ) );
+		pxOutput( cLine );
+
+		for( x = 0; x < uxCount; x++ )
+		{
+			/* Tasks created since the previous report start from 0. */
+			ullLast = 0ULL;
+			for( y = 0; y < uxReportTaskCount; y++ )
+			{
+				if( xReportTasks[ y ].xTaskNumber == xReportStatus[ x ].xTaskNumber )
+				{
+					ullLast = xReportTasks[ y ].ullRunTime;
+					break;
+				}
+			}
+
+			ulPermille = prvPermille( xReportStatus[ x ].ulRunTimeCounter - ullLast, ullPeriod );
+			snprintf( cLine, sizeof( cLine ), "task %-*s %3u.%u%%", configMAX_TASK_NAME_LEN, xReportStatus[ x ].pcTaskName,
+					  ( unsigned int ) ( ulPermille / 10UL ), ( unsigned int ) ( ulPermille % 10UL ) );
+			pxOutput( cLine );
+		}
+
+		for( x = 0; x < uxCount; x++ )
+		{
+			xReportTasks[ x ].xTaskNumber = xReportStatus[ x ].xTaskNumber;
+			xReportTasks[ x ].ullRunTime = xReportStatus[ x ].ulRunTimeCounter;
+		}
+		uxReportTaskCount = uxCount;
+
+		for( ulVector = portFIRST_WRAPPED_VECTOR; ulVector < configRUN_TIME_STATS_VECTOR_COUNT; ulVector++ )
+		{
+			ulPrimask = prvMaskAllInterrupts();
+			ullTime = ullVectorTime[ ulVector ];
+			ulCount = ulVectorCount[ ulVector ];
+			prvRestoreInterrupts( ulPrimask );
+
+			if( ulCount != ulReportVectorCount[ ulVector ] )
+			{
+				ulPermille = prvPermille( ullTime - ullReportVectorTime[ ulVector ], ullPeriod );
+				if( ulVector < portFIRST_IRQ_VECTOR )
+				{
+					snprintf( cLine, sizeof( cLine ), "isr  SysTick    %3u.%u%% %u calls", ( unsigned int ) ( ulPermille / 10UL ),
+							  ( unsigned int ) ( ulPermille % 10UL ), ( unsigned int ) ( ulCount - ulReportVectorCount[ ulVector ] ) );
+				}
+				else
+				{
+					snprintf( cLine, sizeof( cLine ), "isr  IRQ %-5u %3u.%u%% %u calls", ( unsigned int ) ( ulVector - portFIRST_IRQ_VECTOR ),
+							  ( unsigned int ) ( ulPermille / 10UL ), ( unsigned int ) ( ulPermille % 10UL ),
+							  ( unsigned int ) ( ulCount - ulReportVectorCount[ ulVector ] ) );
+				}
+				pxOutput( cLine );
+			}
+
+			ullReportVectorTime[ ulVector ] = ullTime;
+			ulReportVectorCount[ ulVector ] = ulCount;
+		}
+
+		xReportLast = xNow;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configUSE_TIMERS == 1 )
+
+		static void prvReportTimerCallback( TimerHandle_t xTimer )
+		{
+			vPortRunTimeStatsReport( ( RunTimeStatsOutput_t ) pvTimerGetTimerID( xTimer ) );
+		}
+		/*-----------------------------------------------------------*/
+
+		BaseType_t xPortRunTimeStatsStartReport( TickType_t xPeriod, RunTimeStatsOutput_t pxOutput )
+		{
+		TimerHandle_t xTimer;
+
+			configASSERT( pxOutput );
+
+			xTimer = xTimerCreate( "Load", xPeriod, pdTRUE, ( void * ) pxOutput, prvReportTimerCallback );
+			if( xTimer == NULL )
+			{
+				return pdFAIL;
+			}
+
+			return xTimerStart( xTimer, 0 );
+		}
+
+	#endif /* configUSE_TIMERS */
+
+#endif /* configUSE_TRACE_FACILITY */
+
+#endif /* configRUN_TIME_STATS_USE_DWT */
@@ -0,0 +1,170 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Run time stats clocked by the DWT cycle counter, added to the port by SDK team.
+
+Enabled with configGENERATE_RUN_TIME_STATS and configRUN_TIME_STATS_USE_DWT both
+set to 1 in FreeRTOSConfig.h.  The 32-bit DWT->CYCCNT is extended to 64 bits and
+drives the kernel run time counters, which are then 64-bit too, so they do not
+wrap after a few seconds at the core clock.
+
+All times are in core clock cycles:
+- the run time counter of a task does not include the interrupts that
+  preempted it, when the interrupt handlers are wrapped (see below);
+- the time spent in each interrupt handler is accounted by vector number, by a
+  wrapper installed in a copy of the vector table in RAM;
+- the time spent in portSUPPRESS_TICKS_AND_SLEEP() is accounted as sleep time
+  and charged to the idle task.  When the cycle counter stops while the core
+  sleeps, the time is taken from the ticks stepped after the sleep. */
+
+#ifndef FSL_RUNTIME_STATS_H
+#define FSL_RUNTIME_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of entries of the vector table, NUMBER_OF_INT_VECTORS of the device
+header.  It must not be less than the size of the table used by the device. */
+#ifndef configRUN_TIME_STATS_VECTOR_COUNT
+	#define configRUN_TIME_STATS_VECTOR_COUNT	144
+#endif
+
+/* Alignment of the RAM vector table, the table size rounded up to a power of
+two. */
+#ifndef configRUN_TIME_STATS_VECTOR_TABLE_ALIGNMENT
+	#define configRUN_TIME_STATS_VECTOR_TABLE_ALIGNMENT	1024
+#endif
+
+/* Set to 0 to leave the vector table alone, no interrupt time is then accounted
+and the task run time counters include the interrupts. */
+#ifndef configRUN_TIME_STATS_WRAP_ISRS
+	#define configRUN_TIME_STATS_WRAP_ISRS	1
+#endif
+
+/* Number of tasks covered by the load report, the task lines are omitted when
+there are more tasks. */
+#ifndef configRUN_TIME_STATS_REPORT_MAX_TASKS
+	#define configRUN_TIME_STATS_REPORT_MAX_TASKS	16
+#endif
+
+/* Hooks into the kernel. */
+#ifndef configRUN_TIME_COUNTER_TYPE
+	#define configRUN_TIME_COUNTER_TYPE	uint64_t
+#endif
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	vPortRunTimeStatsInit()
+#endif
+#ifndef portGET_RUN_TIME_COUNTER_VALUE
+	#define portGET_RUN_TIME_COUNTER_VALUE()	ullPortRunTimeStatsGetTaskTime()
+#endif
+/* Reads the counter every tick so the wraps of CYCCNT are not missed. */
+#ifndef traceTASK_INCREMENT_TICK
+	#define traceTASK_INCREMENT_TICK( xTickCount )	( void ) ullPortRunTimeStatsGetCycles()
+#endif
+#ifndef traceINCREASE_TICK_COUNT
+	#define traceINCREASE_TICK_COUNT( xTicksToJump )	vPortRunTimeStatsStepTick( xTicksToJump )
+#endif
+
+/* Called by portSUPPRESS_TICKS_AND_SLEEP() implementations around the sleep,
+with interrupts disabled. */
+#define portRUN_TIME_STATS_SLEEP_ENTER()	vPortRunTimeStatsSleepEnter()
+#define portRUN_TIME_STATS_SLEEP_EXIT()		vPortRunTimeStatsSleepExit()
+
+/* Global times, see vPortRunTimeStatsGetSnapshot(). */
+typedef struct xRUN_TIME_STATS_SNAPSHOT
+{
+	uint64_t ullTime;			/* Cycles since the scheduler was started, sleep included. */
+	uint64_t ullTaskTime;		/* Cycles spent in tasks, the idle task included. */
+	uint64_t ullIdleTime;		/* Cycles spent in the idle task, sleep included.  Only valid when INCLUDE_xTaskGetIdleTaskHandle is 1. */
+	uint64_t ullSleepTime;		/* Cycles spent in portSUPPRESS_TICKS_AND_SLEEP(). */
+	uint64_t ullIsrTime;		/* Cycles spent in the wrapped interrupt handlers. */
+} RunTimeStatsSnapshot_t;
+
+/* Receives the lines of the load report, without line ending. */
+typedef void ( *RunTimeStatsOutput_t )( const char *pcLine );
+
+/*
+ * Enables the cycle counter and installs the interrupt wrapper, called by
+ * vTaskStartScheduler() through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS().
+ */
+void vPortRunTimeStatsInit( void );
+
+/*
+ * Points VTOR to a RAM copy of the current vector table in which SysTick and
+ * the external interrupts go through the accounting wrapper.  It must be called
+ * again after the vector table was changed, InstallIRQHandler() for example.
+ */
+void vPortRunTimeStatsInstallIsrWrapper( void );
+
+/*
+ * Cycles since the scheduler was started, sleep included.
+ */
+uint64_t ullPortRunTimeStatsGetCycles( void );
+
+/*
+ * Cycles spent in tasks since the scheduler was started, the run time stats
+ * clock of the kernel.
+ */
+uint64_t ullPortRunTimeStatsGetTaskTime( void );
+
+/*
+ * Cycles spent in the handler of a vector (IRQn + 16), excluding the nested
+ * interrupts.  The number of calls of the handler is returned in *pulCount
+ * when pulCount is not NULL.
+ */
+uint64_t ullPortRunTimeStatsGetIsrTime( uint32_t ulVector, uint32_t *pulCount );
+
+/*
+ * Reads the global times in one go.
+ */
+void vPortRunTimeStatsGetSnapshot( RunTimeStatsSnapshot_t *pxSnapshot );
+
+/*
+ * Writes the CPU load of each task and interrupt since the previous call, one
+ * line per call of pxOutput.  Needs configUSE_TRACE_FACILITY set to 1 and is
+ * not reentrant.
+ */
+void vPortRunTimeStatsReport( RunTimeStatsOutput_t pxOutput );
+
+/*
+ * Calls vPortRunTimeStatsReport() every xPeriod ticks from the timer service
+ * task.  Needs configUSE_TIMERS set to 1, returns pdFAIL when the timer could
+ * not be created or started.
+ */
+BaseType_t xPortRunTimeStatsStartReport( TickType_t xPeriod, RunTimeStatsOutput_t pxOutput );
+
+/* Kernel and port hooks, see above. */
+void vPortRunTimeStatsSleepEnter( void );
+void vPortRunTimeStatsSleepExit( void );
+void vPortRunTimeStatsStepTick( TickType_t xTicksToJump );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FSL_RUNTIME_STATS_H */
@@ -133,6 +133,7 @@ extern uint32_t SystemCoreClock; /* in Kinetis SDK, this contains the system cor
 			should not be executed again.  However, the original expected idle
 			time variable must remain unmodified, so a copy is taken. */
 			xModifiableIdleTime = xExpectedIdleTime;
+			portRUN_TIME_STATS_SLEEP_ENTER();
 			configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
 			if( xModifiableIdleTime > 0 )
 			{
@@ -141,6 +142,7 @@ extern uint32_t SystemCoreClock; /* in Kinetis SDK, this contains the system cor
 				__asm volatile( "isb" );
 			}
 			configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+			portRUN_TIME_STATS_SLEEP_EXIT();
 
 			/* Re-enable interrupts to allow the interrupt that brought the MCU
 			out of sleep mode to execute immediately.  see comments above
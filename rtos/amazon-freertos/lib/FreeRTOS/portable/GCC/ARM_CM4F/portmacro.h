@@ -119,6 +119,15 @@ not necessary for to use this port.  They are defined so the common demo files
 #endif
 /*-----------------------------------------------------------*/
 
+/* Run time stats clocked by the DWT cycle counter. */
+#if ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( configRUN_TIME_STATS_USE_DWT ) && ( configRUN_TIME_STATS_USE_DWT == 1 )
+	#include "fsl_runtime_stats.h"
+#else
+	#define portRUN_TIME_STATS_SLEEP_ENTER()
+	#define portRUN_TIME_STATS_SLEEP_EXIT()
+#endif
+/*-----------------------------------------------------------*/
+
 /* Architecture specific optimisations. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
@@ -233,6 +242,34 @@ portFORCE_INLINE static void vPortSetBASEPRI( uint32_t ulNewMaskValue )
 }
 /*-----------------------------------------------------------*/
 
+/* Atomically replaces *pulDestination with ulNewValue if it still holds
+ulExpectedValue, returns pdTRUE when the value was replaced.  The exclusive
+monitor is cleared on exception entry and return, so an interrupt that runs
+between LDREX and STREX makes the store fail and the sequence is retried.  Used
+by the lock free block pools, see block_pool.c. */
+#define portHAS_COMPARE_AND_SWAP_U32	1
+
+portFORCE_INLINE static BaseType_t xPortCompareAndSwapU32( volatile uint32_t *pulDestination, uint32_t ulExpectedValue, uint32_t ulNewValue )
+{
+uint32_t ulCurrentValue, ulStoreFailed;
+
+	do
+	{
+		__asm volatile ( "ldrex %0, [%1]" : "=r" ( ulCurrentValue ) : "r" ( pulDestination ) : "memory" );
+
+		if( ulCurrentValue != ulExpectedValue )
+		{
+			__asm volatile ( "clrex" ::: "memory" );
+			return pdFALSE;
+		}
+
+		__asm volatile ( "strex %0, %2, [%1]" : "=&r" ( ulStoreFailed ) : "r" ( pulDestination ), "r" ( ulNewValue ) : "memory" );
+	} while( ulStoreFailed != 0 );
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,437 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX host port.
+ *
+ * Each task is a pthread that waits on its own event until the scheduler
+ * selects it, so that exactly one task thread runs at any time. A context
+ * switch resumes the thread of the new task and suspends the calling one.
+ *
+ * The tick interrupt is SIGALRM from an interval timer. It is delivered to
+ * the running task thread, like an interrupt preempting the running task,
+ * and disabling interrupts blocks SIGALRM in that thread. All other threads
+ * (suspended tasks, the thread that started the scheduler) keep SIGALRM
+ * blocked.
+ *
+ * Task code must not be preempted while holding a host library lock that
+ * another task may take (stdio, malloc), as the preempted thread will not
+ * release it before it runs again. Keep such calls to one task or wrap
+ * them in a critical section.
+ *----------------------------------------------------------*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 in FreeRTOSConfig.h to use the POSIX port.
+#endif
+
+/* Stack size of the host thread backing each task, the FreeRTOS stack of
+the task only holds the thread control block. */
+#ifndef portTHREAD_STACK_SIZE
+	#define portTHREAD_STACK_SIZE	( 256U * 1024U )
+#endif
+
+/* Event a thread waits on until another thread signals it. */
+typedef struct EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	BaseType_t xSignalled;
+} Event_t;
+
+/* Host thread of a task, kept at the top of the task stack. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParams;
+	volatile BaseType_t xDying;
+	Event_t xEvent;
+} Thread_t;
+
+/* Critical section nesting of the running task, saved across switches. */
+static volatile UBaseType_t uxCriticalNesting = 0;
+
+/* Set of the tick interrupt signal. */
+static sigset_t xTickSignal;
+
+/* Thread that started the scheduler, woken by vPortEndScheduler(). */
+static Event_t xSchedulerEndEvent;
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+
+static void prvEventInit( Event_t *pxEvent );
+static void prvEventDelete( Event_t *pxEvent );
+static void prvEventWait( Event_t *pxEvent );
+static void prvEventSignal( Event_t *pxEvent );
+static void *prvWaitForStart( void *pvParams );
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+static void prvSetupTimerInterrupt( void );
+static void prvSystemTickHandler( int iSignal );
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( TaskHandle_t xTask )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) xTask;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( Event_t *pxEvent )
+{
+	pthread_mutex_init( &pxEvent->xMutex, NULL );
+	pthread_cond_init( &pxEvent->xCond, NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( Event_t *pxEvent )
+{
+	pthread_cond_destroy( &pxEvent->xCond );
+	pthread_mutex_destroy( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventUnlock( void *pvMutex )
+{
+	pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+
+	/* A suspended task thread is cancelled when the task is deleted. */
+	pthread_cleanup_push( prvEventUnlock, &pxEvent->xMutex );
+	while( pxEvent->xSignalled == pdFALSE )
+	{
+		pthread_cond_wait( &pxEvent->xCond, &pxEvent->xMutex );
+	}
+	pxEvent->xSignalled = pdFALSE;
+	pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+	pxEvent->xSignalled = pdTRUE;
+	pthread_cond_signal( &pxEvent->xCond );
+	pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xThreadAttributes;
+int iRet;
+
+	/* The thread control block takes the top of the stack. */
+	pxThread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxTopOfStack = ( StackType_t * ) pxThread - 1;
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParams = pvParameters;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &pxThread->xEvent );
+
+	pthread_attr_init( &xThreadAttributes );
+	pthread_attr_setstacksize( &xThreadAttributes, portTHREAD_STACK_SIZE );
+
+	/* The new thread inherits the blocked tick signal and waits to be
+	scheduled. */
+	vPortEnterCritical();
+	iRet = pthread_create( &pxThread->xThread, &xThreadAttributes, prvWaitForStart, pxThread );
+	vPortExitCritical();
+
+	pthread_attr_destroy( &xThreadAttributes );
+	configASSERT( iRet == 0 );
+	( void ) iRet;
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParams )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParams;
+
+	prvEventWait( &pxThread->xEvent );
+
+	/* Scheduled for the first time, outside of any critical section. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParams );
+
+	/* Tasks must not return. */
+	configASSERT( pdFALSE );
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+	/* Interrupts are disabled in the calling thread, it will keep the tick
+	signal blocked from now on. */
+	prvEventInit( &xSchedulerEndEvent );
+
+	prvSetupTimerInterrupt();
+
+	/* Start the first task. */
+	prvEventSignal( &( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->xEvent ) );
+
+	/* Wait until vPortEndScheduler() is called. */
+	while( xSchedulerEnd == pdFALSE )
+	{
+		prvEventWait( &xSchedulerEndEvent );
+	}
+
+	prvEventDelete( &xSchedulerEndEvent );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+Thread_t *pxThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	memset( &xTimer, 0, sizeof( xTimer ) );
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	/* Return to the thread that started the scheduler, the calling task
+	never runs again. */
+	xSchedulerEnd = pdTRUE;
+	prvEventSignal( &xSchedulerEndEvent );
+
+	for( ;; )
+	{
+		prvEventWait( &pxThread->xEvent );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	vTaskSwitchContext();
+
+	pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+
+	vPortYieldFromISR();
+
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	pthread_sigmask( SIG_BLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	pthread_sigmask( SIG_UNBLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xPortSetInterruptMask( void )
+{
+sigset_t xOldMask;
+
+	pthread_sigmask( SIG_BLOCK, &xTickSignal, &xOldMask );
+
+	return ( UBaseType_t ) sigismember( &xOldMask, SIGALRM );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t xMask )
+{
+	if( xMask == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		vPortDisableInterrupts();
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pvTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+Thread_t *pxThread = prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete );
+
+	/* The thread exits on its next switch away, vTaskDelete() yields
+	right after this hook. */
+	pxThread->xDying = pdTRUE;
+	( void ) pxPendYield;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pvTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete );
+
+	/* The thread is not running, it either exited already or is
+	suspended on its event. */
+	if( pxThread->xDying == pdFALSE )
+	{
+		pthread_cancel( pxThread->xThread );
+	}
+	pthread_join( pxThread->xThread, NULL );
+	prvEventDelete( &pxThread->xEvent );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		/* The critical nesting count belongs to the task, keep it on the
+		stack of the suspended thread. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvEventSignal( &pxThreadToResume->xEvent );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			pthread_exit( NULL );
+		}
+
+		prvEventWait( &pxThreadToSuspend->xEvent );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSystemTickHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+int iSavedErrno = errno;
+
+	( void ) iSignal;
+
+	/* The tick signal is blocked while its handler runs. */
+	uxCriticalNesting++;
+
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+struct sigaction xTickAction;
+struct itimerval xTimer;
+
+	memset( &xTickAction, 0, sizeof( xTickAction ) );
+	xTickAction.sa_handler = prvSystemTickHandler;
+	xTickAction.sa_flags = SA_RESTART;
+	sigfillset( &xTickAction.sa_mask );
+	sigaction( SIGALRM, &xTickAction, NULL );
+
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = 1000000UL / configTICK_RATE_HZ;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Runs before main(), tasks may be created before the scheduler starts. */
+__attribute__( ( constructor ) ) static void prvPortInit( void )
+{
+	sigemptyset( &xTickSignal );
+	sigaddset( &xTickSignal, SIGALRM );
+}
+/*-----------------------------------------------------------*/
@@ -76,6 +76,7 @@ task.h is included from an application file. */
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "block_pool.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
@@ -83,6 +84,37 @@ task.h is included from an application file. */
 	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if( configHEAP_INSTRUMENTATION == 1 )
+	#include <stdio.h>
+
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) ) || ( ( INCLUDE_xTaskGetSchedulerState != 1 ) && ( configUSE_TIMERS != 1 ) )
+		#error configHEAP_INSTRUMENTATION needs INCLUDE_xTaskGetCurrentTaskHandle and INCLUDE_xTaskGetSchedulerState set to 1
+	#endif
+
+	/* The blocks of the block pools have no header to record the caller, task
+	and requested size in, xPortGetHeapConsumers() and the heap report would
+	miss them and the live totals would not add up. */
+	#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+		#error configHEAP_INSTRUMENTATION and configUSE_BLOCK_POOL_MALLOC cannot both be set to 1
+	#endif
+
+	/* Return address of the pvPortMalloc() call, recorded in each block. */
+	#ifndef configHEAP_GET_CALLER
+		#define configHEAP_GET_CALLER()		__builtin_return_address( 0 )
+	#endif
+
+	/* Number of consumers grouped by vPortHeapReport(), the groups beyond are
+	reported as untracked. */
+	#ifndef configHEAP_INSTRUMENTATION_REPORT_CONSUMERS
+		#define configHEAP_INSTRUMENTATION_REPORT_CONSUMERS	32
+	#endif
+
+	/* Number of tasks whose names vPortHeapReport() looks up. */
+	#ifndef configHEAP_INSTRUMENTATION_REPORT_TASKS
+		#define configHEAP_INSTRUMENTATION_REPORT_TASKS		16
+	#endif
+#endif /* configHEAP_INSTRUMENTATION */
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -95,6 +127,11 @@ typedef struct A_BLOCK_LINK
 {
 	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block in the list. */
 	size_t xBlockSize;						/*<< The size of the free block. */
+	#if( configHEAP_INSTRUMENTATION == 1 )
+		void *pvCaller;						/*<< Return address of the pvPortMalloc() call that allocated the block.  In the end marker of a region, the first block of the next region. */
+		void *pvTask;						/*<< The task that allocated the block. */
+		size_t xRequestedSize;				/*<< The size passed to pvPortMalloc(). */
+	#endif
 } BlockLink_t;
 
 /*-----------------------------------------------------------*/
@@ -127,17 +164,56 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+#if( configHEAP_INSTRUMENTATION == 1 )
+	/* The first block of the heap, the blocks follow each other up to the end marker of each region. */
+	static BlockLink_t *pxHeapStart = NULL;
+
+	static size_t xFailedAllocations = 0;
+	static size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ];
+
+	/*
+	 * Returns the size class of a size, see portHEAP_HISTOGRAM_BINS.
+	 */
+	static size_t prvHistogramBin( size_t xSize );
+
+	/*
+	 * Returns the block that follows pxBlock in memory, NULL after the last
+	 * block.
+	 */
+	static BlockLink_t *prvNextPhysicalBlock( BlockLink_t *pxBlock );
+#endif
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
 {
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+#if( configHEAP_INSTRUMENTATION == 1 )
+	size_t xRequestedSize = xWantedSize;
+#endif
 
 	/* The heap must be initialised before the first call to
 	prvPortMalloc(). */
 	configASSERT( pxEnd );
 
+	#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+	{
+		/* Small requests are served by the block pools registered with
+		xBlockPoolAddMallocClass() when one of them has a free block.  A
+		request for 0 bytes is left to the heap, which returns NULL. */
+		if( xWantedSize > 0 )
+		{
+			pvReturn = pvBlockPoolMalloc( xWantedSize );
+			if( pvReturn != NULL )
+			{
+				traceMALLOC( pvReturn, xWantedSize );
+				return pvReturn;
+			}
+		}
+	}
+	#endif /* configUSE_BLOCK_POOL_MALLOC */
+
 	vTaskSuspendAll();
 	{
 		/* Check the requested block size is not so large that the top bit is
@@ -231,6 +307,15 @@ void *pvReturn = NULL;
 					by the application and has no "next" block. */
 					pxBlock->xBlockSize |= xBlockAllocatedBit;
 					pxBlock->pxNextFreeBlock = NULL;
+
+					#if( configHEAP_INSTRUMENTATION == 1 )
+					{
+						pxBlock->pvCaller = configHEAP_GET_CALLER();
+						pxBlock->pvTask = ( xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED ) ? NULL : ( void * ) xTaskGetCurrentTaskHandle();
+						pxBlock->xRequestedSize = xRequestedSize;
+						xAllocationHistogram[ prvHistogramBin( xRequestedSize ) ]++;
+					}
+					#endif
 				}
 				else
 				{
@@ -247,6 +332,15 @@ void *pvReturn = NULL;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
+		#if( configHEAP_INSTRUMENTATION == 1 )
+		{
+			if( pvReturn == NULL )
+			{
+				xFailedAllocations++;
+			}
+		}
+		#endif
+
 		traceMALLOC( pvReturn, xWantedSize );
 	}
 	( void ) xTaskResumeAll();
@@ -276,6 +370,16 @@ BlockLink_t *pxLink;
 
 	if( pv != NULL )
 	{
+		#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+		{
+			if( xBlockPoolMallocFree( pv ) != pdFALSE )
+			{
+				traceFREE( pv, 0 );
+				return;
+			}
+		}
+		#endif /* configUSE_BLOCK_POOL_MALLOC */
+
 		/* The memory being freed will have an BlockLink_t structure immediately
 		before it. */
 		puc -= xHeapStructSize;
@@ -451,6 +555,11 @@ const HeapRegion_t *pxHeapRegion;
 		pxEnd = ( BlockLink_t * ) xAddress;
 		pxEnd->xBlockSize = 0;
 		pxEnd->pxNextFreeBlock = NULL;
+		#if( configHEAP_INSTRUMENTATION == 1 )
+		{
+			pxEnd->pvCaller = NULL;
+		}
+		#endif
 
 		/* To start with there is a single free block in this region that is
 		sized to take up the entire heap region minus the space taken by the
@@ -464,7 +573,21 @@ const HeapRegion_t *pxHeapRegion;
 		if( pxPreviousFreeBlock != NULL )
 		{
 			pxPreviousFreeBlock->pxNextFreeBlock = pxFirstFreeBlockInRegion;
+
+			#if( configHEAP_INSTRUMENTATION == 1 )
+			{
+				/* The end marker keeps the link to the next region, its
+				pxNextFreeBlock member changes with the free list. */
+				pxPreviousFreeBlock->pvCaller = ( void * ) pxFirstFreeBlockInRegion;
+			}
+			#endif
+		}
+		#if( configHEAP_INSTRUMENTATION == 1 )
+		else
+		{
+			pxHeapStart = pxFirstFreeBlockInRegion;
 		}
+		#endif
 
 		xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
 
@@ -482,4 +605,236 @@ const HeapRegion_t *pxHeapRegion;
 	/* Work out the position of the top bit in a size_t variable. */
 	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
 }
+/*-----------------------------------------------------------*/
+
+#if( configHEAP_INSTRUMENTATION == 1 )
+
+	static size_t prvHistogramBin( size_t xSize )
+	{
+	size_t xBin = 0;
+
+		while( ( xBin < ( size_t ) ( portHEAP_HISTOGRAM_BINS - 1 ) ) && ( xSize >= ( ( size_t ) 32 << xBin ) ) )
+		{
+			xBin++;
+		}
+
+		return xBin;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BlockLink_t *prvNextPhysicalBlock( BlockLink_t *pxBlock )
+	{
+	BlockLink_t *pxNext = ( void * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & ~xBlockAllocatedBit ) );
+
+		/* The end marker of a region links to the next region. */
+		if( pxNext->xBlockSize == 0 )
+		{
+			pxNext = ( BlockLink_t * ) pxNext->pvCaller;
+		}
+
+		return pxNext;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortGetHeapInstrumentationStats( HeapInstrumentationStats_t *pxStats )
+	{
+	BlockLink_t *pxBlock;
+	size_t xBin;
+
+		configASSERT( pxStats );
+
+		pxStats->xLargestFreeBlock = 0;
+		pxStats->xFreeBlockCount = 0;
+		pxStats->xLiveBlockCount = 0;
+		pxStats->xLiveRequestedBytes = 0;
+		pxStats->xLiveBlockBytes = 0;
+		for( xBin = 0; xBin < ( size_t ) portHEAP_HISTOGRAM_BINS; xBin++ )
+		{
+			pxStats->xFreeBlockHistogram[ xBin ] = 0;
+		}
+
+		vTaskSuspendAll();
+		{
+			if( pxEnd != NULL )
+			{
+				/* The free blocks are linked by address. */
+				for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+				{
+					/* Skip the end markers of the other regions, which have no
+					size. */
+					if( pxBlock->xBlockSize > 0 )
+					{
+						pxStats->xFreeBlockCount++;
+						pxStats->xFreeBlockHistogram[ prvHistogramBin( pxBlock->xBlockSize ) ]++;
+						if( pxBlock->xBlockSize > pxStats->xLargestFreeBlock )
+						{
+							pxStats->xLargestFreeBlock = pxBlock->xBlockSize;
+						}
+					}
+				}
+
+				/* The allocated blocks are only found by walking all the
+				blocks. */
+				for( pxBlock = pxHeapStart; pxBlock != NULL; pxBlock = prvNextPhysicalBlock( pxBlock ) )
+				{
+					if( ( pxBlock->xBlockSize & xBlockAllocatedBit ) != 0 )
+					{
+						pxStats->xLiveBlockCount++;
+						pxStats->xLiveRequestedBytes += pxBlock->xRequestedSize;
+						pxStats->xLiveBlockBytes += pxBlock->xBlockSize & ~xBlockAllocatedBit;
+					}
+				}
+			}
+
+			pxStats->xFreeBytes = xFreeBytesRemaining;
+			pxStats->xMinimumEverFreeBytes = xMinimumEverFreeBytesRemaining;
+			pxStats->xFailedAllocations = xFailedAllocations;
+			for( xBin = 0; xBin < ( size_t ) portHEAP_HISTOGRAM_BINS; xBin++ )
+			{
+				pxStats->xAllocationHistogram[ xBin ] = xAllocationHistogram[ xBin ];
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xPortGetHeapConsumers( HeapConsumer_t *pxConsumers, size_t xMaxConsumers, size_t *pxUntrackedBytes )
+	{
+	BlockLink_t *pxBlock;
+	HeapConsumer_t xSwap;
+	size_t xCount = 0, xUntracked = 0, x, y;
+
+		configASSERT( pxConsumers );
+
+		vTaskSuspendAll();
+		{
+			for( pxBlock = ( pxEnd != NULL ) ? pxHeapStart : NULL; pxBlock != NULL; pxBlock = prvNextPhysicalBlock( pxBlock ) )
+			{
+				if( ( pxBlock->xBlockSize & xBlockAllocatedBit ) == 0 )
+				{
+					continue;
+				}
+
+				for( x = 0; x < xCount; x++ )
+				{
+					if( ( pxConsumers[ x ].pvCaller == pxBlock->pvCaller ) && ( pxConsumers[ x ].pvTask == pxBlock->pvTask ) )
+					{
+						break;
+					}
+				}
+
+				if( x < xCount )
+				{
+					pxConsumers[ x ].xBytes += pxBlock->xRequestedSize;
+					pxConsumers[ x ].xBlocks++;
+				}
+				else if( xCount < xMaxConsumers )
+				{
+					pxConsumers[ xCount ].pvCaller = pxBlock->pvCaller;
+					pxConsumers[ xCount ].pvTask = pxBlock->pvTask;
+					pxConsumers[ xCount ].xBytes = pxBlock->xRequestedSize;
+					pxConsumers[ xCount ].xBlocks = 1;
+					xCount++;
+				}
+				else
+				{
+					xUntracked += pxBlock->xRequestedSize;
+				}
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		/* Largest first, the list is short. */
+		for( x = 1; x < xCount; x++ )
+		{
+			xSwap = pxConsumers[ x ];
+			for( y = x; ( y > 0 ) && ( pxConsumers[ y - 1 ].xBytes < xSwap.xBytes ); y-- )
+			{
+				pxConsumers[ y ] = pxConsumers[ y - 1 ];
+			}
+			pxConsumers[ y ] = xSwap;
+		}
+
+		if( pxUntrackedBytes != NULL )
+		{
+			*pxUntrackedBytes += xUntracked;
+		}
+
+		return xCount;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortHeapReport( HeapReportOutput_t pxOutput, size_t xTopCount )
+	{
+	static HeapInstrumentationStats_t xStats;
+	static HeapConsumer_t xConsumers[ configHEAP_INSTRUMENTATION_REPORT_CONSUMERS ];
+	static char cLine[ 80 ];
+	size_t xCount, xUntracked = 0, x;
+	const char *pcTaskName;
+	#if( configUSE_TRACE_FACILITY == 1 )
+		static TaskStatus_t xTasks[ configHEAP_INSTRUMENTATION_REPORT_TASKS ];
+		UBaseType_t uxTaskCount = 0, uxTask;
+	#endif
+
+		configASSERT( pxOutput );
+
+		vPortGetHeapInstrumentationStats( &xStats );
+		( void ) snprintf( cLine, sizeof( cLine ), "heap free %u min_ever %u largest_free %u free_blocks %u failed %u",
+			( unsigned ) xStats.xFreeBytes, ( unsigned ) xStats.xMinimumEverFreeBytes, ( unsigned ) xStats.xLargestFreeBlock,
+			( unsigned ) xStats.xFreeBlockCount, ( unsigned ) xStats.xFailedAllocations );
+		pxOutput( cLine );
+		( void ) snprintf( cLine, sizeof( cLine ), "heap live_blocks %u requested %u used %u",
+			( unsigned ) xStats.xLiveBlockCount, ( unsigned ) xStats.xLiveRequestedBytes, ( unsigned ) xStats.xLiveBlockBytes );
+		pxOutput( cLine );
+		pxOutput( "size_from free_blocks allocations" );
+		for( x = 0; x < ( size_t ) portHEAP_HISTOGRAM_BINS; x++ )
+		{
+			( void ) snprintf( cLine, sizeof( cLine ), "%9u %11u %11u", ( unsigned ) ( ( x == 0 ) ? 0 : ( ( size_t ) 16 << x ) ),
+				( unsigned ) xStats.xFreeBlockHistogram[ x ], ( unsigned ) xStats.xAllocationHistogram[ x ] );
+			pxOutput( cLine );
+		}
+
+		xCount = xPortGetHeapConsumers( xConsumers, configHEAP_INSTRUMENTATION_REPORT_CONSUMERS, &xUntracked );
+
+		#if( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* The names are left out when there are too many tasks. */
+			if( uxTaskGetNumberOfTasks() <= ( UBaseType_t ) configHEAP_INSTRUMENTATION_REPORT_TASKS )
+			{
+				uxTaskCount = uxTaskGetSystemState( xTasks, configHEAP_INSTRUMENTATION_REPORT_TASKS, NULL );
+			}
+		}
+		#endif
+
+		pxOutput( "caller     task             bytes   blocks" );
+		for( x = 0; ( x < xCount ) && ( x < xTopCount ); x++ )
+		{
+			/* The task may have been deleted since the allocation, its name is
+			only read while it is still a known task. */
+			pcTaskName = "-";
+			#if( configUSE_TRACE_FACILITY == 1 )
+			{
+				for( uxTask = 0; uxTask < uxTaskCount; uxTask++ )
+				{
+					if( ( void * ) xTasks[ uxTask ].xHandle == xConsumers[ x ].pvTask )
+					{
+						pcTaskName = xTasks[ uxTask ].pcTaskName;
+						break;
+					}
+				}
+			}
+			#endif /* configUSE_TRACE_FACILITY */
+
+			( void ) snprintf( cLine, sizeof( cLine ), "0x%08lx %-12.12s %9u %8u", ( unsigned long ) ( size_t ) xConsumers[ x ].pvCaller,
+				pcTaskName, ( unsigned ) xConsumers[ x ].xBytes, ( unsigned ) xConsumers[ x ].xBlocks );
+			pxOutput( cLine );
+		}
+
+		if( xUntracked > 0 )
+		{
+			( void ) snprintf( cLine, sizeof( cLine ), "untracked %u", ( unsigned ) xUntracked );
+			pxOutput( cLine );
+		}
+	}
 
+#endif /* configHEAP_INSTRUMENTATION */
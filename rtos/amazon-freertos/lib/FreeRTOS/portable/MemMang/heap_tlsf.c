@@ -0,0 +1,633 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() with the Two-Level
+ * Segregated Fit (TLSF) allocator.  Allocation and free take a bounded time
+ * that does not depend on the number of free blocks, unlike the first fit
+ * search of heap_4.c and heap_5.c, and adjacent free blocks are combined
+ * (coalesced) as they are freed.
+ *
+ * The free blocks are kept in segregated lists: the first level splits the
+ * sizes in powers of two, the second level splits each power of two in
+ * 2^configTLSF_SL_INDEX_COUNT_LOG2 linear ranges.  Two bitmaps tell which lists
+ * are not empty, so a large enough block is found with two bit scans.  A
+ * request is rounded up to the next list boundary, so the waste is bounded by
+ * 1 / 2^configTLSF_SL_INDEX_COUNT_LOG2 of the request.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * When configTOTAL_HEAP_SIZE is defined, the ucHeap array of that size is
+ * used as in heap_4.c, it is added to the heap by the first call of
+ * pvPortMalloc().
+ *
+ * Further memory, in TCM and DDR for example, is added with
+ * vPortDefineHeapRegions(), which takes an array of HeapRegion_t terminated by
+ * a NULL zero sized region as in heap_5.c.  The regions do not have to appear
+ * in address order and the function can be called more than once, before or
+ * after the first call of pvPortMalloc().  When configTOTAL_HEAP_SIZE is not
+ * defined, it must be called before the first call of pvPortMalloc().
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "block_pool.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Number of second level lists per power of two, as a power of two. */
+#ifndef configTLSF_SL_INDEX_COUNT_LOG2
+	#define configTLSF_SL_INDEX_COUNT_LOG2	4
+#endif
+
+/* Blocks are smaller than 2^configTLSF_FL_INDEX_MAX bytes, larger regions are
+split into several blocks. */
+#ifndef configTLSF_FL_INDEX_MAX
+	#define configTLSF_FL_INDEX_MAX			24
+#endif
+
+#if( configTLSF_SL_INDEX_COUNT_LOG2 > 5 )
+	#error configTLSF_SL_INDEX_COUNT_LOG2 must not be greater than 5, the second level bitmap is 32-bit.
+#endif
+
+/* log2( portBYTE_ALIGNMENT ). */
+#if( portBYTE_ALIGNMENT == 32 )
+	#define heapALIGNMENT_LOG2	5
+#elif( portBYTE_ALIGNMENT == 16 )
+	#define heapALIGNMENT_LOG2	4
+#elif( portBYTE_ALIGNMENT == 8 )
+	#define heapALIGNMENT_LOG2	3
+#elif( portBYTE_ALIGNMENT == 4 )
+	#define heapALIGNMENT_LOG2	2
+#else
+	#error heap_tlsf.c needs portBYTE_ALIGNMENT of 4, 8, 16 or 32.
+#endif
+
+/* Sizes below heapSMALL_BLOCK_SIZE all use the first level list 0, split in
+linear ranges of heapSMALL_BLOCK_SIZE / heapSL_INDEX_COUNT bytes. */
+#define heapSL_INDEX_COUNT		( 1UL << configTLSF_SL_INDEX_COUNT_LOG2 )
+#define heapFL_INDEX_SHIFT		( configTLSF_SL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapFL_INDEX_COUNT		( configTLSF_FL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+#define heapMAXIMUM_BLOCK_SIZE	( ( ( size_t ) 1 << configTLSF_FL_INDEX_MAX ) - portBYTE_ALIGNMENT )
+
+#if( heapFL_INDEX_COUNT > 32 )
+	#error configTLSF_FL_INDEX_MAX is too large, the first level bitmap is 32-bit.
+#endif
+
+/* The low bit of the block size is free, the sizes are aligned. */
+#define heapBLOCK_FREE_BIT		( ( size_t ) 1 )
+#define heapBLOCK_SIZE_MASK		( ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Allocate the memory for the heap. */
+#ifdef configTOTAL_HEAP_SIZE
+	#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+		/* The application writer has already defined the array used for the RTOS
+		heap - probably so it can be placed in a special segment or address. */
+		extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+	#else
+		static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+	#endif /* configAPPLICATION_ALLOCATED_HEAP */
+#endif /* configTOTAL_HEAP_SIZE */
+
+/* Header of a block.  The free list links are only used while the block is
+free, they are then stored in the space handed out by pvPortMalloc(). */
+typedef struct A_TLSF_BLOCK
+{
+	struct A_TLSF_BLOCK *pxPrevPhysBlock;	/*<< The block just below this one in memory, NULL for the first block of a region. */
+	size_t xBlockSize;						/*<< The size of the block including the header, heapBLOCK_FREE_BIT set while the block is free. */
+	struct A_TLSF_BLOCK *pxNextFreeBlock;	/*<< The next block in the same free list. */
+	struct A_TLSF_BLOCK *pxPrevFreeBlock;	/*<< The previous block in the same free list. */
+} TlsfBlock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Adds a block to, or removes it from, the free list matching its size.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t *pxBlock );
+static void prvRemoveFreeBlock( TlsfBlock_t *pxBlock );
+
+/*
+ * Adds a region of memory to the heap.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes );
+
+/*
+ * Called automatically to add ucHeap the first time pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* The part of TlsfBlock_t placed at the beginning of each allocated memory
+block must be correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( TlsfBlock_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* A free block must hold the free list links. */
+static const size_t xMinimumBlockSize = ( sizeof( TlsfBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Heads of the free lists and the bitmaps of the non-empty lists. */
+static TlsfBlock_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulFLBitmap = 0UL;
+static uint32_t ulSLBitmap[ heapFL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+static BaseType_t xHeapInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+/* Index of the most significant bit set, xValue must not be 0. */
+static uint32_t prvMostSignificantBit( size_t xValue )
+{
+	#if( defined( __GNUC__ ) )
+	{
+		#if( SIZE_MAX > UINT32_MAX )
+			return ( uint32_t ) ( 63 - __builtin_clzll( ( unsigned long long ) xValue ) );
+		#else
+			return ( uint32_t ) ( 31 - __builtin_clz( ( unsigned int ) xValue ) );
+		#endif
+	}
+	#else
+	{
+	uint32_t ulBit = 0UL;
+
+		while( ( xValue >>= 1 ) != 0U )
+		{
+			ulBit++;
+		}
+		return ulBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+/* Index of the least significant bit set, ulValue must not be 0. */
+static uint32_t prvLeastSignificantBit( uint32_t ulValue )
+{
+	return prvMostSignificantBit( ulValue & ( ~ulValue + 1UL ) );
+}
+/*-----------------------------------------------------------*/
+
+/* Free list of the blocks of xBlockSize bytes. */
+static void prvMappingInsert( size_t xBlockSize, uint32_t *pulFL, uint32_t *pulSL )
+{
+uint32_t ulFL;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		*pulFL = 0UL;
+		*pulSL = ( uint32_t ) ( xBlockSize / ( heapSMALL_BLOCK_SIZE / heapSL_INDEX_COUNT ) );
+	}
+	else
+	{
+		ulFL = prvMostSignificantBit( xBlockSize );
+		*pulSL = ( uint32_t ) ( xBlockSize >> ( ulFL - configTLSF_SL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+		*pulFL = ulFL - ( heapFL_INDEX_SHIFT - 1UL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* First free list in which every block is at least xBlockSize bytes. */
+static void prvMappingSearch( size_t xBlockSize, uint32_t *pulFL, uint32_t *pulSL )
+{
+	if( xBlockSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xBlockSize += ( ( size_t ) 1 << ( prvMostSignificantBit( xBlockSize ) - configTLSF_SL_INDEX_COUNT_LOG2 ) ) - 1U;
+	}
+
+	prvMappingInsert( xBlockSize, pulFL, pulSL );
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t *prvNextPhysBlock( TlsfBlock_t *pxBlock )
+{
+	return ( TlsfBlock_t * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & heapBLOCK_SIZE_MASK ) );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+TlsfBlock_t *pxBlock, *pxNewBlock;
+uint32_t ulFL, ulSL, ulBitmap;
+void *pvReturn = NULL;
+
+	#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+	{
+		/* Small requests are served by the block pools registered with
+		xBlockPoolAddMallocClass() when one of them has a free block.  A
+		request for 0 bytes is left to the heap, which returns NULL. */
+		if( xWantedSize > 0 )
+		{
+			pvReturn = pvBlockPoolMalloc( xWantedSize );
+			if( pvReturn != NULL )
+			{
+				traceMALLOC( pvReturn, xWantedSize );
+				return pvReturn;
+			}
+		}
+	}
+	#endif /* configUSE_BLOCK_POOL_MALLOC */
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the list of free blocks. */
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The wanted size is increased so it can contain a TlsfBlock_t
+		header in addition to the requested amount of bytes, rounded up to
+		the alignment and to the smallest free block. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < heapMAXIMUM_BLOCK_SIZE ) )
+		{
+			xWantedSize += xHeapStructSize;
+			xWantedSize = ( xWantedSize + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+			if( xWantedSize < xMinimumBlockSize )
+			{
+				xWantedSize = xMinimumBlockSize;
+			}
+		}
+		else
+		{
+			xWantedSize = 0;
+		}
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= heapMAXIMUM_BLOCK_SIZE ) && ( xWantedSize <= xFreeBytesRemaining ) )
+		{
+			prvMappingSearch( xWantedSize, &ulFL, &ulSL );
+
+			/* A list of the same first level with larger blocks, or else the
+			smallest non empty list of a larger first level. */
+			pxBlock = NULL;
+			if( ulFL < heapFL_INDEX_COUNT )
+			{
+				ulBitmap = ulSLBitmap[ ulFL ] & ( ~0UL << ulSL );
+				if( ulBitmap == 0UL )
+				{
+					ulBitmap = ( ulFL + 1UL < 32UL ) ? ( ulFLBitmap & ( ~0UL << ( ulFL + 1UL ) ) ) : 0UL;
+					if( ulBitmap != 0UL )
+					{
+						ulFL = prvLeastSignificantBit( ulBitmap );
+						ulBitmap = ulSLBitmap[ ulFL ];
+					}
+				}
+
+				if( ulBitmap != 0UL )
+				{
+					ulSL = prvLeastSignificantBit( ulBitmap );
+					pxBlock = pxFreeLists[ ulFL ][ ulSL ];
+				}
+			}
+
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxBlock );
+				pxBlock->xBlockSize &= ~heapBLOCK_FREE_BIT;
+
+				/* If the block is larger than required it can be split into
+				two. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+				{
+					pxNewBlock = ( TlsfBlock_t * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+					pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxNewBlock->pxPrevPhysBlock = pxBlock;
+					prvNextPhysBlock( pxNewBlock )->pxPrevPhysBlock = pxNewBlock;
+					pxBlock->xBlockSize = xWantedSize;
+
+					pxNewBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+					prvInsertFreeBlock( pxNewBlock );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+TlsfBlock_t *pxBlock, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+		{
+			if( xBlockPoolMallocFree( pv ) != pdFALSE )
+			{
+				traceFREE( pv, 0 );
+				return;
+			}
+		}
+		#endif /* configUSE_BLOCK_POOL_MALLOC */
+
+		/* The memory being freed will have a TlsfBlock_t header immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxBlock = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 );
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_SIZE_MASK ) != 0 );
+
+		if( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 )
+		{
+			vTaskSuspendAll();
+			{
+				xFreeBytesRemaining += pxBlock->xBlockSize;
+				traceFREE( pv, pxBlock->xBlockSize );
+
+				/* Combine with the block below, if it is free. */
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) &&
+					( ( ( pxNeighbour->xBlockSize & heapBLOCK_SIZE_MASK ) + pxBlock->xBlockSize ) <= heapMAXIMUM_BLOCK_SIZE ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize = ( pxNeighbour->xBlockSize & heapBLOCK_SIZE_MASK ) + pxBlock->xBlockSize;
+					pxBlock = pxNeighbour;
+					prvNextPhysBlock( pxBlock )->pxPrevPhysBlock = pxBlock;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Combine with the block above, if it is free.  The end of a
+				region is marked by an allocated zero sized block. */
+				pxNeighbour = prvNextPhysBlock( pxBlock );
+				if( ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) &&
+					( ( pxBlock->xBlockSize + ( pxNeighbour->xBlockSize & heapBLOCK_SIZE_MASK ) ) <= heapMAXIMUM_BLOCK_SIZE ) )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xBlockSize += pxNeighbour->xBlockSize & heapBLOCK_SIZE_MASK;
+					prvNextPhysBlock( pxBlock )->pxPrevPhysBlock = pxBlock;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+				prvInsertFreeBlock( pxBlock );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxHeapRegion;
+
+	vTaskSuspendAll();
+	{
+		for( pxHeapRegion = pxHeapRegions; pxHeapRegion->xSizeInBytes > 0; pxHeapRegion++ )
+		{
+			prvAddRegion( pxHeapRegion->pucStartAddress, pxHeapRegion->xSizeInBytes );
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+	#ifdef configTOTAL_HEAP_SIZE
+	{
+		prvAddRegion( ucHeap, configTOTAL_HEAP_SIZE );
+	}
+	#endif
+
+	/* Without ucHeap, vPortDefineHeapRegions() must have been called. */
+	configASSERT( xFreeBytesRemaining > 0 );
+
+	xHeapInitialised = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+TlsfBlock_t *pxBlock, *pxPrevBlock = NULL;
+size_t xAddress, xEndAddress, xBlockSize, xAddedBytes = 0;
+
+	/* Ensure the region starts and ends on correctly aligned boundaries,
+	leaving room for the zero sized block marking the end. */
+	xAddress = ( size_t ) pucStartAddress;
+	xEndAddress = xAddress + xSizeInBytes;
+	xAddress = ( xAddress + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	xEndAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	configASSERT( xEndAddress > xAddress + xHeapStructSize + xMinimumBlockSize );
+	if( xEndAddress <= xAddress + xHeapStructSize + xMinimumBlockSize )
+	{
+		return;
+	}
+	xEndAddress -= xHeapStructSize;
+
+	/* The region is split into free blocks no larger than the largest list
+	can hold. */
+	while( ( xEndAddress - xAddress ) >= xMinimumBlockSize )
+	{
+		xBlockSize = xEndAddress - xAddress;
+		if( xBlockSize > heapMAXIMUM_BLOCK_SIZE )
+		{
+			xBlockSize = heapMAXIMUM_BLOCK_SIZE;
+			if( ( xEndAddress - xAddress - xBlockSize ) < xMinimumBlockSize )
+			{
+				xBlockSize -= xMinimumBlockSize;
+			}
+		}
+
+		pxBlock = ( TlsfBlock_t * ) xAddress;
+		pxBlock->pxPrevPhysBlock = pxPrevBlock;
+		pxBlock->xBlockSize = xBlockSize | heapBLOCK_FREE_BIT;
+		prvInsertFreeBlock( pxBlock );
+
+		xAddedBytes += xBlockSize;
+		pxPrevBlock = pxBlock;
+		xAddress += xBlockSize;
+	}
+
+	/* The end marker is never free, so it is never combined. */
+	pxBlock = ( TlsfBlock_t * ) xAddress;
+	pxBlock->pxPrevPhysBlock = pxPrevBlock;
+	pxBlock->xBlockSize = 0;
+
+	xFreeBytesRemaining += xAddedBytes;
+	xMinimumEverFreeBytesRemaining += xAddedBytes;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t *pxBlock )
+{
+uint32_t ulFL, ulSL;
+TlsfBlock_t *pxHead;
+
+	prvMappingInsert( pxBlock->xBlockSize & heapBLOCK_SIZE_MASK, &ulFL, &ulSL );
+	configASSERT( ulFL < heapFL_INDEX_COUNT );
+
+	pxHead = pxFreeLists[ ulFL ][ ulSL ];
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxHead;
+	if( pxHead != NULL )
+	{
+		pxHead->pxPrevFreeBlock = pxBlock;
+	}
+	pxFreeLists[ ulFL ][ ulSL ] = pxBlock;
+
+	ulFLBitmap |= ( 1UL << ulFL );
+	ulSLBitmap[ ulFL ] |= ( 1UL << ulSL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t *pxBlock )
+{
+uint32_t ulFL, ulSL;
+
+	prvMappingInsert( pxBlock->xBlockSize & heapBLOCK_SIZE_MASK, &ulFL, &ulSL );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list. */
+		pxFreeLists[ ulFL ][ ulSL ] = pxBlock->pxNextFreeBlock;
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ulSLBitmap[ ulFL ] &= ~( 1UL << ulSL );
+			if( ulSLBitmap[ ulFL ] == 0UL )
+			{
+				ulFLBitmap &= ~( 1UL << ulFL );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
@@ -153,6 +153,7 @@ extern uint32_t SystemCoreClock; /* in Kinetis SDK, this contains the system cor
             should not be executed again.  However, the original expected idle
             time variable must remain unmodified, so a copy is taken. */
             xModifiableIdleTime = xExpectedIdleTime;
+            portRUN_TIME_STATS_SLEEP_ENTER();
             configPRE_SLEEP_PROCESSING(xModifiableIdleTime);
             if (xModifiableIdleTime > 0)
             {
@@ -161,6 +162,7 @@ extern uint32_t SystemCoreClock; /* in Kinetis SDK, this contains the system cor
                 __ISB();
             }
             configPOST_SLEEP_PROCESSING(xExpectedIdleTime);
+            portRUN_TIME_STATS_SLEEP_EXIT();
 
             ulLPTimerInterruptFired = false;
 
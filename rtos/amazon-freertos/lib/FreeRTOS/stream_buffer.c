@@ -202,6 +202,60 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ); PRIVILEGED_FUNCTION
 
+/*
+ * Block for up to xTicksToWait ticks until at least xRequiredSpace bytes are
+ * free in the buffer.  Returns the number of free bytes, which is less than
+ * xRequiredSpace if the wait timed out.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block for up to xTicksToWait ticks until more than
+ * xBytesToStoreMessageLength bytes are in the buffer.  Returns the number of
+ * bytes in the buffer.
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index xCount bytes after xIndex, wrapping at the end of the
+ * buffer.
+ */
+static size_t prvAddToIndex( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Describes the xCount bytes starting at xIndex in pxRegion, as one part or as
+ * two parts if they wrap at the end of the buffer.
+ */
+static void prvGetRegion( const StreamBuffer_t * const pxStreamBuffer,
+						  size_t xIndex,
+						  size_t xCount,
+						  StreamBufferRegion_t * const pxRegion ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the length of the next message in a message buffer without removing
+ * it from the buffer.
+ */
+static size_t prvPeekMessageLength( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * The parts of xStreamBufferReserve(), xStreamBufferCommit(),
+ * xStreamBufferAcquire() and xStreamBufferRelease() shared with their FromISR
+ * versions.
+ */
+static size_t prvReserveRegion( StreamBuffer_t * const pxStreamBuffer,
+								size_t xMinimumBytes,
+								size_t xSpace,
+								StreamBufferRegion_t * const pxRegion ) PRIVILEGED_FUNCTION;
+static size_t prvCommitRegion( StreamBuffer_t * const pxStreamBuffer, size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+static size_t prvAcquireRegion( StreamBuffer_t * const pxStreamBuffer,
+								size_t xBytesAvailable,
+								StreamBufferRegion_t * const pxRegion ) PRIVILEGED_FUNCTION;
+static size_t prvReleaseRegion( StreamBuffer_t * const pxStreamBuffer, size_t xBytesRead ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -490,9 +544,8 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 						  TickType_t xTicksToWait )
 {
 StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
-size_t xReturn, xSpace = 0;
+size_t xReturn, xSpace;
 size_t xRequiredSpace = xDataLengthBytes;
-TimeOut_t xTimeOut;
 
 	configASSERT( pvTxData );
 	configASSERT( pxStreamBuffer );
@@ -510,55 +563,7 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		vTaskSetTimeOutState( &xTimeOut );
-
-		do
-		{
-			/* Wait until the required number of bytes are free in the message
-			buffer. */
-			taskENTER_CRITICAL();
-			{
-				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-				if( xSpace < xRequiredSpace )
-				{
-					/* Clear notification state as going to wait for space. */
-					( void ) xTaskNotifyStateClear( NULL );
-
-					/* Should only be one writer. */
-					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-				}
-				else
-				{
-					taskEXIT_CRITICAL();
-					break;
-				}
-			}
-			taskEXIT_CRITICAL();
-
-			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToSend = NULL;
-
-		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	if( xSpace == ( size_t ) 0 )
-	{
-		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
 	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
 
 	if( xReturn > ( size_t ) 0 )
@@ -713,54 +718,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		/* Checking if there is data and clearing the notification state must be
-		performed atomically. */
-		taskENTER_CRITICAL();
-		{
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-
-			/* If this function was invoked by a message buffer read then
-			xBytesToStoreMessageLength holds the number of bytes used to hold
-			the length of the next discrete message.  If this function was
-			invoked by a stream buffer read then xBytesToStoreMessageLength will
-			be 0. */
-			if( xBytesAvailable <= xBytesToStoreMessageLength )
-			{
-				/* Clear notification state as going to wait for data. */
-				( void ) xTaskNotifyStateClear( NULL );
-
-				/* Should only be one reader. */
-				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		taskEXIT_CRITICAL();
-
-		if( xBytesAvailable <= xBytesToStoreMessageLength )
-		{
-			/* Wait for data to be available. */
-			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToReceive = NULL;
-
-			/* Recheck the data available after blocking. */
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	else
-	{
-		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-	}
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
 
 	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
 	holds the number of bytes used to store the message length) or a stream of
@@ -1017,124 +975,662 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 size_t xMinimumBytes,
+							 StreamBufferRegion_t * const pxRegion,
+							 TickType_t xTicksToWait )
 {
-size_t xNextHead, xFirstLength;
-
-	configASSERT( xCount > ( size_t ) 0 );
-
-	xNextHead = pxStreamBuffer->xHead;
-
-	/* Calculate the number of bytes that can be added in the first write -
-	which may be less than the total number of bytes that need to be added if
-	the buffer will wrap back to the beginning. */
-	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextHead, xCount );
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xSpace, xRequiredSpace = xMinimumBytes;
 
-	/* Write as many bytes as can be written in the first write. */
-	configASSERT( ( xNextHead + xFirstLength ) <= pxStreamBuffer->xLength );
-	memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	configASSERT( pxRegion );
+	configASSERT( pxStreamBuffer );
 
-	/* If the number of bytes written was less than the number that could be
-	written in the first write... */
-	if( xCount > xFirstLength )
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
 	{
-		/* ...then write the remaining bytes to the start of the buffer. */
-		configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-		memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	xNextHead += xCount;
-	if( xNextHead >= pxStreamBuffer->xLength )
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+
+	return prvReserveRegion( pxStreamBuffer, xMinimumBytes, xSpace, pxRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xMinimumBytes,
+									StreamBufferRegion_t * const pxRegion )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxRegion );
+	configASSERT( pxStreamBuffer );
+
+	return prvReserveRegion( pxStreamBuffer, xMinimumBytes, xStreamBufferSpacesAvailable( pxStreamBuffer ), pxRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvCommitRegion( pxStreamBuffer, xBytesWritten );
+
+	if( xReturn > ( size_t ) 0 )
 	{
-		xNextHead -= pxStreamBuffer->xLength;
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
-
-	return xCount;
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								   size_t xBytesWritten,
+								   BaseType_t * const pxHigherPriorityTaskWoken )
 {
-size_t xCount, xFirstLength, xNextTail;
-
-	/* Use the minimum of the wanted bytes and the available bytes. */
-	xCount = configMIN( xBytesAvailable, xMaxCount );
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
 
-	if( xCount > ( size_t ) 0 )
-	{
-		xNextTail = pxStreamBuffer->xTail;
+	configASSERT( pxStreamBuffer );
 
-		/* Calculate the number of bytes that can be read - which may be
-		less than the number wanted if the data wraps around to the start of
-		the buffer. */
-		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+	xReturn = prvCommitRegion( pxStreamBuffer, xBytesWritten );
 
-		/* Obtain the number of bytes it is possible to obtain in the first
-		read.  Asserts check bounds of read and write. */
-		configASSERT( xFirstLength <= xMaxCount );
-		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-		memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	if( xReturn > ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
 
-		/* If the total number of wanted bytes is greater than the number
-		that could be read in the first read... */
-		if( xCount > xFirstLength )
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
-			/*...then read the remaining bytes from the start of the buffer. */
-			configASSERT( xCount <= xMaxCount );
-			memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-
-		/* Move the tail pointer to effectively remove the data read from
-		the buffer. */
-		xNextTail += xCount;
-
-		if( xNextTail >= pxStreamBuffer->xLength )
-		{
-			xNextTail -= pxStreamBuffer->xLength;
-		}
-
-		pxStreamBuffer->xTail = xNextTail;
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	return xCount;
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+size_t xStreamBufferAcquire( StreamBufferHandle_t xStreamBuffer,
+							 StreamBufferRegion_t * const pxRegion,
+							 TickType_t xTicksToWait )
 {
-/* Returns the distance between xTail and xHead. */
-size_t xCount;
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xBytesAvailable, xBytesToStoreMessageLength;
 
-	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
-	xCount -= pxStreamBuffer->xTail;
-	if ( xCount >= pxStreamBuffer->xLength )
+	configASSERT( pxRegion );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
 	{
-		xCount -= pxStreamBuffer->xLength;
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		xBytesToStoreMessageLength = 0;
 	}
 
-	return xCount;
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
+	return prvAcquireRegion( pxStreamBuffer, xBytesAvailable, pxRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+									StreamBufferRegion_t * const pxRegion )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+
+	configASSERT( pxRegion );
+	configASSERT( pxStreamBuffer );
+
+	return prvAcquireRegion( pxStreamBuffer, prvBytesInBuffer( pxStreamBuffer ), pxRegion );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvReleaseRegion( pxStreamBuffer, xBytesRead );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn != ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xBytesRead,
+									BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as StreamBufferHandle_t is opaque Streambuffer_t. */
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvReleaseRegion( pxStreamBuffer, xBytesRead );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn != ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+{
+size_t xNextHead, xFirstLength;
+
+	configASSERT( xCount > ( size_t ) 0 );
+
+	xNextHead = pxStreamBuffer->xHead;
+
+	/* Calculate the number of bytes that can be added in the first write -
+	which may be less than the total number of bytes that need to be added if
+	the buffer will wrap back to the beginning. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextHead, xCount );
+
+	/* Write as many bytes as can be written in the first write. */
+	configASSERT( ( xNextHead + xFirstLength ) <= pxStreamBuffer->xLength );
+	memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+	/* If the number of bytes written was less than the number that could be
+	written in the first write... */
+	if( xCount > xFirstLength )
+	{
+		/* ...then write the remaining bytes to the start of the buffer. */
+		configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
+		memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xNextHead += xCount;
+	if( xNextHead >= pxStreamBuffer->xLength )
+	{
+		xNextHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxStreamBuffer->xHead = xNextHead;
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+{
+size_t xCount, xFirstLength, xNextTail;
+
+	/* Use the minimum of the wanted bytes and the available bytes. */
+	xCount = configMIN( xBytesAvailable, xMaxCount );
+
+	if( xCount > ( size_t ) 0 )
+	{
+		xNextTail = pxStreamBuffer->xTail;
+
+		/* Calculate the number of bytes that can be read - which may be
+		less than the number wanted if the data wraps around to the start of
+		the buffer. */
+		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+
+		/* Obtain the number of bytes it is possible to obtain in the first
+		read.  Asserts check bounds of read and write. */
+		configASSERT( xFirstLength <= xMaxCount );
+		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
+		memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+		/* If the total number of wanted bytes is greater than the number
+		that could be read in the first read... */
+		if( xCount > xFirstLength )
+		{
+			/*...then read the remaining bytes from the start of the buffer. */
+			configASSERT( xCount <= xMaxCount );
+			memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Move the tail pointer to effectively remove the data read from
+		the buffer. */
+		xNextTail += xCount;
+
+		if( xNextTail >= pxStreamBuffer->xLength )
+		{
+			xNextTail -= pxStreamBuffer->xLength;
+		}
+
+		pxStreamBuffer->xTail = xNextTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+/* Returns the distance between xTail and xHead. */
+size_t xCount;
+
+	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+	xCount -= pxStreamBuffer->xTail;
+	if ( xCount >= pxStreamBuffer->xLength )
+	{
+		xCount -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait )
+{
+size_t xSpace = 0;
+TimeOut_t xTimeOut;
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* Wait until the required number of bytes are free in the message
+			buffer. */
+			taskENTER_CRITICAL();
+			{
+				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					/* Should only be one writer. */
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xSpace == ( size_t ) 0 )
+	{
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait )
+{
+size_t xBytesAvailable;
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			/* If this function was invoked by a message buffer read then
+			xBytesToStoreMessageLength holds the number of bytes used to hold
+			the length of the next discrete message.  If this function was
+			invoked by a stream buffer read then xBytesToStoreMessageLength will
+			be 0. */
+			if( xBytesAvailable <= xBytesToStoreMessageLength )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, UINT32_MAX, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+			/* Recheck the data available after blocking. */
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	}
+
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAddToIndex( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount )
+{
+	xIndex += xCount;
+	if( xIndex >= pxStreamBuffer->xLength )
+	{
+		xIndex -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xIndex;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetRegion( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount, StreamBufferRegion_t * const pxRegion )
+{
+size_t xFirstLength;
+
+	configASSERT( xCount < pxStreamBuffer->xLength );
+
+	/* The region wraps back to the start of the buffer if it does not fit
+	between xIndex and the end of the buffer. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+
+	pxRegion->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+	pxRegion->xFirstLength = xFirstLength;
+
+	if( xCount > xFirstLength )
+	{
+		pxRegion->pucSecond = pxStreamBuffer->pucBuffer;
+		pxRegion->xSecondLength = xCount - xFirstLength;
+	}
+	else
+	{
+		pxRegion->pucSecond = NULL;
+		pxRegion->xSecondLength = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPeekMessageLength( const StreamBuffer_t * const pxStreamBuffer )
+{
+StreamBufferRegion_t xRegion;
+size_t xMessageLength;
+
+	/* Read the length of the next message without moving the tail, the
+	length is only consumed with the message. */
+	prvGetRegion( pxStreamBuffer, pxStreamBuffer->xTail, sbBYTES_TO_STORE_MESSAGE_LENGTH, &xRegion );
+	memcpy( ( void * ) &xMessageLength, ( const void * ) xRegion.pucFirst, xRegion.xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	if( xRegion.xSecondLength != ( size_t ) 0 )
+	{
+		memcpy( ( void * ) &( ( ( uint8_t * ) &xMessageLength )[ xRegion.xFirstLength ] ), ( const void * ) xRegion.pucSecond, xRegion.xSecondLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xMessageLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReserveRegion( StreamBuffer_t * const pxStreamBuffer, size_t xMinimumBytes, size_t xSpace, StreamBufferRegion_t * const pxRegion )
+{
+size_t xReturn;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* A message buffer reserves exactly one message, after the bytes that
+		will hold its length. */
+		if( xSpace >= ( xMinimumBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			xReturn = xMinimumBytes;
+			prvGetRegion( pxStreamBuffer, prvAddToIndex( pxStreamBuffer, pxStreamBuffer->xHead, sbBYTES_TO_STORE_MESSAGE_LENGTH ), xReturn, pxRegion );
+		}
+		else
+		{
+			xReturn = 0;
+		}
+	}
+	else if( xSpace >= xMinimumBytes )
+	{
+		/* A stream buffer reserves all the free space. */
+		xReturn = xSpace;
+		prvGetRegion( pxStreamBuffer, pxStreamBuffer->xHead, xReturn, pxRegion );
+	}
+	else
+	{
+		xReturn = 0;
+	}
+
+	if( xReturn == ( size_t ) 0 )
+	{
+		pxRegion->pucFirst = NULL;
+		pxRegion->xFirstLength = 0;
+		pxRegion->pucSecond = NULL;
+		pxRegion->xSecondLength = 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvCommitRegion( StreamBuffer_t * const pxStreamBuffer, size_t xBytesWritten )
+{
+StreamBufferRegion_t xRegion;
+size_t xNextHead;
+
+	xNextHead = pxStreamBuffer->xHead;
+
+	if( xBytesWritten == ( size_t ) 0 )
+	{
+		/* Nothing was written, the reservation is dropped. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+	else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		configASSERT( ( xBytesWritten + sbBYTES_TO_STORE_MESSAGE_LENGTH ) <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+
+		/* Write the length in front of the message.  The head is only moved
+		once both are in the buffer, so the reader sees the whole message or
+		nothing. */
+		prvGetRegion( pxStreamBuffer, xNextHead, sbBYTES_TO_STORE_MESSAGE_LENGTH, &xRegion );
+		memcpy( ( void * ) xRegion.pucFirst, ( const void * ) &xBytesWritten, xRegion.xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+		if( xRegion.xSecondLength != ( size_t ) 0 )
+		{
+			memcpy( ( void * ) xRegion.pucSecond, ( const void * ) &( ( ( const uint8_t * ) &xBytesWritten )[ xRegion.xFirstLength ] ), xRegion.xSecondLength ); /*lint !e9087 memcpy() requires void *. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xNextHead = prvAddToIndex( pxStreamBuffer, xNextHead, sbBYTES_TO_STORE_MESSAGE_LENGTH + xBytesWritten );
+	}
+	else
+	{
+		configASSERT( xBytesWritten <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+		xNextHead = prvAddToIndex( pxStreamBuffer, xNextHead, xBytesWritten );
+	}
+
+	pxStreamBuffer->xHead = xNextHead;
+
+	return xBytesWritten;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAcquireRegion( StreamBuffer_t * const pxStreamBuffer, size_t xBytesAvailable, StreamBufferRegion_t * const pxRegion )
+{
+size_t xReturn;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* A message buffer returns the next message, without its length. */
+		if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+		{
+			xReturn = prvPeekMessageLength( pxStreamBuffer );
+			configASSERT( xReturn <= ( xBytesAvailable - sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+			prvGetRegion( pxStreamBuffer, prvAddToIndex( pxStreamBuffer, pxStreamBuffer->xTail, sbBYTES_TO_STORE_MESSAGE_LENGTH ), xReturn, pxRegion );
+		}
+		else
+		{
+			xReturn = 0;
+		}
+	}
+	else
+	{
+		/* A stream buffer returns all the bytes available. */
+		xReturn = xBytesAvailable;
+		if( xReturn != ( size_t ) 0 )
+		{
+			prvGetRegion( pxStreamBuffer, pxStreamBuffer->xTail, xReturn, pxRegion );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xReturn == ( size_t ) 0 )
+	{
+		pxRegion->pucFirst = NULL;
+		pxRegion->xFirstLength = 0;
+		pxRegion->pucSecond = NULL;
+		pxRegion->xSecondLength = 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReleaseRegion( StreamBuffer_t * const pxStreamBuffer, size_t xBytesRead )
+{
+size_t xBytesAvailable, xReturn;
+
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* The whole message is released, whatever xBytesRead is. */
+		if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+		{
+			xReturn = prvPeekMessageLength( pxStreamBuffer );
+			pxStreamBuffer->xTail = prvAddToIndex( pxStreamBuffer, pxStreamBuffer->xTail, sbBYTES_TO_STORE_MESSAGE_LENGTH + xReturn );
+		}
+		else
+		{
+			xReturn = 0;
+		}
+	}
+	else
+	{
+		configASSERT( xBytesRead <= xBytesAvailable );
+		xReturn = configMIN( xBytesRead, xBytesAvailable );
+		pxStreamBuffer->xTail = prvAddToIndex( pxStreamBuffer, pxStreamBuffer->xTail, xReturn );
+	}
+
+	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
@@ -40,6 +40,10 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "stack_macros.h"
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	#include "tick_wheel.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -210,6 +214,18 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* The delayed task wheel does not depend on the tick count overflowing,
+	but xNextTaskUnblockTime never goes past an overflow so is recalculated. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		xNumOfOverflows++;																			\
+		prvResetNextTaskUnblockTime();																\
+	}
+
+#else
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
@@ -226,6 +242,8 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -307,7 +325,7 @@ typedef struct tskTaskControlBlock
 	#endif
 
 	#if( configGENERATE_RUN_TIME_STATS == 1 )
-		uint32_t		ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
+		configRUN_TIME_COUNTER_TYPE	ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
@@ -353,10 +371,33 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* Blocking with a timeout and unblocking are an insertion into, or a
+	removal from, one slot of the wheel.  A delayed task moves down one level
+	or more at a time as its wake time gets closer, so it is moved at most
+	wheelLEVELS times.  This is the same arrangement as the timer wheel of
+	timers.c, described in tick_wheel.h. */
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ wheelLEVELS ][ wheelSLOTS ];	/*< Delayed tasks. */
+
+	/* One bit per slot that might reference a task.  Tasks leave the wheel
+	from many places, which just remove the list item, so the bit of an
+	emptied slot is only cleared when the tick count reaches the slot. */
+	PRIVILEGED_DATA static uint16_t usDelayedWheelSlotsInUse[ wheelLEVELS ];
+
+	/* The next tick to process, the ticks before it have been processed. */
+	PRIVILEGED_DATA static TickType_t xDelayedWheelTime = ( TickType_t ) 0U;
+
+#else
+
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -403,8 +444,8 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
-	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
-	PRIVILEGED_DATA static uint32_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
+	PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
 
@@ -545,6 +586,24 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Reference the task from the delayed task wheel slot that matches the
+	 * distance between its wake time and xDelayedWheelTime.  The task is added
+	 * to the front of the slot if xInsertAtHead is pdTRUE, else to its end.
+	 */
+	static void prvDelayedWheelInsert( TCB_t * const pxTCB, const BaseType_t xInsertAtHead ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Process the delayed task wheel up to and including xConstTickCount,
+	 * moving the tasks that wake to the ready lists.  Returns pdTRUE if a
+	 * context switch is required.
+	 */
+	static BaseType_t prvProcessDelayedTaskWheel( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -1362,7 +1421,11 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			taskEXIT_CRITICAL();
 
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			if( ( pxStateList >= &( xDelayedTaskWheel[ 0 ][ 0 ] ) ) && ( pxStateList <= &( xDelayedTaskWheel[ wheelLEVELS - 1U ][ wheelSLOTS - 1U ] ) ) )
+			#else
 			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			#endif
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1995,6 +2058,13 @@ BaseType_t xReturn;
 		xSchedulerRunning = pdTRUE;
 		xTickCount = ( TickType_t ) 0U;
 
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+		{
+			/* The next tick processed by the delayed task wheel. */
+			xDelayedWheelTime = xTickCount + ( TickType_t ) 1U;
+		}
+		#endif
+
 		/* If configGENERATE_RUN_TIME_STATS is defined then the following
 		macro must be defined to configure the timer/counter used to generate
 		the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
@@ -2423,15 +2493,26 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				for( uxQueue = ( UBaseType_t ) 0U; ( pxTCB == NULL ) && ( uxQueue < ( UBaseType_t ) ( wheelLEVELS * wheelSLOTS ) ); uxQueue++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxQueue / wheelSLOTS ][ uxQueue % wheelSLOTS ] ), pcNameToQuery );
+				}
 			}
-
-			if( pxTCB == NULL )
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2463,7 +2544,7 @@ TCB_t *pxTCB;
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
 	{
 	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
@@ -2483,8 +2564,19 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) ( wheelLEVELS * wheelSLOTS ); uxQueue++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue / wheelSLOTS ][ uxQueue % wheelSLOTS ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2548,6 +2640,17 @@ TCB_t *pxTCB;
 #endif /* INCLUDE_xTaskGetIdleTaskHandle */
 /*----------------------------------------------------------*/
 
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+
+	configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void )
+	{
+		configASSERT( ( xIdleTaskHandle != NULL ) );
+		return ( ( TCB_t * ) xIdleTaskHandle )->ulRunTimeCounter;
+	}
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
+/*----------------------------------------------------------*/
+
 /* This conditional compilation should use inequality to 0, not equality to 1.
 This is to ensure vTaskStepTick() is available when user defined low power mode
 implementations require configUSE_TICKLESS_IDLE to be set to a value other than
@@ -2645,8 +2748,10 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 
 BaseType_t xTaskIncrementTick( void )
 {
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
 TCB_t * pxTCB;
 TickType_t xItemValue;
+#endif
 BaseType_t xSwitchRequired = pdFALSE;
 
 	/* Called by the portable layer each time a tick interrupt occurs.
@@ -2672,6 +2777,14 @@ BaseType_t xSwitchRequired = pdFALSE;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+		/* xNextTaskUnblockTime is the first tick at which a task wakes or a
+		slot of the delayed task wheel must be cascaded. */
+		if( xConstTickCount >= xNextTaskUnblockTime )
+		{
+			xSwitchRequired = prvProcessDelayedTaskWheel( xConstTickCount );
+		}
+#else
 		/* See if this tick has made a timeout expire.  Tasks are stored in
 		the	queue in the order of their wake time - meaning once one task
 		has been found whose block time has not expired there is no need to
@@ -2753,6 +2866,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 				}
 			}
 		}
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
@@ -3154,6 +3268,62 @@ TCB_t *pxUnblockedTCB;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+	{
+	TCB_t *pxUnblockedTCB;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION, normally from
+		within an ISR.  The event group is not locked, so no task is accessing
+		its event list. */
+
+		/* Store the new item value in the event list. */
+		listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+		pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( pxEventListItem );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
+		}
+		else
+		{
+			/* The delayed and ready lists cannot be accessed, so hold this task
+			pending until the scheduler is resumed.  The item value is not
+			changed by the pending ready list. */
+			vListInsertEnd( &( xPendingReadyList ), pxEventListItem );
+		}
+
+		if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+		{
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter of the ISR safe function. */
+			xReturn = pdTRUE;
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		#if( configUSE_TICKLESS_IDLE != 0 )
+		{
+			/* As in xTaskRemoveFromEventList(). */
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
@@ -3513,8 +3683,20 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) ( wheelLEVELS * wheelSLOTS ); uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxPriority / wheelSLOTS ][ uxPriority % wheelSLOTS ] ) );
+		}
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3529,10 +3711,14 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -3798,6 +3984,42 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+static void prvResetNextTaskUnblockTime( void )
+{
+TickType_t xTicksToEvent, xEventTime;
+
+	if( prvWheelGetNextEvent( usDelayedWheelSlotsInUse, xDelayedWheelTime, &xTicksToEvent ) == pdFALSE )
+	{
+		/* No task is delayed. */
+		xNextTaskUnblockTime = portMAX_DELAY;
+	}
+	else if( xTicksToEvent < ( TickType_t ) ( ( xTickCount + ( TickType_t ) 1U ) - xDelayedWheelTime ) )
+	{
+		/* vTaskStepTick() moved the tick count onto the tick of the event
+		without processing it, process it on the next tick. */
+		xNextTaskUnblockTime = xTickCount;
+	}
+	else
+	{
+		/* As with the sorted lists, xNextTaskUnblockTime does not go past a
+		tick count overflow.  It is recalculated when the tick count
+		overflows. */
+		xEventTime = xDelayedWheelTime + xTicksToEvent;
+		if( xEventTime < xTickCount )
+		{
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		else
+		{
+			xNextTaskUnblockTime = xEventTime;
+		}
+	}
+}
+
+#else
+
 static void prvResetNextTaskUnblockTime( void )
 {
 TCB_t *pxTCB;
@@ -3820,6 +4042,145 @@ TCB_t *pxTCB;
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
 	}
 }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	static void prvDelayedWheelInsert( TCB_t * const pxTCB, const BaseType_t xInsertAtHead )
+	{
+	const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+	const UBaseType_t uxLevel = prvWheelGetLevel( xTimeToWake - xDelayedWheelTime );
+	const UBaseType_t uxSlot = prvWheelGetSlot( xTimeToWake, uxLevel );
+	List_t * const pxSlot = &( xDelayedTaskWheel[ uxLevel ][ uxSlot ] );
+	ListItem_t * const pxNewListItem = &( pxTCB->xStateListItem );
+	ListItem_t *pxNext;
+
+
+		/* vListInsertEnd() inserts before pxIndex, which
+		uxTaskGetSystemState() moves, so the item is linked next to xListEnd
+		here. */
+		if( xInsertAtHead != pdFALSE )
+		{
+			pxNext = pxSlot->xListEnd.pxNext;
+		}
+		else
+		{
+			pxNext = ( ListItem_t * ) &( pxSlot->xListEnd );
+		}
+
+		pxNewListItem->pxNext = pxNext;
+		pxNewListItem->pxPrevious = pxNext->pxPrevious;
+		pxNext->pxPrevious->pxNext = pxNewListItem;
+		pxNext->pxPrevious = pxNewListItem;
+		pxNewListItem->pvContainer = ( void * ) pxSlot;
+		( pxSlot->uxNumberOfItems )++;
+
+		usDelayedWheelSlotsInUse[ uxLevel ] |= ( uint16_t ) ( 1U << uxSlot );
+	}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	static BaseType_t prvProcessDelayedTaskWheel( const TickType_t xConstTickCount )
+	{
+	BaseType_t xSwitchRequired = pdFALSE;
+	TickType_t xTicksToEvent, xTick;
+	UBaseType_t uxLevel, uxTopLevel, uxSlot;
+	List_t *pxSlot;
+	TCB_t *pxTCB;
+
+		/* Process the ticks up to and including xConstTickCount at which a
+		task wakes or a slot must be cascaded.  The other ticks are skipped. */
+		while( prvWheelGetNextEvent( usDelayedWheelSlotsInUse, xDelayedWheelTime, &xTicksToEvent ) != pdFALSE )
+		{
+			if( xTicksToEvent >= ( TickType_t ) ( ( xConstTickCount + ( TickType_t ) 1U ) - xDelayedWheelTime ) )
+			{
+				break;
+			}
+
+			xTick = xDelayedWheelTime + xTicksToEvent;
+			xDelayedWheelTime = xTick;
+
+			/* When xTick is the first tick of a slot of the upper levels, move
+			the tasks of that slot down.  They wake less than a slot width
+			after xTick so the slot ends up empty.  The tasks are taken from
+			the end of the slot and added to the front of the lower slots.  A
+			task that was already in a lower slot with the same wake time
+			blocked later, so this keeps the tasks that wake on the same tick
+			in the order in which they blocked, as with the sorted list. */
+			uxTopLevel = prvWheelGetTopCascadeLevel( xTick );
+			for( uxLevel = ( UBaseType_t ) 1U; uxLevel <= uxTopLevel; uxLevel++ )
+			{
+				uxSlot = prvWheelGetSlot( xTick, uxLevel );
+				pxSlot = &( xDelayedTaskWheel[ uxLevel ][ uxSlot ] );
+				while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxSlot->xListEnd.pxPrevious );
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvDelayedWheelInsert( pxTCB, pdTRUE );
+				}
+				usDelayedWheelSlotsInUse[ uxLevel ] &= ( uint16_t ) ~( 1U << uxSlot );
+			}
+
+			/* All the tasks referenced from the level 0 slot wake at xTick. */
+			uxSlot = prvWheelGetSlot( xTick, ( UBaseType_t ) 0U );
+			pxSlot = &( xDelayedTaskWheel[ 0 ][ uxSlot ] );
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+
+				/* It is time to remove the item from the Blocked state. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+			usDelayedWheelSlotsInUse[ 0 ] &= ( uint16_t ) ~( 1U << uxSlot );
+
+			xDelayedWheelTime = xTick + ( TickType_t ) 1U;
+		}
+
+		/* Nothing else happens up to xConstTickCount. */
+		xDelayedWheelTime = xConstTickCount + ( TickType_t ) 1U;
+		prvResetNextTaskUnblockTime();
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4329,7 +4690,7 @@ TCB_t *pxTCB;
 	{
 	TaskStatus_t *pxTaskStatusArray;
 	volatile UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
+	configRUN_TIME_COUNTER_TYPE ulTotalTime, ulStatsAsPercentage;
 
 		#if( configUSE_TRACE_FACILITY != 1 )
 		{
@@ -4402,7 +4763,7 @@ TCB_t *pxTCB;
 					{
 						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned long ) ulStatsAsPercentage );
 						}
 						#else
 						{
@@ -4418,7 +4779,7 @@ TCB_t *pxTCB;
 						consumed less than 1% of the total run time. */
 						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
 						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
+							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", ( unsigned long ) pxTaskStatusArray[ x ].ulRunTimeCounter );
 						}
 						#else
 						{
@@ -5026,30 +5387,53 @@ const TickType_t xConstTickCount = xTickCount;
 			/* The list item will be inserted in wake time order. */
 			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-			if( xTimeToWake < xConstTickCount )
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				/* Wake time has overflowed.  Place this item in the overflow
-				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				if( xTimeToWake == xConstTickCount )
+				{
+					/* A block time of 0 ticks.  The sorted list unblocks the
+					task on the next tick, so does the wheel. */
+					listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xDelayedWheelTime );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvDelayedWheelInsert( pxCurrentTCB, pdFALSE );
+
+				/* The slot the task was placed in might have to be processed
+				before xNextTaskUnblockTime. */
+				prvResetNextTaskUnblockTime();
 			}
-			else
+			#else
 			{
-				/* The wake time has not overflowed, so the current block list
-				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-
-				/* If the task entering the blocked state was placed at the
-				head of the list of blocked tasks then xNextTaskUnblockTime
-				needs to be updated too. */
-				if( xTimeToWake < xNextTaskUnblockTime )
+				if( xTimeToWake < xConstTickCount )
 				{
-					xNextTaskUnblockTime = xTimeToWake;
+					/* Wake time has overflowed.  Place this item in the
+					overflow list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* The wake time has not overflowed, so the current block
+					list is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 		}
 	}
 	#else /* INCLUDE_vTaskSuspend */
@@ -5062,28 +5446,53 @@ const TickType_t xConstTickCount = xTickCount;
 		/* The list item will be inserted in wake time order. */
 		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-		if( xTimeToWake < xConstTickCount )
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			if( xTimeToWake == xConstTickCount )
+			{
+				/* A block time of 0 ticks.  The sorted list unblocks the task
+				on the next tick, so does the wheel. */
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xDelayedWheelTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvDelayedWheelInsert( pxCurrentTCB, pdFALSE );
+
+			/* The slot the task was placed in might have to be processed before
+			xNextTaskUnblockTime. */
+			prvResetNextTaskUnblockTime();
 		}
-		else
+		#else
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
+			if( xTimeToWake < xConstTickCount )
 			{
-				xNextTaskUnblockTime = xTimeToWake;
+				/* Wake time has overflowed.  Place this item in the overflow
+				list. */
+				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The wake time has not overflowed, so the current block list
+				is used. */
+				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+				/* If the task entering the blocked state was placed at the head
+				of the list of blocked tasks then xNextTaskUnblockTime needs to
+				be updated too. */
+				if( xTimeToWake < xNextTaskUnblockTime )
+				{
+					xNextTaskUnblockTime = xTimeToWake;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 		( void ) xCanBlockIndefinitely;
@@ -38,6 +38,10 @@ task.h is included from an application file. */
 #include "queue.h"
 #include "timers.h"
 
+#if( configUSE_TIMER_WHEEL == 1 )
+	#include "tick_wheel.h"
+#endif
+
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
@@ -125,13 +129,33 @@ typedef struct tmrTimerQueueMessage
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	/* The timer wheel in which active timers are stored.  Starting, stopping
+	and resetting a timer is an insertion at the end of, or a removal from, one
+	slot.  Each timer moves down one level or more at a time as its expiry time
+	gets closer, so it is moved at most wheelLEVELS times.  The layout of the
+	wheel is described in tick_wheel.h.  Only the timer service task is
+	allowed to access the wheel. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ wheelLEVELS ][ wheelSLOTS ];
+
+	/* One bit per slot that references at least one timer. */
+	PRIVILEGED_DATA static uint16_t usWheelSlotsInUse[ wheelLEVELS ];
+
+	/* The next tick to process, the ticks before it have been processed. */
+	PRIVILEGED_DATA static TickType_t xWheelTime = ( TickType_t ) 0U;
+
+#else
+
+	/* The list in which active timers are stored.  Timers are referenced in expire
+	time order, with the nearest expiry time at the front of the list.  Only the
+	timer service task is allowed to access these lists. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -177,16 +201,40 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
+ * Remove the timer from the active timers.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
 
 /*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
+ * An active timer has reached its expire time.  Reload the timer if it is an
+ * auto reload timer, then call its callback.  When the timer wheel is used all
+ * the timers that expire up to xTimeNow are processed.
  */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * Reference the timer from the wheel slot that matches the distance between
+	 * its expiry time and xWheelTime.
+	 */
+	static void prvWheelInsert( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the timers of a slot to the lower levels of the wheel, called when
+	 * xWheelTime reaches the first tick of the range covered by the slot.
+	 */
+	static void prvWheelCascade( List_t * const pxSlot ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -459,6 +507,82 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+{
+BaseType_t xResult;
+TickType_t xTicksToEvent, xTick;
+UBaseType_t uxLevel, uxTopLevel;
+List_t *pxSlot;
+Timer_t *pxTimer;
+
+	( void ) xNextExpireTime;
+
+	/* Process the ticks up to and including xTimeNow at which a timer expires
+	or a slot must be cascaded.  The other ticks are skipped. */
+	while( prvWheelGetNextEvent( usWheelSlotsInUse, xWheelTime, &xTicksToEvent ) != pdFALSE )
+	{
+		if( xTicksToEvent >= ( TickType_t ) ( ( xTimeNow + ( TickType_t ) 1U ) - xWheelTime ) )
+		{
+			break;
+		}
+
+		xTick = xWheelTime + xTicksToEvent;
+		xWheelTime = xTick;
+
+		/* When xTick is the first tick of a slot of the upper levels, move the
+		timers of that slot down. */
+		uxTopLevel = prvWheelGetTopCascadeLevel( xTick );
+		for( uxLevel = ( UBaseType_t ) 1U; uxLevel <= uxTopLevel; uxLevel++ )
+		{
+			prvWheelCascade( &( xTimerWheel[ uxLevel ][ prvWheelGetSlot( xTick, uxLevel ) ] ) );
+		}
+
+		/* All the timers referenced from the level 0 slot expire at xTick.
+		An auto reload timer is reinserted relative to xWheelTime == xTick, so
+		with a period of at least one tick it cannot land in the same slot. */
+		pxSlot = &( xTimerWheel[ 0 ][ prvWheelGetSlot( xTick, ( UBaseType_t ) 0U ) ] );
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+			prvRemoveTimerFromActiveList( pxTimer );
+			traceTIMER_EXPIRED( pxTimer );
+
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+			{
+				if( prvInsertTimerInActiveList( pxTimer, ( xTick + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTick ) != pdFALSE )
+				{
+					/* The next expiry time has passed as well.  Restart the
+					timer through the timer queue, in the same way as with the
+					sorted list. */
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xTick, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Call the timer callback. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		}
+
+		xWheelTime = xTick + ( TickType_t ) 1U;
+	}
+
+	/* Nothing else happens up to xTimeNow. */
+	xWheelTime = xTimeNow + ( TickType_t ) 1U;
+}
+
+#else
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -497,6 +621,8 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
@@ -535,6 +661,44 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+TickType_t xTimeNow;
+
+	vTaskSuspendAll();
+	{
+		/* The wheel has processed the ticks before xWheelTime.  A timer has
+		expired, or a slot must be cascaded, if xNextExpireTime is between
+		xWheelTime and the time now.  The distances from xWheelTime are
+		compared so a tick count overflow does not need handling here. */
+		xTimeNow = xTaskGetTickCount();
+		if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xNextExpireTime - xWheelTime ) < ( TickType_t ) ( ( xTimeNow + ( TickType_t ) 1U ) - xWheelTime ) ) )
+		{
+			( void ) xTaskResumeAll();
+			prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+		}
+		else
+		{
+			/* xNextExpireTime is after xTimeNow, or the wheel is empty and
+			the task blocks until a command is received. */
+			vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+
+#else
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -593,12 +757,33 @@ BaseType_t xTimerListsWereSwitched;
 		}
 	}
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
 
+#if( configUSE_TIMER_WHEEL == 1 )
+TickType_t xTicksToEvent;
+
+	/* The next expire time is the next tick at which the wheel has something
+	to do.  This is the expiry time of a timer, or the first tick of a slot of
+	an upper level whose timers must be moved down.  The latter only happens a
+	few times during the life of a timer, at most once per level. */
+	if( prvWheelGetNextEvent( usWheelSlotsInUse, xWheelTime, &xTicksToEvent ) != pdFALSE )
+	{
+		*pxListWasEmpty = pdFALSE;
+		xNextExpireTime = xWheelTime + xTicksToEvent;
+	}
+	else
+	{
+		/* No active timers, the task blocks until a command is received. */
+		*pxListWasEmpty = pdTRUE;
+		xNextExpireTime = ( TickType_t ) 0U;
+	}
+#else
 	/* Timers are listed in expiry time order, with the head of the list
 	referencing the task that will expire first.  Obtain the time at which
 	the timer with the nearest expiry time will expire.  If there are no
@@ -616,11 +801,45 @@ TickType_t xNextExpireTime;
 		/* Ensure the task unblocks when the tick count rolls over. */
 		xNextExpireTime = ( TickType_t ) 0U;
 	}
+#endif /* configUSE_TIMER_WHEEL */
 
 	return xNextExpireTime;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 1 )
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+TickType_t xTimeNow, xTicksToEvent;
+
+	xTimeNow = xTaskGetTickCount();
+
+	/* If nothing happens between xWheelTime and the time now then move
+	xWheelTime to the time now, so the timers started next are placed
+	relative to the time now.  Otherwise the ticks are processed on the next
+	iteration of the timer service task. */
+	if( prvWheelGetNextEvent( usWheelSlotsInUse, xWheelTime, &xTicksToEvent ) == pdFALSE )
+	{
+		xWheelTime = xTimeNow + ( TickType_t ) 1U;
+	}
+	else if( xTicksToEvent >= ( TickType_t ) ( ( xTimeNow + ( TickType_t ) 1U ) - xWheelTime ) )
+	{
+		xWheelTime = xTimeNow + ( TickType_t ) 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The wheel has no lists to switch. */
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTimeNow;
+}
+
+#else
+
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
@@ -642,6 +861,8 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 
 	return xTimeNow;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
@@ -651,6 +872,20 @@ BaseType_t xProcessTimerNow = pdFALSE;
 	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
+#if( configUSE_TIMER_WHEEL == 1 )
+	/* xNextExpiryTime is always xCommandTime plus the period of the timer.
+	The timer has expired already if at least one period elapsed between the
+	command being issued and the command being processed, which also covers
+	the cases where the tick count overflowed in between. */
+	if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	{
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		prvWheelInsert( pxTimer );
+	}
+#else
 	if( xNextExpiryTime <= xTimeNow )
 	{
 		/* Has the expiry time elapsed between the command to start/reset a
@@ -680,11 +915,76 @@ BaseType_t xProcessTimerNow = pdFALSE;
 			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
 		}
 	}
+#endif /* configUSE_TIMER_WHEEL */
 
 	return xProcessTimerNow;
 }
 /*-----------------------------------------------------------*/
 
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
+{
+#if( configUSE_TIMER_WHEEL == 1 )
+List_t * const pxSlot = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+UBaseType_t uxIndex;
+
+	if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0 )
+	{
+		/* The slot is empty now, clear its bit. */
+		uxIndex = ( UBaseType_t ) ( pxSlot - &( xTimerWheel[ 0 ][ 0 ] ) );
+		usWheelSlotsInUse[ uxIndex / wheelSLOTS ] &= ( uint16_t ) ~( 1U << ( uxIndex % wheelSLOTS ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+#else
+	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+#endif /* configUSE_TIMER_WHEEL */
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvWheelInsert( Timer_t * const pxTimer )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+	const UBaseType_t uxLevel = prvWheelGetLevel( xExpiryTime - xWheelTime );
+	const UBaseType_t uxSlot = prvWheelGetSlot( xExpiryTime, uxLevel );
+
+		vListInsertEnd( &( xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+		usWheelSlotsInUse[ uxLevel ] |= ( uint16_t ) ( 1U << uxSlot );
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvWheelCascade( List_t * const pxSlot )
+	{
+	Timer_t *pxTimer;
+
+		/* The timers of the slot expire less than a slot width after
+		xWheelTime, so they all move to lower levels and the slot ends up
+		empty. */
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+
+			/* The timer is still active, xTimerIsTimerActive() must not
+			observe it between the two slots. */
+			taskENTER_CRITICAL();
+			{
+				prvRemoveTimerFromActiveList( pxTimer );
+				prvWheelInsert( pxTimer );
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
 static void	prvProcessReceivedCommands( void )
 {
 DaemonTaskMessage_t xMessage;
@@ -727,7 +1027,7 @@ TickType_t xTimeNow;
 			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvRemoveTimerFromActiveList( pxTimer );
 			}
 			else
 			{
@@ -832,6 +1132,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -889,6 +1191,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -900,10 +1204,26 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) wheelLEVELS; uxLevel++ )
+				{
+					for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) wheelSLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+				}
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
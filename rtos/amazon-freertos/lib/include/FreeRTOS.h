@@ -688,10 +688,44 @@ extern "C" {
 	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceBLOCK_POOL_CREATE
+	#define traceBLOCK_POOL_CREATE( pxBlockPool )
+#endif
+
+#ifndef traceBLOCK_POOL_CREATE_FAILED
+	#define traceBLOCK_POOL_CREATE_FAILED()
+#endif
+
+#ifndef traceBLOCK_POOL_CREATE_STATIC_FAILED
+	#define traceBLOCK_POOL_CREATE_STATIC_FAILED()
+#endif
+
+#ifndef traceBLOCK_POOL_DELETE
+	#define traceBLOCK_POOL_DELETE( pxBlockPool )
+#endif
+
+#ifndef traceBLOCK_POOL_ALLOC
+	#define traceBLOCK_POOL_ALLOC( pxBlockPool, pvBlock )
+#endif
+
+#ifndef traceBLOCK_POOL_ALLOC_FAILED
+	#define traceBLOCK_POOL_ALLOC_FAILED( pxBlockPool )
+#endif
+
+#ifndef traceBLOCK_POOL_FREE
+	#define traceBLOCK_POOL_FREE( pxBlockPool, pvBlock )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
 
+#ifndef configRUN_TIME_COUNTER_TYPE
+	/* Type of the run time stats counters.  A port can use a 64-bit type when
+	its run time stats clock wraps too quickly for a 32-bit counter. */
+	#define configRUN_TIME_COUNTER_TYPE uint32_t
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 	#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
@@ -824,6 +858,56 @@ extern "C" {
 	#define configSUPPORT_DYNAMIC_ALLOCATION 1
 #endif
 
+#ifndef configHEAP_INSTRUMENTATION
+	/* Set to 1 to record the caller, task and requested size of each block of
+	heap_4.c and heap_5.c, see vPortGetHeapInstrumentationStats().  Cannot be
+	combined with configUSE_BLOCK_POOL_MALLOC, the pool blocks have no room
+	for the record. */
+	#define configHEAP_INSTRUMENTATION 0
+#endif
+
+#ifndef configUSE_BLOCK_POOL_MALLOC
+	/* Set to 1 to serve small pvPortMalloc() requests from the block pools
+	registered with xBlockPoolAddMallocClass(), see block_pool.h. */
+	#define configUSE_BLOCK_POOL_MALLOC 0
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	/* Set to 1 to keep the active software timers in a hierarchical timer
+	wheel instead of a sorted list, see timers.c. */
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	/* Set to 1 to keep the tasks that are blocked with a timeout in a
+	hierarchical timer wheel instead of the two sorted delayed task lists, see
+	tasks.c. */
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_ISR
+	/* Set to 1 for xEventGroupSetBitsFromISR() and xEventGroupClearBitsFromISR()
+	to update the event group from the interrupt instead of deferring the
+	update to the timer service task, see event_groups.c.  This pays off for
+	event groups with one or a few waiting tasks.  Each waiting task is
+	unblocked with interrupts masked, and every task that waits on or sets
+	bits of an event group pays for locking it.  Above
+	configEVENT_GROUP_ISR_MAX_WAITERS waiting tasks the update is deferred
+	anyway and only the cost of the lock remains: the host event group
+	benchmark wakes one waiting task about five times faster, four waiting
+	tasks only a little faster, and eight waiting tasks slower than with this
+	option set to 0. */
+	#define configUSE_EVENT_GROUP_DIRECT_ISR 0
+#endif
+
+#ifndef configEVENT_GROUP_ISR_MAX_WAITERS
+	/* With configUSE_EVENT_GROUP_DIRECT_ISR set to 1, the largest number of
+	waiting tasks xEventGroupSetBitsFromISR() walks with interrupts masked.
+	Event groups with more waiting tasks are still updated by the timer service
+	task when the timers are available. */
+	#define configEVENT_GROUP_ISR_MAX_WAITERS 4
+#endif
+
 #ifndef configSTACK_DEPTH_TYPE
 	/* Defaults to uint16_t for backward compatibility, but can be overridden
 	in FreeRTOSConfig.h if uint16_t is too restrictive. */
@@ -1101,6 +1185,11 @@ typedef struct xSTATIC_EVENT_GROUP
 		UBaseType_t uxDummy3;
 	#endif
 
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		UBaseType_t uxDummy5;
+		TickType_t xDummy6[ 2 ];
+	#endif
+
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 			uint8_t ucDummy4;
 	#endif
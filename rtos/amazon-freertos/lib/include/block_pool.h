@@ -0,0 +1,246 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Block pools hand out blocks of one fixed size from a preallocated storage
+ * area.  pvBlockPoolAlloc() and vBlockPoolFree() take a bounded time and can be
+ * called from tasks and from interrupts of any priority: the free list is a
+ * lock free stack updated with the xPortCompareAndSwapU32() primitive of the
+ * port.  On a port that does not provide the primitive the free list is updated
+ * with the interrupts masked up to configMAX_SYSCALL_INTERRUPT_PRIORITY
+ * instead, the pools must then not be used from interrupts above that priority.
+ *
+ * A pool can hold up to 65534 blocks.  Blocks are at least 4 bytes and their
+ * size is rounded up to portBYTE_ALIGNMENT.
+ *
+ * When configUSE_BLOCK_POOL_MALLOC is set to 1 in FreeRTOSConfig.h the pools
+ * registered with xBlockPoolAddMallocClass() also serve the small
+ * pvPortMalloc() requests, the heap is only used when the request is larger
+ * than the largest registered block or all large enough pools are empty.
+ * pvPortMalloc() and vPortFree() remain task level functions.  The heap
+ * instrumentation (configHEAP_INSTRUMENTATION) cannot track pool blocks and
+ * cannot be enabled at the same time.
+ */
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include block_pool.h"
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/**
+ * Type by which block pools are referenced.  For example, a call to
+ * xBlockPoolCreate() returns a BlockPoolHandle_t variable that can then be
+ * used as a parameter to pvBlockPoolAlloc(), vBlockPoolFree(), etc.
+ */
+typedef void * BlockPoolHandle_t;
+
+/**
+ * Usage statistics of a block pool, see vBlockPoolGetStats().
+ */
+typedef struct xBLOCK_POOL_STATS
+{
+	size_t xBlockSize;					/*<< Size of the blocks after rounding. */
+	UBaseType_t uxBlockCount;			/*<< Number of blocks of the pool. */
+	UBaseType_t uxBlocksInUse;			/*<< Number of blocks currently allocated. */
+	UBaseType_t uxHighWaterMark;		/*<< Highest number of blocks allocated at the same time. */
+	UBaseType_t uxFailedAllocations;	/*<< Number of pvBlockPoolAlloc() calls that found the pool empty, and of pvPortMalloc() requests no size class could serve, counted on the smallest class they fit. */
+} BlockPoolStats_t;
+
+/*
+ * In line with the other kernel objects the block pool structure is not
+ * exposed, StaticBlockPool_t has its size and alignment so a pool can be
+ * created without dynamic allocation.
+ */
+typedef struct xSTATIC_BLOCK_POOL
+{
+	void *pvDummy1;
+	size_t xDummy2;
+	uint32_t ulDummy3[ 6 ];
+} StaticBlockPool_t;
+
+/* Size of the blocks of a pool after rounding. */
+#define blockpoolBLOCK_SIZE( xBlockSize )	( ( ( ( xBlockSize ) < sizeof( uint32_t ) ? sizeof( uint32_t ) : ( xBlockSize ) ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Size of the storage area needed by xBlockPoolCreateStatic(). */
+#define blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount )	( blockpoolBLOCK_SIZE( xBlockSize ) * ( size_t ) ( uxBlockCount ) )
+
+/**
+ * block_pool.h
+ *
+<pre>
+BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount );
+</pre>
+ *
+ * Creates a pool of uxBlockCount blocks of xBlockSize bytes, the pool structure
+ * and the storage area are allocated with pvPortMalloc().
+ *
+ * @return The handle of the pool, or NULL if there was not enough heap memory
+ * or the parameters are out of range.
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BlockPoolHandle_t xBlockPoolCreate( size_t xBlockSize, UBaseType_t uxBlockCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * block_pool.h
+ *
+<pre>
+BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize,
+                                          UBaseType_t uxBlockCount,
+                                          uint8_t *pucPoolStorageArea,
+                                          StaticBlockPool_t *pxStaticBlockPool );
+</pre>
+ *
+ * Creates a pool in memory provided by the application.
+ * pucPoolStorageArea must be aligned to portBYTE_ALIGNMENT and hold at least
+ * blockpoolSTORAGE_SIZE( xBlockSize, uxBlockCount ) bytes.
+ *
+ * Example use:
+<pre>
+#define POOL_BLOCK_SIZE		64
+#define POOL_BLOCK_COUNT	32
+
+static uint8_t ucPoolStorage[ blockpoolSTORAGE_SIZE( POOL_BLOCK_SIZE, POOL_BLOCK_COUNT ) ] __attribute__( ( aligned( portBYTE_ALIGNMENT ) ) );
+static StaticBlockPool_t xPoolStruct;
+
+void vAFunction( void )
+{
+BlockPoolHandle_t xPool;
+
+	xPool = xBlockPoolCreateStatic( POOL_BLOCK_SIZE, POOL_BLOCK_COUNT, ucPoolStorage, &xPoolStruct );
+}
+</pre>
+ *
+ * @return The handle of the pool, or NULL if the parameters are out of range.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	BlockPoolHandle_t xBlockPoolCreateStatic( size_t xBlockSize, UBaseType_t uxBlockCount, uint8_t *pucPoolStorageArea, StaticBlockPool_t *pxStaticBlockPool ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * block_pool.h
+ *
+<pre>
+void vBlockPoolDelete( BlockPoolHandle_t xPool );
+</pre>
+ *
+ * Deletes a pool, the memory of a dynamically created pool is returned to the
+ * heap.  The blocks of the pool must not be used any more and the pool must not
+ * be registered with xBlockPoolAddMallocClass().
+ */
+void vBlockPoolDelete( BlockPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *
+<pre>
+void *pvBlockPoolAlloc( BlockPoolHandle_t xPool );
+</pre>
+ *
+ * Takes a block from the pool.  Never blocks, can be called from tasks and
+ * interrupts.
+ *
+ * @return The block, aligned to portBYTE_ALIGNMENT, or NULL if the pool is
+ * empty.
+ */
+void *pvBlockPoolAlloc( BlockPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *
+<pre>
+void vBlockPoolFree( BlockPoolHandle_t xPool, void *pvBlock );
+</pre>
+ *
+ * Returns a block obtained from pvBlockPoolAlloc() on the same pool.  Never
+ * blocks, can be called from tasks and interrupts.
+ */
+void vBlockPoolFree( BlockPoolHandle_t xPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *
+<pre>
+BaseType_t xBlockPoolOwnsBlock( BlockPoolHandle_t xPool, const void *pvBlock );
+</pre>
+ *
+ * @return pdTRUE if pvBlock lies in the storage area of the pool.
+ */
+BaseType_t xBlockPoolOwnsBlock( BlockPoolHandle_t xPool, const void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *
+<pre>
+void vBlockPoolGetStats( BlockPoolHandle_t xPool, BlockPoolStats_t *pxStats );
+</pre>
+ *
+ * Reads the usage statistics of a pool.  The fields are read one by one, they
+ * are not a consistent snapshot while the pool is in use.
+ */
+void vBlockPoolGetStats( BlockPoolHandle_t xPool, BlockPoolStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * block_pool.h
+ *
+<pre>
+BaseType_t xBlockPoolAddMallocClass( BlockPoolHandle_t xPool );
+</pre>
+ *
+ * Registers a pool as a size class of pvPortMalloc(), only available when
+ * configUSE_BLOCK_POOL_MALLOC is 1.  A request is served by the smallest
+ * registered pool with large enough blocks that is not empty.  Up to
+ * configBLOCK_POOL_MALLOC_CLASSES pools can be registered, best before the
+ * scheduler is started.
+ *
+ * @return pdPASS if the pool was registered, pdFAIL if all classes are used.
+ */
+#if( configUSE_BLOCK_POOL_MALLOC == 1 )
+	BaseType_t xBlockPoolAddMallocClass( BlockPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THE FOLLOWING FUNCTIONS ARE FOR THE HEAP IMPLEMENTATIONS ONLY.
+	 *
+	 * pvBlockPoolMalloc() returns a block of the registered pools, or NULL if
+	 * the request must be served by the heap.  xBlockPoolMallocFree() returns
+	 * pdTRUE if the block belonged to a registered pool and was freed.
+	 */
+	void *pvBlockPoolMalloc( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+	BaseType_t xBlockPoolMallocFree( void *pv ) PRIVILEGED_FUNCTION;
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* BLOCK_POOL_H */
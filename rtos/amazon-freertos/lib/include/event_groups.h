@@ -368,6 +368,10 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * timer task to have the clear operation performed in the context of the timer
  * task.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h the bits
+ * are cleared by the interrupt itself, or by the task that holds the event
+ * group locked when it unlocks it, and pdPASS is always returned.
+ *
  * @param xEventGroup The event group in which the bits are to be cleared.
  *
  * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
@@ -403,7 +407,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear ) xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL )
@@ -499,6 +503,17 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h the bits
+ * are set and the waiting tasks are unblocked by the interrupt itself, which
+ * saves the message to the timer task and the switch to the timer task before
+ * the woken task runs.  The interrupt walks at most
+ * configEVENT_GROUP_ISR_MAX_WAITERS waiting tasks with interrupts masked, if
+ * more tasks wait on the event group the message is sent to the timer task as
+ * above (a later direct clear can then be applied before that set).  If a task
+ * is accessing the event group when the interrupt occurs, the interrupt only
+ * records the bits, and the task sets them and unblocks the waiting tasks
+ * before it resumes the scheduler.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -513,7 +528,13 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * xEventGroupSetBitsFromISR(), indicating that a context switch should be
  * requested before the interrupt exits.  For that reason
  * *pxHigherPriorityTaskWoken must be initialised to pdFALSE.  See the
- * example code below.
+ * example code below.  With configUSE_EVENT_GROUP_DIRECT_ISR set to 1 it
+ * depends on the path taken: when the interrupt unblocks the waiting tasks
+ * itself *pxHigherPriorityTaskWoken is set to pdTRUE if one of them has a
+ * priority above the interrupted task, when the message is sent to the timer
+ * task it is set as described above, and when a task is accessing the event
+ * group it is left unchanged - the task that applies the bits switches to a
+ * higher priority task it unblocked when it resumes the scheduler.
  *
  * @return If the request to execute the function was posted successfully then
  * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
@@ -555,7 +576,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken ) xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken )
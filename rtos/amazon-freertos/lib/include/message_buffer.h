@@ -772,6 +772,84 @@ BaseType_t xMessageBufferReceiveCompletedFromISR( MessageBufferHandle_t xStreamB
  */
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) xStreamBufferReceiveCompletedFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReserve( MessageBufferHandle_t xMessageBuffer,
+                              size_t xMaxMessageBytes,
+                              StreamBufferRegion_t * const pxRegion,
+                              TickType_t xTicksToWait );
+</pre>
+ *
+ * Reserves space for a message of up to xMaxMessageBytes bytes, so it can be
+ * written in place instead of being copied in by xMessageBufferSend().  The
+ * message is sent by xMessageBufferCommit().  See xStreamBufferReserve().
+ *
+ * @return xMaxMessageBytes, or 0 if the space could not be reserved before
+ * xTicksToWait expired.
+ *
+ * \defgroup xMessageBufferReserve xMessageBufferReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReserve( xMessageBuffer, xMaxMessageBytes, pxRegion, xTicksToWait ) xStreamBufferReserve( ( StreamBufferHandle_t ) xMessageBuffer, xMaxMessageBytes, pxRegion, xTicksToWait )
+#define xMessageBufferReserveFromISR( xMessageBuffer, xMaxMessageBytes, pxRegion ) xStreamBufferReserveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xMaxMessageBytes, pxRegion )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferCommit( MessageBufferHandle_t xMessageBuffer, size_t xMessageBytes );
+</pre>
+ *
+ * Sends the xMessageBytes bytes long message written in the region returned by
+ * the last xMessageBufferReserve() call.  See xStreamBufferCommit().
+ *
+ * \defgroup xMessageBufferCommit xMessageBufferCommit
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferCommit( xMessageBuffer, xMessageBytes ) xStreamBufferCommit( ( StreamBufferHandle_t ) xMessageBuffer, xMessageBytes )
+#define xMessageBufferCommitFromISR( xMessageBuffer, xMessageBytes, pxHigherPriorityTaskWoken ) xStreamBufferCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xMessageBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferAcquire( MessageBufferHandle_t xMessageBuffer,
+                              StreamBufferRegion_t * const pxRegion,
+                              TickType_t xTicksToWait );
+</pre>
+ *
+ * Returns the next message in place, so it can be processed without being
+ * copied out by xMessageBufferReceive().  The message stays in the buffer
+ * until it is removed by xMessageBufferRelease().  See xStreamBufferAcquire().
+ *
+ * @return The length of the message, or 0 if the buffer is empty.
+ *
+ * \defgroup xMessageBufferAcquire xMessageBufferAcquire
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferAcquire( xMessageBuffer, pxRegion, xTicksToWait ) xStreamBufferAcquire( ( StreamBufferHandle_t ) xMessageBuffer, pxRegion, xTicksToWait )
+#define xMessageBufferAcquireFromISR( xMessageBuffer, pxRegion ) xStreamBufferAcquireFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxRegion )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferRelease( MessageBufferHandle_t xMessageBuffer );
+</pre>
+ *
+ * Removes the message returned by xMessageBufferAcquire() from the buffer.
+ * See xStreamBufferRelease().
+ *
+ * @return The length of the message removed.
+ *
+ * \defgroup xMessageBufferRelease xMessageBufferRelease
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferRelease( xMessageBuffer ) xStreamBufferRelease( ( StreamBufferHandle_t ) xMessageBuffer, 0 )
+#define xMessageBufferReleaseFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) xStreamBufferReleaseFromISR( ( StreamBufferHandle_t ) xMessageBuffer, 0, pxHigherPriorityTaskWoken )
+
 #if defined( __cplusplus )
 } /* extern "C" */
 #endif
@@ -132,6 +132,64 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+#if( configHEAP_INSTRUMENTATION == 1 )
+
+	/* Number of size classes of the heap histograms.  Class 0 counts the sizes
+	below 32 bytes, class n the sizes from 16 << n to ( 32 << n ) - 1 bytes and
+	the last class all the larger sizes. */
+	#define portHEAP_HISTOGRAM_BINS		12
+
+	/* Filled by vPortGetHeapInstrumentationStats(). */
+	typedef struct xHEAP_INSTRUMENTATION_STATS
+	{
+		size_t xFreeBytes;								/* Same as xPortGetFreeHeapSize(). */
+		size_t xMinimumEverFreeBytes;					/* Same as xPortGetMinimumEverFreeHeapSize(). */
+		size_t xLargestFreeBlock;						/* Largest request that can currently succeed, plus the block header. */
+		size_t xFreeBlockCount;
+		size_t xLiveBlockCount;							/* Blocks allocated and not freed yet. */
+		size_t xLiveRequestedBytes;						/* Sum of the sizes passed to pvPortMalloc() for the live blocks. */
+		size_t xLiveBlockBytes;							/* Heap used by the live blocks, headers and padding included. */
+		size_t xFailedAllocations;						/* pvPortMalloc() calls that returned NULL. */
+		size_t xFreeBlockHistogram[ portHEAP_HISTOGRAM_BINS ];	/* Number of free blocks by size. */
+		size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ];	/* Number of successful pvPortMalloc() calls by requested size, since start up. */
+	} HeapInstrumentationStats_t;
+
+	/* Live heap usage of one caller of pvPortMalloc() in one task. */
+	typedef struct xHEAP_CONSUMER
+	{
+		void *pvCaller;			/* Return address of the pvPortMalloc() call. */
+		void *pvTask;			/* Handle of the task that called pvPortMalloc(), NULL before the scheduler started. */
+		size_t xBytes;			/* Sum of the requested sizes of the live blocks. */
+		size_t xBlocks;
+	} HeapConsumer_t;
+
+	/* Receives the lines of the heap report, without line ending. */
+	typedef void ( *HeapReportOutput_t )( const char *pcLine );
+
+	/*
+	 * Fragmentation and usage statistics of the heap, computed by walking the
+	 * heap with the scheduler suspended.
+	 */
+	void vPortGetHeapInstrumentationStats( HeapInstrumentationStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Groups the live blocks by caller and task, and writes up to
+	 * xMaxConsumers groups to pxConsumers, the largest first.  Returns the
+	 * number of groups written.  When there are more groups than xMaxConsumers,
+	 * the bytes of the groups that did not fit are added to *pxUntrackedBytes
+	 * if it is not NULL.
+	 */
+	size_t xPortGetHeapConsumers( HeapConsumer_t *pxConsumers, size_t xMaxConsumers, size_t *pxUntrackedBytes ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Writes the statistics and the xTopCount largest consumers as text, one
+	 * line per call of pxOutput, to be sent over a UART or RPMsg.  Not
+	 * reentrant.
+	 */
+	void vPortHeapReport( HeapReportOutput_t pxOutput, size_t xTopCount ) PRIVILEGED_FUNCTION;
+
+#endif /* configHEAP_INSTRUMENTATION */
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -0,0 +1,175 @@
+/*
+ * FreeRTOS Kernel V10.0.1
+ * Copyright (C) 2017 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TICK_WHEEL_H
+#define TICK_WHEEL_H
+
+/*
+ * Slot arithmetic shared by the timer wheel of timers.c
+ * (configUSE_TIMER_WHEEL) and the delayed task wheel of tasks.c
+ * (configUSE_DELAYED_TASK_WHEEL).  Only those two files include this header.
+ *
+ * Each level of a wheel has 16 slots.  Level n holds the items that are due
+ * between 16^n and 16^(n+1) ticks after the wheel time, the next tick the
+ * wheel has to process, in the slot selected by bits 4n to 4n+3 of their due
+ * time.  The levels cover the whole tick range, so the due times are only ever
+ * compared through their distance from the wheel time and a tick count
+ * overflow needs no special handling.  A wheel keeps one 16 bit mask per level
+ * with a bit set for each slot in use.
+ *
+ * The lists of the slots, and how an item moves from one slot to another, are
+ * left to the file that owns the wheel.
+ */
+
+#define wheelSLOT_BITS		( 4U )
+#define wheelSLOTS			( 1U << wheelSLOT_BITS )
+#define wheelSLOT_MASK		( wheelSLOTS - 1U )
+#define wheelLEVELS			( ( sizeof( TickType_t ) * 8U ) / wheelSLOT_BITS )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the level of an item due xTicksToDue ticks after the wheel time, the
+ * number of whole groups of 4 bits in the distance.
+ */
+static UBaseType_t prvWheelGetLevel( const TickType_t xTicksToDue )
+{
+UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+
+	while( ( uxLevel < ( UBaseType_t ) ( wheelLEVELS - 1U ) ) && ( ( xTicksToDue >> ( ( uxLevel + ( UBaseType_t ) 1U ) * wheelSLOT_BITS ) ) != ( TickType_t ) 0U ) )
+	{
+		uxLevel++;
+	}
+
+	return uxLevel;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the slot of level uxLevel that covers the tick xTime.
+ */
+static UBaseType_t prvWheelGetSlot( const TickType_t xTime, const UBaseType_t uxLevel )
+{
+	return ( UBaseType_t ) ( xTime >> ( uxLevel * wheelSLOT_BITS ) ) & wheelSLOT_MASK;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the highest level with a slot that starts at the tick xTick, or 0 if
+ * there is none.  When the wheel reaches xTick the items of the slot of xTick
+ * on levels 1 to the returned level, in that order, are due less than a slot
+ * width later and must be cascaded to lower levels.  The slot of the next
+ * level up can only start at the same tick if the slot of this level is slot
+ * 0.
+ */
+static UBaseType_t prvWheelGetTopCascadeLevel( const TickType_t xTick )
+{
+UBaseType_t uxLevel;
+
+	for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) wheelLEVELS; uxLevel++ )
+	{
+		if( ( xTick & ( TickType_t ) ( ( ( TickType_t ) 1U << ( uxLevel * wheelSLOT_BITS ) ) - 1U ) ) != ( TickType_t ) 0U )
+		{
+			break;
+		}
+	}
+
+	return uxLevel - ( UBaseType_t ) 1U;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * If any bit of pusSlotsInUse is set then set *pxTicksToEvent to the number
+ * of ticks from xWheelTime to the first tick at which an item is due or a slot
+ * must be cascaded, and return pdTRUE.  Otherwise return pdFALSE.
+ */
+static BaseType_t prvWheelGetNextEvent( const uint16_t * const pusSlotsInUse, const TickType_t xWheelTime, TickType_t * const pxTicksToEvent )
+{
+BaseType_t xWheelIsEmpty = pdTRUE;
+TickType_t xBlock, xTicks, xFirstEvent = portMAX_DELAY;
+UBaseType_t uxLevel, uxShift;
+uint32_t ulSlots;
+
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) wheelLEVELS; uxLevel++ )
+	{
+		if( pusSlotsInUse[ uxLevel ] != ( uint16_t ) 0U )
+		{
+			xWheelIsEmpty = pdFALSE;
+			uxShift = uxLevel * wheelSLOT_BITS;
+
+			/* The slots of a level are processed in turn, one per block of
+			16^level ticks.  The first one still to process is the slot of the
+			block xWheelTime is in if xWheelTime is the first tick of the
+			block, which is always the case on level 0, else the slot of the
+			next block. */
+			xBlock = ( TickType_t ) ( xWheelTime >> uxShift );
+			if( ( xWheelTime & ( TickType_t ) ( ( ( TickType_t ) 1U << uxShift ) - 1U ) ) != ( TickType_t ) 0U )
+			{
+				xBlock++;
+			}
+
+			/* Rotate the slot bits so the slot of xBlock is bit 0, the number
+			of trailing zeros is then the number of blocks to the first slot in
+			use. */
+			ulSlots = ( uint32_t ) pusSlotsInUse[ uxLevel ];
+			ulSlots = ( ( ulSlots >> ( xBlock & wheelSLOT_MASK ) ) | ( ulSlots << ( wheelSLOTS - ( xBlock & wheelSLOT_MASK ) ) ) ) & 0xffffUL;
+
+			if( ( ulSlots & 0xffUL ) == 0UL )
+			{
+				xBlock += ( TickType_t ) 8U;
+				ulSlots >>= 8U;
+			}
+			if( ( ulSlots & 0x0fUL ) == 0UL )
+			{
+				xBlock += ( TickType_t ) 4U;
+				ulSlots >>= 4U;
+			}
+			if( ( ulSlots & 0x03UL ) == 0UL )
+			{
+				xBlock += ( TickType_t ) 2U;
+				ulSlots >>= 2U;
+			}
+			if( ( ulSlots & 0x01UL ) == 0UL )
+			{
+				xBlock += ( TickType_t ) 1U;
+			}
+
+			xTicks = ( TickType_t ) ( xBlock << uxShift ) - xWheelTime;
+			if( xTicks < xFirstEvent )
+			{
+				xFirstEvent = xTicks;
+			}
+		}
+	}
+
+	*pxTicksToEvent = xFirstEvent;
+
+	return ( xWheelIsEmpty == pdFALSE ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* TICK_WHEEL_H */
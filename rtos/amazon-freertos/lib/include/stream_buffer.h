@@ -63,6 +63,20 @@ extern "C" {
  */
 typedef void * StreamBufferHandle_t;
 
+/**
+ * Describes space reserved with xStreamBufferReserve() or data acquired with
+ * xStreamBufferAcquire().  The bytes are contiguous unless they wrap at the end
+ * of the buffer's storage area, in which case they continue at pucSecond.
+ * pucSecond is NULL and xSecondLength is 0 if the bytes do not wrap.
+ */
+typedef struct xSTREAM_BUFFER_REGION
+{
+	uint8_t *pucFirst;
+	size_t xFirstLength;
+	uint8_t *pucSecond;
+	size_t xSecondLength;
+} StreamBufferRegion_t;
+
 
 /**
  * message_buffer.h
@@ -585,6 +599,215 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             size_t xMinimumBytes,
+                             StreamBufferRegion_t * const pxRegion,
+                             TickType_t xTicksToWait );
+</pre>
+ *
+ * Reserves space in a stream buffer so the writer, or a DMA it programs, can
+ * write the data directly into the buffer's storage area instead of copying it
+ * in with xStreamBufferSend().  The data is not visible to the reader until it
+ * is committed with xStreamBufferCommit().
+ *
+ * For a stream buffer the reserved region is all the free space, which is at
+ * least xMinimumBytes.  For a message buffer the reserved region is exactly
+ * xMinimumBytes, the maximum length of the message that will be written, and
+ * space for the message length is reserved in front of it.
+ *
+ * The region is split in two parts if it wraps at the end of the storage area.
+ * The writer must fill the first part before the second.
+ *
+ * Like xStreamBufferSend(), only one task or interrupt may write to a stream
+ * buffer at a time, and the space must be committed before it is reserved
+ * again.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param xMinimumBytes The minimum number of bytes to reserve.
+ *
+ * @param pxRegion Set to the reserved region, or to an empty region if the
+ * space could not be reserved.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for xMinimumBytes to become free, as for
+ * xStreamBufferSend().
+ *
+ * @return The number of bytes reserved, which is 0 if the space could not be
+ * reserved before xTicksToWait expired.
+ *
+ * \defgroup xStreamBufferReserve xStreamBufferReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+							 size_t xMinimumBytes,
+							 StreamBufferRegion_t * const pxRegion,
+							 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xMinimumBytes,
+                                    StreamBufferRegion_t * const pxRegion );
+</pre>
+ *
+ * A version of xStreamBufferReserve() that can be called from an interrupt
+ * service routine (ISR).  It never blocks.
+ *
+ * \defgroup xStreamBufferReserveFromISR xStreamBufferReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xMinimumBytes,
+									StreamBufferRegion_t * const pxRegion ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten );
+</pre>
+ *
+ * Makes the first xBytesWritten bytes of the region returned by the last
+ * xStreamBufferReserve() call visible to the reader, and unblocks a task
+ * waiting to receive if the trigger level is reached.  For a message buffer
+ * xBytesWritten is the length of the message, which must not be more than the
+ * number of bytes reserved.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was written to.
+ *
+ * @param xBytesWritten The number of bytes written into the reserved region.
+ * Committing 0 bytes drops the reservation.
+ *
+ * @return xBytesWritten.
+ *
+ * \defgroup xStreamBufferCommit xStreamBufferCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xBytesWritten,
+                                   BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xStreamBufferCommit() that can be called from an interrupt
+ * service routine (ISR).  *pxHigherPriorityTaskWoken is set as by
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferCommitFromISR xStreamBufferCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+								   size_t xBytesWritten,
+								   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferAcquire( StreamBufferHandle_t xStreamBuffer,
+                             StreamBufferRegion_t * const pxRegion,
+                             TickType_t xTicksToWait );
+</pre>
+ *
+ * Returns the data in a stream buffer in place, so the reader can process it
+ * without copying it out with xStreamBufferReceive().  The data stays in the
+ * buffer until it is released with xStreamBufferRelease().
+ *
+ * For a stream buffer the region is all the bytes in the buffer.  For a
+ * message buffer the region is the next message, without its length.
+ *
+ * Like xStreamBufferReceive(), only one task or interrupt may read from a
+ * stream buffer at a time.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param pxRegion Set to the acquired region, or to an empty region if the
+ * buffer is empty.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data, as for xStreamBufferReceive().
+ *
+ * @return The number of bytes acquired.
+ *
+ * \defgroup xStreamBufferAcquire xStreamBufferAcquire
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquire( StreamBufferHandle_t xStreamBuffer,
+							 StreamBufferRegion_t * const pxRegion,
+							 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    StreamBufferRegion_t * const pxRegion );
+</pre>
+ *
+ * A version of xStreamBufferAcquire() that can be called from an interrupt
+ * service routine (ISR).  It never blocks.
+ *
+ * \defgroup xStreamBufferAcquireFromISR xStreamBufferAcquireFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+									StreamBufferRegion_t * const pxRegion ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead );
+</pre>
+ *
+ * Removes data returned by xStreamBufferAcquire() from the buffer, and
+ * unblocks a task waiting to send.  For a stream buffer the first xBytesRead
+ * bytes are removed, the rest can be acquired again.  For a message buffer the
+ * whole message is removed and xBytesRead is ignored.
+ *
+ * @param xStreamBuffer The handle of the stream buffer that was read from.
+ *
+ * @param xBytesRead The number of bytes to remove from a stream buffer.
+ *
+ * @return The number of bytes removed, not including the message length.
+ *
+ * \defgroup xStreamBufferRelease xStreamBufferRelease
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xBytesRead ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesRead,
+                                    BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * A version of xStreamBufferRelease() that can be called from an interrupt
+ * service routine (ISR).  *pxHigherPriorityTaskWoken is set as by
+ * xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReleaseFromISR xStreamBufferReleaseFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+									size_t xBytesRead,
+									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *